@@ -0,0 +1,394 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2019 - 2019 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CartesianPatchGeometry.h>
+#include <CellData.h>
+#include <CellVariable.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <SideData.h>
+#include <SideVariable.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/LEInteractor.h>
+#include <ibtk/PatchMathOps.h>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+// Micro-benchmarks for the patch-level kernels used by IBTK: Lagrangian-Eulerian
+// spreading and interpolation (LEInteractor) and finite difference stencils
+// (PatchMathOps).
+//
+// The problem size and the patch size are set in the usual way through the
+// CartesianGeometry and GriddingAlgorithm databases.  The Main database selects
+// the kernels to run, the delta functions used by spreading and interpolation,
+// the number of Lagrangian points per Cartesian grid cell, and the number of
+// timed repetitions.  Each kernel is applied to all local patches of all levels
+// of the hierarchy, and each repetition is timed as the maximum wall clock time
+// over all processes.  Rates are computed from the fastest repetition.
+//
+// Memory bandwidth is estimated from the minimum amount of data that each
+// kernel must read or write: the Lagrangian positions and values, and the
+// Eulerian values in the patch interiors.  Ghost values and the indirect
+// accesses made by the delta function stencils are not counted, so the reported
+// values are lower bounds on the actual memory traffic.
+//
+// Results are written to the file named by Main::json_file_name.
+
+/*******************************************************************************
+ * For each run, the input filename must be given on the command line.  In all *
+ * cases, the command line is:                                                 *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+
+struct BenchmarkResult
+{
+    std::string kernel, delta_fcn;
+    double num_points = 0.0, num_cells = 0.0, num_bytes = 0.0;
+    std::vector<double> times;
+};
+
+// Run fcn num_warmup times without timing it, and then return the wall clock
+// time (maximum over all processes) of each of num_repetitions calls.
+std::vector<double>
+time_kernel(const std::function<void()>& fcn, const int num_warmup, const int num_repetitions)
+{
+    for (int k = 0; k < num_warmup; ++k) fcn();
+    std::vector<double> times(num_repetitions);
+    for (int k = 0; k < num_repetitions; ++k)
+    {
+        SAMRAI_MPI::barrier();
+        const auto start = std::chrono::steady_clock::now();
+        fcn();
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        times[k] = elapsed.count();
+    }
+    SAMRAI_MPI::maxReduction(times.data(), num_repetitions);
+    return times;
+} // time_kernel
+
+void
+write_result(std::ostream& os, const BenchmarkResult& result, const bool last)
+{
+    if (result.times.empty())
+    {
+        TBOX_ERROR("ibtk_kernels: no timings were recorded for kernel " << result.kernel << "\n");
+    }
+    std::vector<double> sorted_times = result.times;
+    std::sort(sorted_times.begin(), sorted_times.end());
+    const auto n = sorted_times.size();
+    const double min_time = sorted_times.front();
+    const double median_time =
+        (n % 2 == 1) ? sorted_times[n / 2] : 0.5 * (sorted_times[n / 2 - 1] + sorted_times[n / 2]);
+    const double mean_time = std::accumulate(sorted_times.begin(), sorted_times.end(), 0.0) / static_cast<double>(n);
+    os << "    {\n";
+    os << "      \"kernel\": \"" << result.kernel << "\",\n";
+    if (!result.delta_fcn.empty()) os << "      \"delta_fcn\": \"" << result.delta_fcn << "\",\n";
+    os << "      \"num_repetitions\": " << n << ",\n";
+    os << "      \"num_points\": " << result.num_points << ",\n";
+    os << "      \"num_cells\": " << result.num_cells << ",\n";
+    os << "      \"min_time\": " << min_time << ",\n";
+    os << "      \"median_time\": " << median_time << ",\n";
+    os << "      \"mean_time\": " << mean_time << ",\n";
+    if (result.num_points > 0.0) os << "      \"points_per_second\": " << result.num_points / min_time << ",\n";
+    os << "      \"cells_per_second\": " << result.num_cells / min_time << ",\n";
+    os << "      \"gigabytes_per_second\": " << 1.0e-9 * result.num_bytes / min_time << "\n";
+    os << "    }" << (last ? "" : ",") << "\n";
+    return;
+} // write_result
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    {
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "ibtk_kernels.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        Pointer<Database> main_db = app_initializer->getComponentDatabase("Main");
+
+        // Read the benchmark parameters.
+        const Array<std::string> kernels = main_db->getStringArray("kernels");
+        Array<std::string> delta_fcns(1);
+        delta_fcns[0] = "IB_4";
+        if (main_db->keyExists("delta_fcns")) delta_fcns = main_db->getStringArray("delta_fcns");
+        const double points_per_cell = main_db->getDoubleWithDefault("points_per_cell", 1.0);
+        const int num_warmup = main_db->getIntegerWithDefault("num_warmup_repetitions", 1);
+        const int num_repetitions = main_db->getIntegerWithDefault("num_repetitions", 10);
+        if (num_repetitions <= 0)
+        {
+            TBOX_ERROR("ibtk_kernels: num_repetitions must be positive, got " << num_repetitions << "\n");
+        }
+        const int seed = main_db->getIntegerWithDefault("seed", 0);
+        const std::string json_file_name = main_db->getStringWithDefault("json_file_name", "ibtk_kernels.json");
+
+        // Create major algorithm and data objects that comprise the
+        // application.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables with enough ghost cells for the widest delta
+        // function.
+        int ghost_width = 1;
+        for (int k = 0; k < delta_fcns.getSize(); ++k)
+        {
+            ghost_width = std::max(ghost_width, LEInteractor::getMinimumGhostWidth(delta_fcns[k]));
+        }
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+        Pointer<CellVariable<NDIM, double> > u_cc_var = new CellVariable<NDIM, double>("u_cc");
+        Pointer<CellVariable<NDIM, double> > f_cc_var = new CellVariable<NDIM, double>("f_cc");
+        Pointer<SideVariable<NDIM, double> > u_sc_var = new SideVariable<NDIM, double>("u_sc");
+        Pointer<SideVariable<NDIM, double> > f_sc_var = new SideVariable<NDIM, double>("f_sc");
+        const int u_cc_idx = var_db->registerVariableAndContext(u_cc_var, ctx, IntVector<NDIM>(ghost_width));
+        const int f_cc_idx = var_db->registerVariableAndContext(f_cc_var, ctx, IntVector<NDIM>(ghost_width));
+        const int u_sc_idx = var_db->registerVariableAndContext(u_sc_var, ctx, IntVector<NDIM>(ghost_width));
+        const int f_sc_idx = var_db->registerVariableAndContext(f_sc_var, ctx, IntVector<NDIM>(ghost_width));
+
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        const int tag_buffer = std::numeric_limits<int>::max();
+        int level_number = 0;
+        while ((gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            ++level_number;
+        }
+        const int finest_level = patch_hierarchy->getFinestLevelNumber();
+
+        // Allocate and initialize the Eulerian data, and collect the local
+        // patches.
+        std::vector<Pointer<Patch<NDIM> > > patches;
+        double num_local_cells = 0.0;
+        for (int ln = 0; ln <= finest_level; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->allocatePatchData(u_cc_idx, 0.0);
+            level->allocatePatchData(f_cc_idx, 0.0);
+            level->allocatePatchData(u_sc_idx, 0.0);
+            level->allocatePatchData(f_sc_idx, 0.0);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<CellData<NDIM, double> > u_cc_data = patch->getPatchData(u_cc_idx);
+                Pointer<CellData<NDIM, double> > f_cc_data = patch->getPatchData(f_cc_idx);
+                Pointer<SideData<NDIM, double> > u_sc_data = patch->getPatchData(u_sc_idx);
+                Pointer<SideData<NDIM, double> > f_sc_data = patch->getPatchData(f_sc_idx);
+                u_cc_data->fillAll(1.0);
+                f_cc_data->fillAll(0.0);
+                u_sc_data->fillAll(1.0);
+                f_sc_data->fillAll(0.0);
+                patches.push_back(patch);
+                num_local_cells += patch->getBox().size();
+            }
+        }
+        const double num_cells = SAMRAI_MPI::sumReduction(num_local_cells);
+
+        // Generate pseudo-random Lagrangian points in the interior of each
+        // local patch.  The points are seeded by the patch number so that runs
+        // are repeatable.
+        std::vector<std::vector<double> > X_data(patches.size()), F_data(patches.size()), Q_data(patches.size());
+        double num_local_points = 0.0;
+        for (unsigned int k = 0; k < patches.size(); ++k)
+        {
+            const Pointer<Patch<NDIM> >& patch = patches[k];
+            const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            const double* const x_lower = pgeom->getXLower();
+            const double* const x_upper = pgeom->getXUpper();
+            const int num_points = static_cast<int>(points_per_cell * patch->getBox().size());
+            std::mt19937 rng(seed + patch->getPatchNumber() + 1000 * patch->getPatchLevelNumber());
+            std::uniform_real_distribution<double> distribution(0.0, 1.0);
+            X_data[k].resize(NDIM * num_points);
+            F_data[k].resize(NDIM * num_points, 1.0);
+            Q_data[k].resize(num_points, 1.0);
+            for (int i = 0; i < num_points; ++i)
+            {
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    X_data[k][NDIM * i + d] = x_lower[d] + (x_upper[d] - x_lower[d]) * distribution(rng);
+                }
+            }
+            num_local_points += num_points;
+        }
+        const double num_points = SAMRAI_MPI::sumReduction(num_local_points);
+
+        // Run the benchmarks.
+        PatchMathOps patch_math_ops;
+        std::vector<BenchmarkResult> results;
+        for (int kernel_num = 0; kernel_num < kernels.getSize(); ++kernel_num)
+        {
+            const std::string& kernel = kernels[kernel_num];
+            if (kernel == "spread_cc" || kernel == "interpolate_cc" || kernel == "spread_sc" ||
+                kernel == "interpolate_sc")
+            {
+                const bool spread = kernel.compare(0, 6, "spread") == 0;
+                const bool side_centered = kernel.compare(kernel.size() - 2, 2, "sc") == 0;
+                for (int k = 0; k < delta_fcns.getSize(); ++k)
+                {
+                    const std::string& delta_fcn = delta_fcns[k];
+                    auto fcn = [&]() {
+                        for (unsigned int p = 0; p < patches.size(); ++p)
+                        {
+                            const Pointer<Patch<NDIM> >& patch = patches[p];
+                            const Box<NDIM>& patch_box = patch->getBox();
+                            if (side_centered && spread)
+                            {
+                                Pointer<SideData<NDIM, double> > f_sc_data = patch->getPatchData(f_sc_idx);
+                                LEInteractor::spread(
+                                    f_sc_data, F_data[p], NDIM, X_data[p], NDIM, patch, patch_box, delta_fcn);
+                            }
+                            else if (side_centered)
+                            {
+                                Pointer<SideData<NDIM, double> > u_sc_data = patch->getPatchData(u_sc_idx);
+                                LEInteractor::interpolate(
+                                    F_data[p], NDIM, X_data[p], NDIM, u_sc_data, patch, patch_box, delta_fcn);
+                            }
+                            else if (spread)
+                            {
+                                Pointer<CellData<NDIM, double> > f_cc_data = patch->getPatchData(f_cc_idx);
+                                LEInteractor::spread(
+                                    f_cc_data, Q_data[p], 1, X_data[p], NDIM, patch, patch_box, delta_fcn);
+                            }
+                            else
+                            {
+                                Pointer<CellData<NDIM, double> > u_cc_data = patch->getPatchData(u_cc_idx);
+                                LEInteractor::interpolate(
+                                    Q_data[p], 1, X_data[p], NDIM, u_cc_data, patch, patch_box, delta_fcn);
+                            }
+                        }
+                    };
+                    BenchmarkResult result;
+                    result.kernel = kernel;
+                    result.delta_fcn = delta_fcn;
+                    result.num_points = num_points;
+                    result.num_cells = num_cells;
+                    const int depth = side_centered ? NDIM : 1;
+                    result.num_bytes =
+                        sizeof(double) * (num_points * (NDIM + depth) + num_cells * depth * (spread ? 2 : 1));
+                    result.times = time_kernel(fcn, num_warmup, num_repetitions);
+                    results.push_back(result);
+                }
+            }
+            else if (kernel == "laplace_cc" || kernel == "laplace_sc" || kernel == "grad_sc" || kernel == "div_sc")
+            {
+                auto fcn = [&]() {
+                    for (const auto& patch : patches)
+                    {
+                        Pointer<CellData<NDIM, double> > u_cc_data = patch->getPatchData(u_cc_idx);
+                        Pointer<CellData<NDIM, double> > f_cc_data = patch->getPatchData(f_cc_idx);
+                        Pointer<SideData<NDIM, double> > u_sc_data = patch->getPatchData(u_sc_idx);
+                        Pointer<SideData<NDIM, double> > f_sc_data = patch->getPatchData(f_sc_idx);
+                        if (kernel == "laplace_cc")
+                            patch_math_ops.laplace(f_cc_data, 1.0, 0.0, u_cc_data, 0.0, u_cc_data, patch);
+                        else if (kernel == "laplace_sc")
+                            patch_math_ops.laplace(f_sc_data, 1.0, 0.0, u_sc_data, 0.0, u_sc_data, patch);
+                        else if (kernel == "grad_sc")
+                            patch_math_ops.grad(f_sc_data, 1.0, u_cc_data, 0.0, f_sc_data, patch);
+                        else
+                            patch_math_ops.div(f_cc_data, 1.0, u_sc_data, 0.0, f_cc_data, patch);
+                    }
+                };
+                BenchmarkResult result;
+                result.kernel = kernel;
+                result.num_cells = num_cells;
+                const int src_depth = (kernel == "laplace_cc" || kernel == "grad_sc") ? 1 : NDIM;
+                const int dst_depth = (kernel == "laplace_cc" || kernel == "div_sc") ? 1 : NDIM;
+                result.num_bytes = sizeof(double) * num_cells * (src_depth + dst_depth);
+                result.times = time_kernel(fcn, num_warmup, num_repetitions);
+                results.push_back(result);
+            }
+            else
+            {
+                TBOX_ERROR("ibtk_kernels: unknown kernel " << kernel << "\n"
+                                                           << "valid kernels are: spread_cc, interpolate_cc, "
+                                                              "spread_sc, interpolate_sc, laplace_cc, laplace_sc, "
+                                                              "grad_sc, div_sc\n");
+            }
+        }
+
+        // Write out the results.
+        if (SAMRAI_MPI::getRank() == 0)
+        {
+            std::ofstream out(json_file_name);
+            out.precision(8);
+            out << "{\n";
+            out << "  \"benchmark\": \"ibtk_kernels\",\n";
+            out << "  \"ndim\": " << NDIM << ",\n";
+            out << "  \"num_processes\": " << SAMRAI_MPI::getNodes() << ",\n";
+            out << "  \"num_levels\": " << finest_level + 1 << ",\n";
+            out << "  \"points_per_cell\": " << points_per_cell << ",\n";
+            out << "  \"results\": [\n";
+            for (unsigned int k = 0; k < results.size(); ++k)
+            {
+                write_result(out, results[k], k + 1 == results.size());
+            }
+            out << "  ]\n";
+            out << "}\n";
+        }
+        for (const auto& result : results)
+        {
+            pout << result.kernel << (result.delta_fcn.empty() ? "" : " (" + result.delta_fcn + ")")
+                 << ": minimum time = " << *std::min_element(result.times.begin(), result.times.end()) << " s\n";
+        }
+    }
+
+    // At this point all SAMRAI, PETSc, and IBAMR objects have been cleaned
+    // up, so we shut things down in the opposite order of initialization:
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+} // main
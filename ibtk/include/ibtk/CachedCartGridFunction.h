@@ -0,0 +1,167 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2019 - 2019 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+#ifndef included_IBTK_CachedCartGridFunction
+#define included_IBTK_CachedCartGridFunction
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/CartGridFunction.h"
+
+#include "PatchLevel.h"
+#include "tbox/Pointer.h"
+
+#include <map>
+#include <string>
+
+namespace SAMRAI
+{
+namespace hier
+{
+template <int DIM>
+class Patch;
+template <int DIM>
+class PatchHierarchy;
+template <int DIM>
+class Variable;
+} // namespace hier
+} // namespace SAMRAI
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class CachedCartGridFunction is a concrete CartGridFunction that
+ * stores the values computed by another CartGridFunction so that they need to
+ * be evaluated only once for each patch of the hierarchy.
+ *
+ * Caching is used only when the wrapped function is not time-dependent, or
+ * when the caller asserts (via the constructor argument \em
+ * cache_time_dependent_data) that the data depend only on the grid geometry.
+ * Otherwise, all calls are forwarded to the wrapped function.
+ *
+ * The cached values are stored separately for each patch data index as
+ * additional patch data without ghost cells that are allocated on the patches
+ * of the hierarchy.  Because the patches are recreated whenever the hierarchy
+ * is regridded, the cache is invalidated automatically when the hierarchy
+ * configuration changes.  Values computed at the initial time are never
+ * cached.
+ *
+ * \note The values are computed via the wrapped function's implementation of
+ * setDataOnPatch(), so only functions that implement setDataOnPatch() may be
+ * wrapped.
+ */
+class CachedCartGridFunction : public CartGridFunction
+{
+public:
+    /*!
+     * \brief Constructor.
+     */
+    CachedCartGridFunction(std::string object_name,
+                           SAMRAI::tbox::Pointer<CartGridFunction> fcn,
+                           bool cache_time_dependent_data = false);
+
+    /*!
+     * \brief Empty virtual destructor.
+     */
+    virtual ~CachedCartGridFunction() = default;
+
+    /*!
+     * \brief Deallocate all cached data on the specified levels of the patch
+     * hierarchy.
+     */
+    void clearCache(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                    int coarsest_ln = -1,
+                    int finest_ln = -1);
+
+    /*!
+     * \name Methods to set patch interior data.
+     */
+    //\{
+
+    /*!
+     * \brief Indicates whether the concrete CachedCartGridFunction object is
+     * time-dependent.
+     */
+    bool isTimeDependent() const override;
+
+    /*!
+     * \brief Set the data on the patch interior, either by copying previously
+     * cached values or by evaluating the wrapped function.
+     */
+    void setDataOnPatch(int data_idx,
+                        SAMRAI::tbox::Pointer<SAMRAI::hier::Variable<NDIM> > var,
+                        SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                        double data_time,
+                        bool initial_time = false,
+                        SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level =
+                            SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> >(NULL)) override;
+
+    //\}
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    CachedCartGridFunction() = delete;
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    CachedCartGridFunction(const CachedCartGridFunction& from) = delete;
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    CachedCartGridFunction& operator=(const CachedCartGridFunction& that) = delete;
+
+    /*!
+     * \brief Get the patch data index used to cache the values stored in the
+     * patch data index \em data_idx, registering it if necessary.
+     */
+    int getCacheIndex(int data_idx);
+
+    /*
+     * The wrapped function object.
+     */
+    SAMRAI::tbox::Pointer<CartGridFunction> d_fcn;
+
+    /*
+     * Whether the values computed by the wrapped function are cached.
+     */
+    bool d_use_cache;
+
+    /*
+     * The patch data indices used to cache the values, keyed by the patch data
+     * indices of the data being set.
+     */
+    std::map<int, int> d_cache_idx_map;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_CachedCartGridFunction
@@ -16,12 +16,15 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include "ibtk/JacobianCalculatorCache.h"
 #include "ibtk/QuadratureCache.h"
 #include "ibtk/SAMRAIDataCache.h"
 #include "ibtk/ibtk_macros.h"
 #include "ibtk/ibtk_utilities.h"
+#include "ibtk/libmesh_utilities.h"
 
 #include "BasePatchLevel.h"
+#include "Box.h"
 #include "CellVariable.h"
 #include "IntVector.h"
 #include "LoadBalancer.h"
@@ -45,6 +48,10 @@
 #include "libmesh/sparse_matrix.h"
 #include "libmesh/system.h"
 
+#include "petscksp.h"
+#include "petscmat.h"
+#include "petscvec.h"
+
 IBTK_DISABLE_EXTRA_WARNINGS
 #include "boost/multi_array.hpp"
 IBTK_ENABLE_EXTRA_WARNINGS
@@ -139,6 +146,108 @@ public:
         std::unordered_map<libMesh::dof_id_type, std::vector<std::vector<unsigned int> > > d_dof_cache;
     };
 
+    /*!
+     * Class which applies the consistent L2 mass matrix of a system without
+     * assembling it. Element mass matrices are computed once and stored
+     * contiguously: since every variable of a system uses the same finite
+     * element, elements on which no degree of freedom is constrained store a
+     * single block which is applied to all variables (e.g., all NDIM
+     * components of a vector-valued system) at once. Constrained elements
+     * store one block per variable with the constraints already applied.
+     *
+     * The operator is inverted with a Krylov method that is preconditioned
+     * by the inverse of the lumped mass matrix computed by
+     * FEDataManager::buildDiagonalL2MassMatrix(). The solver uses the
+     * incoming contents of the solution vector as the initial guess, so
+     * callers that project the same quantity repeatedly (e.g., the structure
+     * velocity) get warm-started solves for free.
+     *
+     * Options for the Krylov solver may be given on the command line with the
+     * prefix <code>L2_proj_mf_</code>.
+     *
+     * @note The contents of this object are invalidated when the mesh is
+     * repartitioned and are reset by FEData::clearCached().
+     */
+    class MatrixFreeL2ProjectionOperator
+    {
+    public:
+        /*!
+         * Constructor. Computes and stores the element mass matrices of the
+         * system. @p M_diag is the diagonal (lumped) mass matrix used as the
+         * preconditioner.
+         */
+        MatrixFreeL2ProjectionOperator(libMesh::System& system,
+                                       SystemDofMapCache& dof_map_cache,
+                                       libMesh::PetscVector<double>& M_diag);
+
+        /*!
+         * Destructor.
+         */
+        ~MatrixFreeL2ProjectionOperator();
+
+        /*!
+         * Solve M U = F with relative tolerance @p tol, using at most @p
+         * max_its iterations and the current value of @p U as the initial
+         * guess.
+         *
+         * \return Whether or not the solver converged.
+         */
+        bool solve(libMesh::PetscVector<double>& U, libMesh::PetscVector<double>& F, double tol, unsigned int max_its);
+
+        /*!
+         * Compute y = M x.
+         */
+        void apply(Vec x, Vec y);
+
+    private:
+        MatrixFreeL2ProjectionOperator(const MatrixFreeL2ProjectionOperator& from) = delete;
+        MatrixFreeL2ProjectionOperator& operator=(const MatrixFreeL2ProjectionOperator& that) = delete;
+
+        static PetscErrorCode matMult(Mat A, Vec x, Vec y);
+        static PetscErrorCode pcApply(PC pc, Vec x, Vec y);
+
+        /*
+         * Description of a stored element mass matrix: the (row-major) matrix
+         * starts at d_block_matrices[matrix_offset] and is applied to n_comps
+         * consecutive lists of n_dofs local dof indices starting at
+         * d_block_dofs[dof_offset].
+         */
+        struct Block
+        {
+            std::size_t matrix_offset;
+            std::size_t dof_offset;
+            unsigned int n_dofs;
+            unsigned int n_comps;
+        };
+        std::vector<Block> d_blocks;
+        std::vector<double> d_block_matrices;
+        std::vector<PetscInt> d_block_dofs;
+
+        /*
+         * Locally owned rows which correspond to Dirichlet boundary
+         * conditions, stored as offsets from the first locally owned row.
+         * These rows (and the corresponding columns) are replaced by the
+         * identity.
+         */
+        std::vector<PetscInt> d_dirichlet_rows;
+
+        /*
+         * Scatter from the global layout to the sequential vectors which
+         * contain every dof touched by a local element, and the per-element
+         * scratch space used when applying the operator.
+         */
+        VecScatter d_scatter = nullptr;
+        Vec d_x_local = nullptr, d_y_local = nullptr;
+        std::vector<double> d_x_e, d_y_e;
+
+        /*
+         * PETSc objects for the solver.
+         */
+        Mat d_mat = nullptr;
+        KSP d_ksp = nullptr;
+        Vec d_M_diag_inv = nullptr;
+    };
+
     /*!
      * Constructor. Registers the object with the restart database: i.e.,
      * inheriting classes should not also register themselves.
@@ -222,6 +331,15 @@ protected:
      */
     QuadratureCache d_quadrature_cache;
 
+    /*
+     * Cache of JacobianCalculator objects. The calculators store the JxW
+     * values of the elements on which they are evaluated (see
+     * JacobianCalculator::get_cached_JxW()) so that these values are computed
+     * only once between calls to clearCached(). Created once a
+     * libMesh::EquationSystems object is attached.
+     */
+    std::unique_ptr<JacobianCalculatorCache> d_jacobian_calculator_cache;
+
     /*!
      * Number of the level on which the equation systems live.
      */
@@ -239,6 +357,18 @@ protected:
     std::map<std::string, std::unique_ptr<libMesh::LinearSolver<double> > > d_L2_proj_solver;
     std::map<std::string, std::unique_ptr<libMesh::SparseMatrix<double> > > d_L2_proj_matrix;
     std::map<std::string, std::unique_ptr<libMesh::NumericVector<double> > > d_L2_proj_matrix_diag;
+    std::map<std::string, std::unique_ptr<MatrixFreeL2ProjectionOperator> > d_L2_proj_mf_operator;
+
+    /*
+     * Measured Lagrangian-Eulerian interaction costs, indexed by element id:
+     * the accumulated wall clock time spent spreading from and interpolating
+     * to each element and the accumulated number of quadrature points
+     * processed on it. These are stored here (and not in FEDataManager) so
+     * that costs measured with one patch hierarchy may be used to estimate
+     * workloads on another.
+     */
+    std::vector<double> d_elem_work_time;
+    std::vector<double> d_elem_work_q_points;
 
     /**
      * Permit FEDataManager to directly examine the internals of this class.
@@ -265,6 +395,16 @@ protected:
  * construction through the FEDataManager::WorkloadSpec object, which contains
  * reasonable defaults.
  *
+ * Since the cost of a quadrature point depends on the element type, the
+ * kernel, and the layout of the data in memory, the weight of each quadrature
+ * point may optionally be calibrated at run time: if
+ * FEDataManager::WorkloadSpec::use_measured_costs is <code>true</code> then
+ * the time spent in FEDataManager::spread() and
+ * FEDataManager::interpWeighted() is measured patch by patch and attributed to
+ * the elements on that patch. The weight of each quadrature point is then
+ * scaled by the measured cost per quadrature point of its element relative to
+ * the global average cost per quadrature point.
+ *
  * \note Multiple FEDataManager objects may be instantiated simultaneously.
  */
 class FEDataManager : public SAMRAI::tbox::Serializable
@@ -351,6 +491,18 @@ public:
     {
         /// The multiplier applied to each quadrature point.
         double q_point_weight = 1.0;
+
+        /// Whether or not the multiplier applied to each quadrature point
+        /// should be scaled by the measured cost, relative to the average over
+        /// all quadrature points, of spreading from and interpolating to the
+        /// element containing that point.
+        bool use_measured_costs = false;
+
+        /// The fraction of the accumulated measured costs retained by
+        /// FEDataManager::decayMeasuredCosts(), which should be called after
+        /// each regrid: <code>0</code> discards all previous measurements and
+        /// <code>1</code> retains them indefinitely.
+        double measured_cost_retention = 0.0;
     };
 
 protected:
@@ -483,6 +635,21 @@ public:
      */
     bool getLoggingEnabled() const;
 
+    /*!
+     * \brief Enable or disable the matrix-free solver for L2 projections
+     * with a consistent mass matrix. Defaults to <code>false</code>.
+     *
+     * @note This is usually set by the IBFEMethod which owns the current
+     * FEDataManager, which reads the relevant boolean from the database.
+     */
+    void setUseMatrixFreeL2Projection(bool use_matrix_free = true);
+
+    /*!
+     * \brief Determine whether or not the matrix-free L2 projection solver is
+     * used.
+     */
+    bool getUseMatrixFreeL2Projection() const;
+
     /*!
      * \brief Register a load balancer for non-uniform load balancing.
      *
@@ -563,9 +730,37 @@ public:
 
     /*!
      * \brief Reinitialize the mappings from elements to Cartesian grid patches.
+     *
+     * If setElementMappingDisplacementFraction() has been called with a
+     * positive value and the local patches have not changed since the last
+     * call to this function then only the elements which have moved far
+     * enough are reassigned to patches: see
+     * setElementMappingDisplacementFraction() for more information.
      */
     void reinitElementMappings();
 
+    /*!
+     * \brief Set the fraction of the ghost cell width by which an element may
+     * move before it must be reassigned to patches.
+     *
+     * When this value is positive, each element is associated with the
+     * patches intersected by its bounding box grown by this fraction of the
+     * ghost cell width. Since that association remains valid until the
+     * element moves outside of the grown bounding box, reinitElementMappings()
+     * only needs to reassign the elements which have done so, provided the
+     * local patches are unchanged. Larger values permit more motion between
+     * reassignments at the cost of associating more elements with each
+     * patch. Defaults to <code>0.0</code>, i.e., the mappings are always
+     * recomputed from scratch.
+     */
+    void setElementMappingDisplacementFraction(double fraction);
+
+    /*!
+     * \brief Get the fraction of the ghost cell width by which an element may
+     * move before it must be reassigned to patches.
+     */
+    double getElementMappingDisplacementFraction() const;
+
     /*!
      * \return A pointer to the unghosted solution vector associated with the
      * specified system.
@@ -781,8 +976,19 @@ public:
      */
     libMesh::NumericVector<double>* buildDiagonalL2MassMatrix(const std::string& system_name);
 
+    /*!
+     * \return Pointer to a matrix-free representation of the L2 projection
+     * operator.
+     */
+    FEData::MatrixFreeL2ProjectionOperator* buildMatrixFreeL2ProjectionOperator(const std::string& system_name);
+
     /*!
      * \brief Set U to be the L2 projection of F.
+     *
+     * If a consistent mass matrix is requested then the linear system is
+     * solved either with an assembled sparse matrix or, if
+     * setUseMatrixFreeL2Projection() has been called, with
+     * FEData::MatrixFreeL2ProjectionOperator.
      */
     bool computeL2Projection(libMesh::NumericVector<double>& U,
                              libMesh::NumericVector<double>& F,
@@ -850,6 +1056,32 @@ public:
                              const int coarsest_ln = -1,
                              const int finest_ln = -1);
 
+    /*!
+     * \brief Scale the accumulated measured interaction costs by
+     * WorkloadSpec::measured_cost_retention so that, as the structure moves,
+     * the workload estimate is determined by recent measurements.
+     *
+     * \note The measured costs are stored in the FEData object, so this
+     * function should be called once per regrid for each FEData object (and
+     * not once for each FEDataManager sharing it).
+     */
+    void decayMeasuredCosts();
+
+    /*!
+     * \brief Get the accumulated wall clock time spent on this processor
+     * spreading from and interpolating to each element, indexed by element id
+     * (see WorkloadSpec::use_measured_costs). The vector is empty if no costs
+     * have been measured.
+     */
+    const std::vector<double>& getMeasuredElementTimes() const;
+
+    /*!
+     * \brief Get the accumulated number of quadrature points processed on
+     * this processor on each element, indexed by element id (see
+     * FEDataManager::getMeasuredElementTimes()).
+     */
+    const std::vector<double>& getMeasuredElementQuadPointCounts() const;
+
     /*!
      * Set integer tags to "one" in cells where refinement of the given level
      * should occur due to the presence of Lagrangian data.  The double time
@@ -948,8 +1180,22 @@ private:
      * Compute the quadrature point counts in each cell of the level in which
      * the FE mesh is embedded.  Also zeros out node count data for other levels
      * within the specified range of level numbers.
+     *
+     * If <code>use_measured_costs</code> is <code>true</code> then each
+     * quadrature point is weighted by the measured cost per quadrature point
+     * of its element relative to the global average (see
+     * FEDataManager::recordMeasuredCosts()).
      */
-    void updateQuadPointCountData(int coarsest_ln, int finest_ln);
+    void updateQuadPointCountData(int coarsest_ln, int finest_ln, bool use_measured_costs = false);
+
+    /*!
+     * Attribute the wall clock time <code>elapsed_time</code> spent on one
+     * patch to the elements of that patch in proportion to their number of
+     * quadrature points.
+     */
+    void recordMeasuredCosts(const std::vector<libMesh::Elem*>& patch_elems,
+                             const std::vector<QuadratureCache::key_type>& quad_keys,
+                             double elapsed_time);
 
     /*!
      * Compute the bounding boxes of all active elements.
@@ -973,6 +1219,37 @@ private:
                                     int level_number,
                                     const SAMRAI::hier::IntVector<NDIM>& ghost_width);
 
+    /*!
+     * Update the mappings computed by collectActivePatchElements() and
+     * collectActivePatchNodes() by reassigning only those elements which have
+     * moved outside of the bounding boxes used to associate them with patches.
+     * Only the bounding boxes of those elements are communicated between
+     * processes.
+     *
+     * \return false, without modifying the mappings, if the local patches
+     * have changed since the mappings were computed.
+     */
+    bool updateActivePatchElementsAndNodes(std::vector<std::vector<libMesh::Elem*> >& active_patch_elems,
+                                           std::vector<std::vector<libMesh::Node*> >& active_patch_nodes,
+                                           int level_number,
+                                           const SAMRAI::hier::IntVector<NDIM>& ghost_width);
+
+    /*!
+     * Compute the bounding boxes of the local active elements used to
+     * associate elements with patches on the given level, in the order of
+     * MeshBase::active_local_elements_begin().
+     */
+    std::vector<libMeshWrappers::BoundingBox> computeLocalActiveElementBoundingBoxes(int level_number);
+
+    /*!
+     * Grow the provided element bounding boxes by the displacement permitted
+     * between calls to reinitElementMappings(): see
+     * setElementMappingDisplacementFraction().
+     */
+    void growElementBoundingBoxes(std::vector<libMeshWrappers::BoundingBox>& bboxes,
+                                  int level_number,
+                                  const SAMRAI::hier::IntVector<NDIM>& ghost_width) const;
+
     /*!
      * Collect all of the nodes of the active elements that are located within a
      * local Cartesian grid patch grown by the specified ghost cell width.
@@ -1028,6 +1305,13 @@ private:
      */
     bool d_enable_logging = false;
 
+    /*
+     * Whether or not L2 projections with a consistent mass matrix are solved
+     * without assembling the mass matrix: see
+     * FEDataManager::setUseMatrixFreeL2Projection().
+     */
+    bool d_use_matrix_free_L2_projection = false;
+
     /*
      * We cache a pointer to the load balancer.
      *
@@ -1104,6 +1388,18 @@ private:
     std::map<std::string, std::vector<unsigned int> > d_active_patch_ghost_dofs;
     std::vector<std::pair<Point, Point> > d_active_elem_bboxes;
 
+    /*
+     * Data used to update the mappings between mesh elements and grid patches
+     * incrementally: the fraction of the ghost cell width by which elements
+     * may move, the bounding boxes (indexed by element id) used to associate
+     * elements with patches, and the level number and local patch boxes for
+     * which that association was computed.
+     */
+    double d_elem_mapping_displacement_fraction = 0.0;
+    std::vector<libMeshWrappers::BoundingBox> d_associated_elem_bboxes;
+    int d_associated_level_number = IBTK::invalid_level_number;
+    std::vector<SAMRAI::hier::Box<NDIM> > d_associated_patch_boxes;
+
     /*
      * Ghost vectors for the various equation systems.
      */
@@ -17,6 +17,7 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include "ibtk/CoarseFineBoundaryRefinePatchStrategy.h"
+#include "ibtk/PatchHierarchyFingerprint.h"
 #include "ibtk/ibtk_utilities.h"
 
 #include "BoxGeometryFillPattern.h"
@@ -318,6 +319,11 @@ public:
 
     /*!
      * \brief Reinitialize operator state following, e.g., a regridding operation.
+     *
+     * When the operator was initialized on all levels of the same patch
+     * hierarchy, the cached communication schedules are reused for levels whose
+     * configuration has not changed (as determined by a
+     * PatchHierarchyFingerprint), and only the remaining schedules are rebuilt.
      */
     void reinitializeOperatorState(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy);
 
@@ -369,6 +375,9 @@ private:
     SAMRAI::tbox::Pointer<SAMRAI::geom::CartesianGridGeometry<NDIM> > d_grid_geom;
     int d_coarsest_ln = IBTK::invalid_level_number, d_finest_ln = IBTK::invalid_level_number;
 
+    // Configuration of the levels for which the cached schedules were built.
+    PatchHierarchyFingerprint d_hierarchy_fingerprint;
+
     // Cached communications algorithms and schedules.
     SAMRAI::tbox::Pointer<SAMRAI::xfer::CoarsenAlgorithm<NDIM> > d_coarsen_alg;
     std::unique_ptr<SAMRAI::xfer::CoarsenPatchStrategy<NDIM> > d_coarsen_strategy;
@@ -18,6 +18,7 @@
 
 #include "ibtk/CartGridFunction.h"
 #include "ibtk/HierarchyMathOps.h"
+#include "ibtk/TelemetryLog.h"
 #include "ibtk/ibtk_enums.h"
 
 #include "BasePatchHierarchy.h"
@@ -44,6 +45,7 @@
 #include <limits>
 #include <list>
 #include <map>
+#include <memory>
 #include <ostream>
 #include <set>
 #include <string>
@@ -368,6 +370,45 @@ public:
      */
     void setupPlotData();
 
+    ///
+    ///  Routines to record per-time step performance telemetry.
+    ///
+
+    /*!
+     * Return the telemetry log used to record per-time step performance data,
+     * or nullptr if telemetry is not enabled.
+     *
+     * Telemetry is enabled by setting the input database entry
+     * <code>enable_telemetry</code> of the top-level (parent) integrator, and
+     * all child integrators record their data in the log of the top-level
+     * integrator.  The output files are named using the input database entry
+     * <code>telemetry_file_name</code>.  If the input database entry
+     * <code>enable_telemetry_summary</code> is <code>true</code>, the minimum,
+     * mean, and maximum of each recorded quantity over all processes are also
+     * written.
+     *
+     * \see TelemetryLog
+     */
+    TelemetryLog* getTelemetryLog() const;
+
+    /*!
+     * Start timing the named phase of the present time step.  This function
+     * does nothing if telemetry is not enabled.
+     */
+    void startTelemetryPhase(const std::string& name) const;
+
+    /*!
+     * Stop timing the named phase of the present time step.  This function does
+     * nothing if telemetry is not enabled.
+     */
+    void stopTelemetryPhase(const std::string& name) const;
+
+    /*!
+     * Record a value (e.g., a number of solver iterations) for the present time
+     * step.  This function does nothing if telemetry is not enabled.
+     */
+    void recordTelemetryValue(const std::string& name, double value) const;
+
     ///
     ///  Routines to implement the time integration scheme.
     ///
@@ -1062,6 +1103,14 @@ protected:
      */
     bool d_enable_logging_solver_iterations = false;
 
+    /*
+     * Per-time step performance telemetry.  The telemetry log is only created
+     * by the top-level integrator.
+     */
+    bool d_enable_telemetry = false, d_enable_telemetry_summary = false;
+    std::string d_telemetry_file_name;
+    std::unique_ptr<TelemetryLog> d_telemetry;
+
     /*
      * The type of extrapolation to use at physical boundaries when prolonging
      * data during regridding.
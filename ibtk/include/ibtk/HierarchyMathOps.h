@@ -16,6 +16,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include "ibtk/PatchHierarchyFingerprint.h"
 #include "ibtk/PatchMathOps.h"
 #include "ibtk/SAMRAIDataCache.h"
 #include "ibtk/ibtk_enums.h"
@@ -114,6 +115,10 @@ public:
      *
      * The specified levels must exist in the hierarchy or an assertion will
      * result.
+     *
+     * Cached communication schedules and weights are reused for levels whose
+     * configuration (and that of the neighboring levels on which they depend)
+     * has not changed since the last call to this function.
      */
     void resetLevels(int coarsest_ln, int finest_ln);
 
@@ -1427,6 +1432,10 @@ private:
     SAMRAI::tbox::Pointer<SAMRAI::geom::CartesianGridGeometry<NDIM> > d_grid_geom;
     int d_coarsest_ln, d_finest_ln;
 
+    // Configuration of the levels for which the cached schedules and weights
+    // were computed.
+    PatchHierarchyFingerprint d_hierarchy_fingerprint;
+
     // Scratch Variables.
     SAMRAIDataCache d_cached_eulerian_data;
     SAMRAI::tbox::Pointer<SAMRAI::pdat::FaceVariable<NDIM, double> > d_fc_var;
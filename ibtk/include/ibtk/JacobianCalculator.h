@@ -24,6 +24,7 @@
 #include <libmesh/enum_order.h>
 #include <libmesh/enum_quadrature_type.h>
 #include <libmesh/fe.h>
+#include <libmesh/id_types.h>
 #include <libmesh/point.h>
 
 IBTK_DISABLE_EXTRA_WARNINGS
@@ -32,6 +33,7 @@ IBTK_ENABLE_EXTRA_WARNINGS
 
 #include <array>
 #include <tuple>
+#include <unordered_map>
 #include <vector>
 
 namespace IBTK
@@ -56,6 +58,21 @@ public:
      */
     virtual const std::vector<double>& get_JxW(const libMesh::Elem* elem) = 0;
 
+    /**
+     * Same as get_JxW(), but the values computed on each element are stored
+     * and reused by subsequent calls with the same element. Since JxW values
+     * are computed in the reference configuration this is valid as long as
+     * the reference configuration of the mesh does not change: since
+     * FEData::clearCached() (called by FEDataManager::reinitElementMappings()
+     * after each regrid) destroys all calculators it owns, the stored values
+     * never outlive a reinitialization of the mesh data.
+     *
+     * The default implementation stores all JxW values of each
+     * element. Calculators for affine elements, for which computing the JxW
+     * values is cheaper than looking them up, do not store anything.
+     */
+    virtual const std::vector<double>& get_cached_JxW(const libMesh::Elem* elem);
+
     virtual ~JacobianCalculator() = default;
 
 protected:
@@ -65,6 +82,11 @@ protected:
     std::vector<double> d_quad_weights;
 
     std::vector<double> d_JxW;
+
+    /**
+     * JxW values stored by get_cached_JxW(), indexed by element id.
+     */
+    std::unordered_map<libMesh::dof_id_type, std::vector<double> > d_cached_JxW;
 };
 
 /*
@@ -115,6 +137,12 @@ public:
     using JacobianCalculator::JacobianCalculator;
 
     virtual const std::vector<double>& get_JxW(const libMesh::Elem* elem) override;
+
+    /**
+     * The mapping is affine, so the JxW values are cheaper to compute than to
+     * look up: this function does not store anything.
+     */
+    virtual const std::vector<double>& get_cached_JxW(const libMesh::Elem* elem) override;
 };
 
 /*
@@ -184,6 +212,42 @@ public:
     using JacobianCalculator::JacobianCalculator;
 
     virtual const std::vector<double>& get_JxW(const libMesh::Elem* elem) override;
+
+    /**
+     * The mapping is affine, so the JxW values are cheaper to compute than to
+     * look up: this function does not store anything.
+     */
+    virtual const std::vector<double>& get_cached_JxW(const libMesh::Elem* elem) override;
+};
+
+/*
+ * Specialization for HEX8 elements. The reference gradients of the eight
+ * trilinear shape functions are tabulated at the quadrature points so that
+ * all loops computing the Jacobian have fixed lengths.
+ */
+class Hex8JacobianCalculator : public JacobianCalculator
+{
+public:
+    /**
+     * Key type. Completely describes (excepting p-refinement) a libMesh
+     * quadrature rule.
+     */
+    using key_type = std::tuple<libMesh::ElemType, libMesh::QuadratureType, libMesh::Order>;
+
+    /**
+     * Constructor.
+     */
+    Hex8JacobianCalculator(const key_type quad_key);
+
+    virtual const std::vector<double>& get_JxW(const libMesh::Elem* elem) override;
+
+protected:
+    /**
+     * Values of shape function gradients on the reference element at
+     * quadrature points, stored so that the innermost index is the node
+     * number.
+     */
+    std::vector<std::array<std::array<double, 8>, 3> > d_dphi;
 };
 } // namespace IBTK
 
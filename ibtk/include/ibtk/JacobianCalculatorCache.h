@@ -156,6 +156,8 @@ inline JacobianCalculatorCache::value_type&
                 jac_calc.reset(new LagrangeJacobianCalculator<2, 3>(quad_key));
             else if (elem_type == libMesh::TET4)
                 jac_calc.reset(new Tet4JacobianCalculator(quad_key));
+            else if (elem_type == libMesh::HEX8)
+                jac_calc.reset(new Hex8JacobianCalculator(quad_key));
             else
                 jac_calc.reset(new LagrangeJacobianCalculator<3, 3>(quad_key));
             break;
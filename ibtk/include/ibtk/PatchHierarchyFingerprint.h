@@ -0,0 +1,104 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2019 - 2019 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+#ifndef included_IBTK_PatchHierarchyFingerprint
+#define included_IBTK_PatchHierarchyFingerprint
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/ibtk_utilities.h"
+
+#include "PatchHierarchy.h"
+#include "PatchLevel.h"
+#include "tbox/Pointer.h"
+
+#include <vector>
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class PatchHierarchyFingerprint records the configuration of each
+ * level of a patch hierarchy, so that objects that cache level-dependent data
+ * (e.g., communication schedules or weights) can determine which levels have
+ * been modified by a regridding operation and rebuild only the corresponding
+ * data.
+ *
+ * The fingerprint of a level consists of the level object itself along with its
+ * refinement ratio, the boxes of its patches, and the assignment of those
+ * patches to processes.  A level is considered to be unchanged only if all of
+ * these are the same.  Because this information is replicated on all
+ * processes, the member functions of this class need not be called
+ * collectively.
+ *
+ * \note A fingerprint holds references to the recorded patch levels, so that
+ * the addresses of those levels cannot be reused before the fingerprint is
+ * updated or cleared.
+ */
+class PatchHierarchyFingerprint
+{
+public:
+    /*!
+     * \brief Default constructor.
+     */
+    PatchHierarchyFingerprint() = default;
+
+    /*!
+     * \brief Record the configuration of all levels of the patch hierarchy.
+     */
+    void update(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy);
+
+    /*!
+     * \brief Discard the recorded configuration.  After calling this function,
+     * all levels are considered to have changed.
+     */
+    void clear();
+
+    /*!
+     * \brief Return the finest level number of the recorded configuration, or
+     * IBTK::invalid_level_number if no configuration has been recorded.
+     */
+    int getFinestLevelNumber() const;
+
+    /*!
+     * \brief Determine whether level \em ln of the patch hierarchy has the same
+     * configuration as when update() was last called.
+     */
+    bool levelIsUnchanged(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy, int ln) const;
+
+    /*!
+     * \brief Determine whether levels \em coarsest_ln through \em finest_ln of
+     * the patch hierarchy all have the same configuration as when update() was
+     * last called.
+     */
+    bool levelsAreUnchanged(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                            int coarsest_ln,
+                            int finest_ln) const;
+
+private:
+    /*!
+     * \brief Compute the layout (refinement ratio, patch boxes, and processor
+     * mapping) of a patch level.
+     */
+    static std::vector<int> computeLevelLayout(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > level);
+
+    // The recorded patch levels and their layouts.
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > > d_levels;
+    std::vector<std::vector<int> > d_level_layouts;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_PatchHierarchyFingerprint
@@ -0,0 +1,155 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2019 - 2019 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+#ifndef included_IBTK_ScratchPatchDataPool
+#define included_IBTK_ScratchPatchDataPool
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "Box.h"
+#include "IntVector.h"
+#include "tbox/Pointer.h"
+#include "tbox/Utilities.h"
+
+#include <array>
+#include <map>
+#include <tuple>
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class ScratchPatchDataPool is a utility class for reusing temporary
+ * patch data objects (e.g., pdat::FaceData or pdat::SideData) that are only
+ * needed while a single patch is being processed.
+ *
+ * Data are keyed by the shape of the requested box (its extents but not its
+ * location), the data depth, the ghost cell width, and a caller-provided slot
+ * number, and are allocated on the box translated so that its lower corner is
+ * the origin. Consequently, all patches of the same size share the same storage,
+ * and the data must be accessed either through raw pointers together with the
+ * index bounds of the requested box, or with indices shifted by
+ * <code>box.lower()</code>. Distinct slot numbers yield distinct data objects for
+ * boxes of the same shape.
+ *
+ * Cached data should be released via clear() whenever the patch hierarchy
+ * configuration changes.
+ *
+ * When reuse is disabled via setReuseData(), each call to getScratchData()
+ * returns newly allocated data defined on the same origin-shifted box.  This is
+ * mainly useful to check that the results of a computation do not depend on
+ * values left over in the reused data.
+ */
+template <class DataType>
+class ScratchPatchDataPool
+{
+public:
+    /*!
+     * \brief Default constructor.
+     */
+    ScratchPatchDataPool() = default;
+
+    /*!
+     * \brief Set whether data are cached and reused by subsequent calls to
+     * getScratchData().  Data are reused by default.
+     */
+    void setReuseData(const bool reuse_data)
+    {
+        d_reuse_data = reuse_data;
+        if (!d_reuse_data) clear();
+        return;
+    } // setReuseData
+
+    /*!
+     * \brief Get scratch data with the same shape as the box \em box.
+     */
+    SAMRAI::tbox::Pointer<DataType> getScratchData(const SAMRAI::hier::Box<NDIM>& box,
+                                                   const int depth,
+                                                   const SAMRAI::hier::IntVector<NDIM>& ghosts,
+                                                   const int slot = 0)
+    {
+        key_type key;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            std::get<0>(key)[d] = box.numberCells(d);
+            std::get<2>(key)[d] = ghosts(d);
+        }
+        std::get<1>(key) = depth;
+        std::get<3>(key) = slot;
+
+        const SAMRAI::hier::IntVector<NDIM> shift = box.lower();
+        SAMRAI::hier::Box<NDIM> shifted_box = box;
+        shifted_box.shift(-shift);
+        if (!d_reuse_data) return new DataType(shifted_box, depth, ghosts);
+
+        SAMRAI::tbox::Pointer<DataType>& data = d_data[key];
+        if (!data) data = new DataType(shifted_box, depth, ghosts);
+#if !defined(NDEBUG)
+        TBOX_ASSERT(data->getBox() == shifted_box);
+        TBOX_ASSERT(data->getDepth() == depth);
+        TBOX_ASSERT(data->getGhostCellWidth() == ghosts);
+#endif
+        return data;
+    } // getScratchData
+
+    /*!
+     * \brief Release all cached data.
+     */
+    void clear()
+    {
+        d_data.clear();
+        return;
+    } // clear
+
+private:
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    ScratchPatchDataPool(const ScratchPatchDataPool& from) = delete;
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    ScratchPatchDataPool& operator=(const ScratchPatchDataPool& that) = delete;
+
+    /*!
+     * \brief Key type: box extents, depth, ghost cell width, and slot number.
+     */
+    using key_type = std::tuple<std::array<int, NDIM>, int, std::array<int, NDIM>, int>;
+
+    /*!
+     * \brief The cached data.
+     */
+    std::map<key_type, SAMRAI::tbox::Pointer<DataType> > d_data;
+
+    /*!
+     * \brief Whether data are cached and reused.
+     */
+    bool d_reuse_data = true;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_ScratchPatchDataPool
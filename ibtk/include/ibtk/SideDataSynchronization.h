@@ -16,6 +16,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include "ibtk/PatchHierarchyFingerprint.h"
 #include "ibtk/ibtk_utilities.h"
 
 #include "CartesianGridGeometry.h"
@@ -150,6 +151,15 @@ public:
      */
     void resetTransactionComponents(const std::vector<SynchronizationTransactionComponent>& transaction_comps);
 
+    /*!
+     * \brief Reinitialize operator state following, e.g., a regridding operation.
+     *
+     * The cached communication schedules are reused for levels whose
+     * configuration has not changed, and only the remaining schedules are
+     * rebuilt.
+     */
+    void reinitializeOperatorState(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy);
+
     /*!
      * \brief Clear all cached data.
      */
@@ -193,6 +203,9 @@ private:
     SAMRAI::tbox::Pointer<SAMRAI::geom::CartesianGridGeometry<NDIM> > d_grid_geom;
     int d_coarsest_ln = IBTK::invalid_level_number, d_finest_ln = IBTK::invalid_level_number;
 
+    // Configuration of the levels for which the cached schedules were built.
+    PatchHierarchyFingerprint d_hierarchy_fingerprint;
+
     // Cached communications algorithms and schedules.
     SAMRAI::tbox::Pointer<SAMRAI::xfer::CoarsenAlgorithm<NDIM> > d_coarsen_alg;
     std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::CoarsenSchedule<NDIM> > > d_coarsen_scheds;
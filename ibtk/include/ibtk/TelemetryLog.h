@@ -0,0 +1,157 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2019 - 2019 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+#ifndef included_IBTK_TelemetryLog
+#define included_IBTK_TelemetryLog
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class TelemetryLog records lightweight per-time step performance data
+ * (the wall clock times of named phases and the values of named counters) and
+ * writes them to a CSV file on each process.
+ *
+ * Each record corresponds to a single time step, and data are written in "long"
+ * format, with one line per recorded quantity:
+ *
+ * \verbatim
+ step,time,dt,quantity,value
+ \endverbatim
+ *
+ * The data for process \em p are written to the file
+ * <code>file_name.p.csv</code>.  Phase times are reported in seconds under the
+ * name of the phase.  Repeated measurements of the same phase, or repeated
+ * values of the same counter, within a single record are summed.
+ *
+ * When a summary is requested, the minimum, mean, and maximum of each quantity
+ * over all processes are computed at the end of each record and are written by
+ * process 0 to the file <code>file_name.summary.csv</code>.  In this case, all
+ * processes must record the same quantities in the same order, i.e., the
+ * member functions of this class must be called collectively.  This is checked
+ * at the end of each record by comparing a hash of the names of the recorded
+ * quantities across all processes, and an unrecoverable error occurs if the
+ * names differ.
+ */
+class TelemetryLog
+{
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param file_name Base name of the output files.
+     * \param write_summary Whether to compute and write cross-process summaries.
+     * \param append Whether to append to existing files (e.g., when restarting).
+     */
+    TelemetryLog(const std::string& file_name, bool write_summary = false, bool append = false);
+
+    /*!
+     * \brief Destructor.
+     */
+    ~TelemetryLog();
+
+    /*!
+     * \brief Begin a new record.
+     */
+    void beginRecord(int step, double time, double dt);
+
+    /*!
+     * \brief Finish the current record and write it out.
+     */
+    void endRecord();
+
+    /*!
+     * \brief Whether a record is currently open.
+     */
+    bool isRecording() const;
+
+    /*!
+     * \brief Start timing the phase \em name.
+     */
+    void startPhase(const std::string& name);
+
+    /*!
+     * \brief Stop timing the phase \em name and add the elapsed time to the
+     * current record.
+     */
+    void stopPhase(const std::string& name);
+
+    /*!
+     * \brief Add \em value to the quantity \em name in the current record.
+     */
+    void addValue(const std::string& name, double value);
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    TelemetryLog() = delete;
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    TelemetryLog(const TelemetryLog& from) = delete;
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    TelemetryLog& operator=(const TelemetryLog& that) = delete;
+
+    /*!
+     * \brief Write the cross-process summary of the current record.
+     */
+    void writeSummary();
+
+    /*
+     * Output streams.
+     */
+    std::ofstream d_stream, d_summary_stream;
+    bool d_write_summary;
+
+    /*
+     * Data for the current record.  Quantities are stored in the order in
+     * which they are first recorded.
+     */
+    bool d_recording = false;
+    int d_step = -1;
+    double d_time = 0.0, d_dt = 0.0;
+    std::vector<std::pair<std::string, double> > d_values;
+    std::map<std::string, std::chrono::steady_clock::time_point> d_phase_start_times;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_TelemetryLog
@@ -53,6 +53,10 @@ namespace IBTK
  * class CartGridFunction that allows for the run-time specification of
  * (possibly spatially- and temporally-varying) functions which are used to set
  * double precision values on standard SAMRAI SAMRAI::hier::PatchData objects.
+ *
+ * The functions are treated as time-dependent unless the optional boolean
+ * input key <code>is_time_dependent</code> is set to <code>FALSE</code>, in
+ * which case the functions may not use the time variable.
  */
 class muParserCartGridFunction : public CartGridFunction
 {
@@ -144,6 +148,11 @@ private:
      */
     std::vector<mu::Parser> d_parsers;
 
+    /*!
+     * Whether the functions depend on time.
+     */
+    bool d_is_time_dependent = true;
+
     /*!
      * Time and position variables.
      */
@@ -332,6 +332,9 @@ HierarchyGhostCellInterpolation::initializeOperatorState(
     // Setup physical BC type.
     setHomogeneousBc(d_homogeneous_bc);
 
+    // Record the configuration of the hierarchy.
+    d_hierarchy_fingerprint.update(d_hierarchy);
+
     // Indicate the operator is initialized.
     d_is_initialized = true;
 
@@ -524,7 +527,66 @@ HierarchyGhostCellInterpolation::reinitializeOperatorState(Pointer<PatchHierarch
 
     IBTK_TIMER_START(t_reinitialize_operator_state);
 
-    initializeOperatorState(d_transaction_comps, hierarchy);
+    // Rebuild everything unless the operator was set up on all levels of the
+    // same patch hierarchy.
+    if (hierarchy.getPointer() != d_hierarchy.getPointer() || d_coarsest_ln != 0 ||
+        d_finest_ln != d_hierarchy_fingerprint.getFinestLevelNumber())
+    {
+        initializeOperatorState(d_transaction_comps, hierarchy);
+        IBTK_TIMER_STOP(t_reinitialize_operator_state);
+        return;
+    }
+
+    // Coarse-fine boundary data must be recomputed whenever any level changes.
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    if (!d_hierarchy_fingerprint.levelsAreUnchanged(d_hierarchy, 0, finest_ln) ||
+        finest_ln != d_hierarchy_fingerprint.getFinestLevelNumber())
+    {
+        for (const auto& cf_bdry_op : d_cf_bdry_ops)
+        {
+            if (cf_bdry_op) cf_bdry_op->setPatchHierarchy(d_hierarchy);
+        }
+    }
+
+    // Rebuild the coarsen schedules that involve levels that have changed.
+    // Coarsening from level ln to level ln - 1 only depends on those two
+    // levels.
+    bool registered_coarsen_op = false;
+    for (const auto& transaction_comp : d_transaction_comps)
+    {
+        if (transaction_comp.d_coarsen_op_name != "NONE") registered_coarsen_op = true;
+    }
+    d_finest_ln = finest_ln;
+    d_coarsen_scheds.resize(d_finest_ln + 1);
+    if (registered_coarsen_op)
+    {
+        for (int src_ln = 1; src_ln <= d_finest_ln; ++src_ln)
+        {
+            if (d_coarsen_scheds[src_ln] && d_hierarchy_fingerprint.levelsAreUnchanged(d_hierarchy, src_ln - 1, src_ln))
+            {
+                continue;
+            }
+            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(src_ln);
+            Pointer<PatchLevel<NDIM> > coarser_level = d_hierarchy->getPatchLevel(src_ln - 1);
+            d_coarsen_scheds[src_ln] = d_coarsen_alg->createSchedule(coarser_level, level, d_coarsen_strategy.get());
+        }
+    }
+
+    // Rebuild the refine schedules that involve levels that have changed.
+    // Filling level ln may require data from any coarser level.
+    d_refine_scheds.resize(d_finest_ln + 1);
+    for (int dst_ln = 0; dst_ln <= d_finest_ln; ++dst_ln)
+    {
+        if (d_refine_scheds[dst_ln] && d_hierarchy_fingerprint.levelsAreUnchanged(d_hierarchy, 0, dst_ln))
+        {
+            continue;
+        }
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(dst_ln);
+        d_refine_scheds[dst_ln] = d_refine_alg->createSchedule(level, dst_ln - 1, d_hierarchy, d_refine_strategy.get());
+    }
+
+    // Record the new configuration of the hierarchy.
+    d_hierarchy_fingerprint.update(d_hierarchy);
 
     IBTK_TIMER_STOP(t_reinitialize_operator_state);
     return;
@@ -552,6 +614,8 @@ HierarchyGhostCellInterpolation::deallocateOperatorState()
     d_refine_strategy = nullptr;
     d_refine_scheds.clear();
 
+    d_hierarchy_fingerprint.clear();
+
     // Indicate that the operator is NOT initialized.
     d_is_initialized = false;
 
@@ -116,6 +116,7 @@ IBTK_ENABLE_EXTRA_WARNINGS
 #include <limits>
 #include <map>
 #include <memory>
+#include <numeric>
 #include <ostream>
 #include <set>
 #include <string>
@@ -154,6 +155,7 @@ static Timer* t_interp_weighted;
 static Timer* t_restrict_data;
 static Timer* t_build_l2_projection_solver;
 static Timer* t_build_diagonal_l2_mass_matrix;
+static Timer* t_build_matrix_free_l2_projection_operator;
 static Timer* t_compute_l2_projection;
 static Timer* t_update_workload_estimates;
 static Timer* t_initialize_level_data;
@@ -186,6 +188,55 @@ collect_unique_elems(std::vector<Elem*>& elems, const ContainerOfContainers& ele
     return;
 } // collect_unique_elems
 
+inline libMeshWrappers::BoundingBox
+get_patch_bbox(const Patch<NDIM>& patch, const IntVector<NDIM>& ghost_width)
+{
+    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch.getPatchGeometry();
+    const double* const dx = pgeom->getDx();
+    libMeshWrappers::BoundingBox patch_bbox;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        patch_bbox.first(d) = pgeom->getXLower()[d] - dx[d] * ghost_width[d];
+        patch_bbox.second(d) = pgeom->getXUpper()[d] + dx[d] * ghost_width[d];
+    }
+    for (unsigned int d = NDIM; d < LIBMESH_DIM; ++d)
+    {
+        patch_bbox.first(d) = 0.0;
+        patch_bbox.second(d) = 0.0;
+    }
+    return patch_bbox;
+} // get_patch_bbox
+
+inline bool
+bboxes_intersect(const libMeshWrappers::BoundingBox& a, const libMeshWrappers::BoundingBox& b)
+{
+#if LIBMESH_VERSION_LESS_THAN(1, 2, 0)
+    return a.intersect(b);
+#else
+    return a.intersects(b);
+#endif
+} // bboxes_intersect
+
+inline void
+collect_patch_nodes(std::vector<Node*>& patch_nodes, const std::vector<Elem*>& patch_elems, const MeshBase& mesh)
+{
+    std::set<dof_id_type> active_node_ids;
+    for (const auto& elem : patch_elems)
+    {
+        for (unsigned int n = 0; n < elem->n_nodes(); ++n)
+        {
+            active_node_ids.insert(elem->node_id(n));
+        }
+    }
+    patch_nodes.clear();
+    patch_nodes.reserve(active_node_ids.size());
+    for (const auto& active_node_id : active_node_ids)
+    {
+        patch_nodes.push_back(const_cast<Node*>(mesh.node_ptr(active_node_id)));
+    }
+    return;
+} // collect_patch_nodes
+
 inline boundary_id_type
 get_dirichlet_bdry_ids(const std::vector<boundary_id_type>& bdry_ids)
 {
@@ -266,6 +317,7 @@ FEData::setEquationSystems(EquationSystems* const equation_systems, const int le
     // Now that we have the EquationSystems object we know the dimensionality
     // of the mesh.
     d_quadrature_cache = QuadratureCache(d_es->get_mesh().mesh_dimension());
+    d_jacobian_calculator_cache.reset(new JacobianCalculatorCache(d_es->get_mesh().spatial_dimension()));
     return;
 } // setEquationSystems
 
@@ -298,11 +350,412 @@ FEData::clearCached()
 {
     d_system_dof_map_cache.clear();
     d_quadrature_cache.clear();
+    if (d_jacobian_calculator_cache) d_jacobian_calculator_cache->clear();
     d_L2_proj_solver.clear();
     d_L2_proj_matrix.clear();
     d_L2_proj_matrix_diag.clear();
+    d_L2_proj_mf_operator.clear();
 }
 
+FEData::MatrixFreeL2ProjectionOperator::MatrixFreeL2ProjectionOperator(System& system,
+                                                                       SystemDofMapCache& dof_map_cache,
+                                                                       PetscVector<double>& M_diag)
+{
+    int ierr;
+
+    // Extract the mesh.
+    const MeshBase& mesh = system.get_mesh();
+    const unsigned int dim = mesh.mesh_dimension();
+
+    // Extract the FE system and DOF map, and setup the FE object.
+    const int sys_num = system.number();
+    const DofMap& dof_map = system.get_dof_map();
+    const unsigned int n_vars = dof_map.n_variables();
+    FEType fe_type = dof_map.variable_type(0);
+    std::unique_ptr<QBase> qrule = fe_type.default_quadrature_rule(dim);
+    std::unique_ptr<FEBase> fe(FEBase::build(dim, fe_type));
+    fe->attach_quadrature_rule(qrule.get());
+    const std::vector<double>& JxW = fe->get_JxW();
+    const std::vector<std::vector<double> >& phi = fe->get_phi();
+
+    // Loop over the mesh to compute and store the element mass matrices. The
+    // blocks refer to global dof indices until all of them are known.
+    std::vector<dof_id_type> block_global_dofs;
+    const auto add_block = [&](const DenseMatrix<double>& M_e,
+                               const std::vector<const std::vector<dof_id_type>*>& dofs) {
+        const unsigned int n_dofs = M_e.m();
+        d_blocks.push_back({ d_block_matrices.size(),
+                             block_global_dofs.size(),
+                             n_dofs,
+                             static_cast<unsigned int>(dofs.size()) });
+        for (unsigned int i = 0; i < n_dofs; ++i)
+        {
+            for (unsigned int j = 0; j < n_dofs; ++j)
+            {
+                d_block_matrices.push_back(M_e(i, j));
+            }
+        }
+        for (const auto comp_dofs : dofs)
+        {
+            block_global_dofs.insert(block_global_dofs.end(), comp_dofs->begin(), comp_dofs->end());
+        }
+        d_x_e.resize(std::max(d_x_e.size(), block_global_dofs.size() - d_blocks.back().dof_offset));
+    };
+    DenseMatrix<double> M_e, M_c;
+    std::vector<dof_id_type> dof_id_scratch;
+    std::vector<const std::vector<dof_id_type>*> unconstrained_dofs;
+    std::vector<std::vector<dof_id_type> > constrained_dofs(n_vars);
+    const MeshBase::const_element_iterator el_begin = mesh.active_local_elements_begin();
+    const MeshBase::const_element_iterator el_end = mesh.active_local_elements_end();
+    for (MeshBase::const_element_iterator el_it = el_begin; el_it != el_end; ++el_it)
+    {
+        const Elem* const elem = *el_it;
+        fe->reinit(elem);
+
+        const auto& dof_indices = dof_map_cache.dof_indices(elem);
+        const auto n_basis = static_cast<unsigned int>(dof_indices[0].size());
+        const unsigned int n_qp = qrule->n_points();
+        M_e.resize(n_basis, n_basis);
+        for (unsigned int i = 0; i < n_basis; ++i)
+        {
+            for (unsigned int j = 0; j < n_basis; ++j)
+            {
+                for (unsigned int qp = 0; qp < n_qp; ++qp)
+                {
+                    M_e(i, j) += (phi[i][qp] * phi[j][qp]) * JxW[qp];
+                }
+            }
+        }
+
+        // Variables with no constrained dofs on this element share the
+        // unconstrained element matrix. The others get their own copy with
+        // the constraints applied in the same way as in the assembled case.
+        unconstrained_dofs.clear();
+        for (unsigned int var_num = 0; var_num < n_vars; ++var_num)
+        {
+            const auto& dof_indices_var = dof_indices[var_num];
+            const bool has_constrained_dof =
+                std::any_of(dof_indices_var.begin(), dof_indices_var.end(), [&](const dof_id_type dof) {
+                    return dof_map.is_constrained_dof(dof);
+                });
+            if (!has_constrained_dof)
+            {
+                unconstrained_dofs.push_back(&dof_indices_var);
+                continue;
+            }
+            M_c = M_e;
+            constrained_dofs[var_num] = dof_indices_var;
+            dof_map.constrain_element_matrix(M_c, constrained_dofs[var_num]);
+            add_block(M_c, { &constrained_dofs[var_num] });
+        }
+        if (!unconstrained_dofs.empty()) add_block(M_e, unconstrained_dofs);
+    }
+    d_y_e.resize(d_x_e.size());
+
+    // Find the Dirichlet dofs in the same way as in the assembled case.
+    std::vector<dof_id_type> dirichlet_dofs;
+    for (MeshBase::const_element_iterator el_it = el_begin; el_it != el_end; ++el_it)
+    {
+        const Elem* const elem = *el_it;
+        for (unsigned int side = 0; side < elem->n_sides(); ++side)
+        {
+            if (elem->neighbor_ptr(side)) continue;
+            static const boundary_id_type dirichlet_bdry_id_set[3] = { FEDataManager::ZERO_DISPLACEMENT_X_BDRY_ID,
+                                                                       FEDataManager::ZERO_DISPLACEMENT_Y_BDRY_ID,
+                                                                       FEDataManager::ZERO_DISPLACEMENT_Z_BDRY_ID };
+            std::vector<boundary_id_type> bdry_ids;
+            mesh.boundary_info->boundary_ids(elem, side, bdry_ids);
+            const boundary_id_type dirichlet_bdry_ids = get_dirichlet_bdry_ids(bdry_ids);
+            if (!dirichlet_bdry_ids) continue;
+            for (unsigned int n = 0; n < elem->n_nodes(); ++n)
+            {
+                if (!elem->is_node_on_side(n, side)) continue;
+                const Node* const node = elem->node_ptr(n);
+                for (unsigned int var_num = 0; var_num < n_vars; ++var_num)
+                {
+                    const unsigned int n_comp = node->n_comp(sys_num, var_num);
+                    for (unsigned int comp = 0; comp < n_comp; ++comp)
+                    {
+                        if (!(dirichlet_bdry_ids & dirichlet_bdry_id_set[comp])) continue;
+                        const unsigned int node_dof_index = node->dof_number(sys_num, var_num, comp);
+                        if (!dof_map.is_constrained_dof(node_dof_index)) continue;
+                        dirichlet_dofs.push_back(node_dof_index);
+                    }
+                }
+            }
+        }
+    }
+
+    // Switch to local dof indices and set up the scatter from the global
+    // vector layout to the local one.
+    std::vector<dof_id_type> local_to_global_dofs(block_global_dofs);
+    std::sort(local_to_global_dofs.begin(), local_to_global_dofs.end());
+    local_to_global_dofs.erase(std::unique(local_to_global_dofs.begin(), local_to_global_dofs.end()),
+                               local_to_global_dofs.end());
+    d_block_dofs.resize(block_global_dofs.size());
+    for (std::size_t k = 0; k < block_global_dofs.size(); ++k)
+    {
+        d_block_dofs[k] = static_cast<PetscInt>(
+            std::lower_bound(local_to_global_dofs.begin(), local_to_global_dofs.end(), block_global_dofs[k]) -
+            local_to_global_dofs.begin());
+    }
+    const std::vector<PetscInt> local_to_global_idxs(local_to_global_dofs.begin(), local_to_global_dofs.end());
+    const auto n_local_dofs = static_cast<PetscInt>(local_to_global_idxs.size());
+
+    Vec M_diag_vec = M_diag.vec();
+    MPI_Comm petsc_comm;
+    ierr = PetscObjectGetComm(reinterpret_cast<PetscObject>(M_diag_vec), &petsc_comm);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecCreateSeq(PETSC_COMM_SELF, n_local_dofs, &d_x_local);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecDuplicate(d_x_local, &d_y_local);
+    IBTK_CHKERRQ(ierr);
+    IS global_is;
+    ierr = ISCreateGeneral(PETSC_COMM_SELF, n_local_dofs, local_to_global_idxs.data(), PETSC_COPY_VALUES, &global_is);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecScatterCreate(M_diag_vec, global_is, d_x_local, nullptr, &d_scatter);
+    IBTK_CHKERRQ(ierr);
+    ierr = ISDestroy(&global_is);
+    IBTK_CHKERRQ(ierr);
+
+    // A Dirichlet dof may be found on one processor and coupled to elements
+    // on another, so communicate the flags before removing the rows and
+    // columns from the element matrices.
+    Vec dirichlet_flag_vec;
+    ierr = VecDuplicate(M_diag_vec, &dirichlet_flag_vec);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecSet(dirichlet_flag_vec, 0.0);
+    IBTK_CHKERRQ(ierr);
+    for (const dof_id_type dof : dirichlet_dofs)
+    {
+        ierr = VecSetValue(dirichlet_flag_vec, static_cast<PetscInt>(dof), 1.0, INSERT_VALUES);
+        IBTK_CHKERRQ(ierr);
+    }
+    ierr = VecAssemblyBegin(dirichlet_flag_vec);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecAssemblyEnd(dirichlet_flag_vec);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecScatterBegin(d_scatter, dirichlet_flag_vec, d_x_local, INSERT_VALUES, SCATTER_FORWARD);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecScatterEnd(d_scatter, dirichlet_flag_vec, d_x_local, INSERT_VALUES, SCATTER_FORWARD);
+    IBTK_CHKERRQ(ierr);
+    PetscInt first_local_row, last_local_row;
+    ierr = VecGetOwnershipRange(dirichlet_flag_vec, &first_local_row, &last_local_row);
+    IBTK_CHKERRQ(ierr);
+    const double* dirichlet_flag;
+    ierr = VecGetArrayRead(d_x_local, &dirichlet_flag);
+    IBTK_CHKERRQ(ierr);
+    for (PetscInt k = 0; k < n_local_dofs; ++k)
+    {
+        const PetscInt row = local_to_global_idxs[k];
+        if (dirichlet_flag[k] != 0.0 && first_local_row <= row && row < last_local_row)
+        {
+            d_dirichlet_rows.push_back(row - first_local_row);
+        }
+    }
+    for (const Block& block : d_blocks)
+    {
+        double* const M = &d_block_matrices[block.matrix_offset];
+        for (unsigned int comp = 0; comp < block.n_comps; ++comp)
+        {
+            const PetscInt* const dofs = &d_block_dofs[block.dof_offset + comp * block.n_dofs];
+            for (unsigned int k = 0; k < block.n_dofs; ++k)
+            {
+                if (dirichlet_flag[dofs[k]] == 0.0) continue;
+                for (unsigned int l = 0; l < block.n_dofs; ++l)
+                {
+                    M[k * block.n_dofs + l] = 0.0;
+                    M[l * block.n_dofs + k] = 0.0;
+                }
+            }
+        }
+    }
+    ierr = VecRestoreArrayRead(d_x_local, &dirichlet_flag);
+    IBTK_CHKERRQ(ierr);
+
+    // The operator is symmetric unless some constraints other than the
+    // Dirichlet conditions are present.
+    PetscScalar n_dirichlet_dofs;
+    ierr = VecSum(dirichlet_flag_vec, &n_dirichlet_dofs);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecDestroy(&dirichlet_flag_vec);
+    IBTK_CHKERRQ(ierr);
+    const bool is_symmetric = static_cast<dof_id_type>(std::round(n_dirichlet_dofs)) == dof_map.n_constrained_dofs();
+
+    // Set up the preconditioner.
+    ierr = VecDuplicate(M_diag_vec, &d_M_diag_inv);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecCopy(M_diag_vec, d_M_diag_inv);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecReciprocal(d_M_diag_inv);
+    IBTK_CHKERRQ(ierr);
+
+    // Set up the shell matrix and the solver.
+    PetscInt n_local_rows;
+    ierr = VecGetLocalSize(M_diag_vec, &n_local_rows);
+    IBTK_CHKERRQ(ierr);
+    ierr = MatCreateShell(
+        petsc_comm, n_local_rows, n_local_rows, PETSC_DETERMINE, PETSC_DETERMINE, static_cast<void*>(this), &d_mat);
+    IBTK_CHKERRQ(ierr);
+    ierr = MatShellSetOperation(
+        d_mat, MATOP_MULT, reinterpret_cast<void (*)(void)>(FEData::MatrixFreeL2ProjectionOperator::matMult));
+    IBTK_CHKERRQ(ierr);
+    ierr = KSPCreate(petsc_comm, &d_ksp);
+    IBTK_CHKERRQ(ierr);
+    ierr = KSPSetOperators(d_ksp, d_mat, d_mat);
+    IBTK_CHKERRQ(ierr);
+    ierr = KSPSetType(d_ksp, is_symmetric ? KSPCG : KSPGMRES);
+    IBTK_CHKERRQ(ierr);
+    ierr = KSPSetInitialGuessNonzero(d_ksp, PETSC_TRUE);
+    IBTK_CHKERRQ(ierr);
+    PC pc;
+    ierr = KSPGetPC(d_ksp, &pc);
+    IBTK_CHKERRQ(ierr);
+    ierr = PCSetType(pc, PCSHELL);
+    IBTK_CHKERRQ(ierr);
+    ierr = PCShellSetContext(pc, static_cast<void*>(this));
+    IBTK_CHKERRQ(ierr);
+    ierr = PCShellSetApply(pc, FEData::MatrixFreeL2ProjectionOperator::pcApply);
+    IBTK_CHKERRQ(ierr);
+    ierr = KSPSetOptionsPrefix(d_ksp, "L2_proj_mf_");
+    IBTK_CHKERRQ(ierr);
+    ierr = KSPSetFromOptions(d_ksp);
+    IBTK_CHKERRQ(ierr);
+    return;
+} // MatrixFreeL2ProjectionOperator
+
+FEData::MatrixFreeL2ProjectionOperator::~MatrixFreeL2ProjectionOperator()
+{
+    KSPDestroy(&d_ksp);
+    MatDestroy(&d_mat);
+    VecDestroy(&d_M_diag_inv);
+    VecScatterDestroy(&d_scatter);
+    VecDestroy(&d_x_local);
+    VecDestroy(&d_y_local);
+} // ~MatrixFreeL2ProjectionOperator
+
+bool
+FEData::MatrixFreeL2ProjectionOperator::solve(PetscVector<double>& U,
+                                              PetscVector<double>& F,
+                                              const double tol,
+                                              const unsigned int max_its)
+{
+    int ierr;
+    ierr = KSPSetTolerances(d_ksp, tol, PETSC_DEFAULT, PETSC_DEFAULT, static_cast<PetscInt>(max_its));
+    IBTK_CHKERRQ(ierr);
+    ierr = KSPSolve(d_ksp, F.vec(), U.vec());
+    IBTK_CHKERRQ(ierr);
+    KSPConvergedReason reason;
+    ierr = KSPGetConvergedReason(d_ksp, &reason);
+    IBTK_CHKERRQ(ierr);
+    return reason > 0;
+} // solve
+
+void
+FEData::MatrixFreeL2ProjectionOperator::apply(Vec x, Vec y)
+{
+    int ierr;
+    ierr = VecScatterBegin(d_scatter, x, d_x_local, INSERT_VALUES, SCATTER_FORWARD);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecScatterEnd(d_scatter, x, d_x_local, INSERT_VALUES, SCATTER_FORWARD);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecSet(d_y_local, 0.0);
+    IBTK_CHKERRQ(ierr);
+
+    const double* x_local;
+    double* y_local;
+    ierr = VecGetArrayRead(d_x_local, &x_local);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecGetArray(d_y_local, &y_local);
+    IBTK_CHKERRQ(ierr);
+    for (const Block& block : d_blocks)
+    {
+        // Gather the values of all components, multiply them by the element
+        // matrix at once, and scatter the result.
+        const unsigned int n_dofs = block.n_dofs;
+        const unsigned int n_comps = block.n_comps;
+        const double* const M = &d_block_matrices[block.matrix_offset];
+        const PetscInt* const dofs = &d_block_dofs[block.dof_offset];
+        for (unsigned int k = 0; k < n_dofs * n_comps; ++k)
+        {
+            d_x_e[k] = x_local[dofs[k]];
+            d_y_e[k] = 0.0;
+        }
+        for (unsigned int i = 0; i < n_dofs; ++i)
+        {
+            for (unsigned int j = 0; j < n_dofs; ++j)
+            {
+                const double M_ij = M[i * n_dofs + j];
+                for (unsigned int comp = 0; comp < n_comps; ++comp)
+                {
+                    d_y_e[comp * n_dofs + i] += M_ij * d_x_e[comp * n_dofs + j];
+                }
+            }
+        }
+        for (unsigned int k = 0; k < n_dofs * n_comps; ++k)
+        {
+            y_local[dofs[k]] += d_y_e[k];
+        }
+    }
+    ierr = VecRestoreArrayRead(d_x_local, &x_local);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecRestoreArray(d_y_local, &y_local);
+    IBTK_CHKERRQ(ierr);
+
+    ierr = VecSet(y, 0.0);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecScatterBegin(d_scatter, d_y_local, y, ADD_VALUES, SCATTER_REVERSE);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecScatterEnd(d_scatter, d_y_local, y, ADD_VALUES, SCATTER_REVERSE);
+    IBTK_CHKERRQ(ierr);
+
+    // Dirichlet rows are set to the identity.
+    if (!d_dirichlet_rows.empty())
+    {
+        const double* x_arr;
+        double* y_arr;
+        ierr = VecGetArrayRead(x, &x_arr);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecGetArray(y, &y_arr);
+        IBTK_CHKERRQ(ierr);
+        for (const PetscInt row : d_dirichlet_rows) y_arr[row] = x_arr[row];
+        ierr = VecRestoreArrayRead(x, &x_arr);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecRestoreArray(y, &y_arr);
+        IBTK_CHKERRQ(ierr);
+    }
+    return;
+} // apply
+
+PetscErrorCode
+FEData::MatrixFreeL2ProjectionOperator::matMult(Mat A, Vec x, Vec y)
+{
+    void* p_ctx;
+    int ierr = MatShellGetContext(A, &p_ctx);
+    IBTK_CHKERRQ(ierr);
+    auto op = static_cast<FEData::MatrixFreeL2ProjectionOperator*>(p_ctx);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(op);
+#endif
+    op->apply(x, y);
+    PetscFunctionReturn(0);
+} // matMult
+
+PetscErrorCode
+FEData::MatrixFreeL2ProjectionOperator::pcApply(PC pc, Vec x, Vec y)
+{
+    void* p_ctx;
+    int ierr = PCShellGetContext(pc, &p_ctx);
+    IBTK_CHKERRQ(ierr);
+    auto op = static_cast<FEData::MatrixFreeL2ProjectionOperator*>(p_ctx);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(op);
+#endif
+    ierr = VecPointwiseMult(y, op->d_M_diag_inv, x);
+    IBTK_CHKERRQ(ierr);
+    PetscFunctionReturn(0);
+} // pcApply
+
 const boundary_id_type FEDataManager::ZERO_DISPLACEMENT_X_BDRY_ID = 0x100;
 const boundary_id_type FEDataManager::ZERO_DISPLACEMENT_Y_BDRY_ID = 0x200;
 const boundary_id_type FEDataManager::ZERO_DISPLACEMENT_Z_BDRY_ID = 0x400;
@@ -522,18 +975,25 @@ FEDataManager::reinitElementMappings()
     d_fe_data->clearCached();
 
     // Delete cached hierarchy-dependent data.
-    d_active_patch_elem_map.clear();
-    d_active_patch_node_map.clear();
     d_active_patch_ghost_dofs.clear();
     d_active_elem_bboxes.clear();
     d_system_ghost_vec.clear();
     d_system_ib_ghost_vec.clear();
 
-    // Reset the mappings between grid patches and active mesh
-    // elements. collectActivePatchElements will populate d_active_elem_bboxes
-    // and use it.
-    collectActivePatchElements(d_active_patch_elem_map, d_fe_data->d_level_number, d_ghost_width);
-    collectActivePatchNodes(d_active_patch_node_map, d_active_patch_elem_map);
+    // Reset the mappings between grid patches and active mesh elements. If
+    // possible, only reassign the elements which have moved far enough since
+    // the mappings were last computed.
+    const bool updated_mappings =
+        d_elem_mapping_displacement_fraction > 0.0 &&
+        updateActivePatchElementsAndNodes(
+            d_active_patch_elem_map, d_active_patch_node_map, d_fe_data->d_level_number, d_ghost_width);
+    if (!updated_mappings)
+    {
+        d_active_patch_elem_map.clear();
+        d_active_patch_node_map.clear();
+        collectActivePatchElements(d_active_patch_elem_map, d_fe_data->d_level_number, d_ghost_width);
+        collectActivePatchNodes(d_active_patch_node_map, d_active_patch_elem_map);
+    }
 
     // Reset the sets of dofs corresponding to IB ghost data. This is usually
     // a superset of the standard (i.e., all dofs on unowned cells adjacent to
@@ -844,7 +1304,7 @@ FEDataManager::spread(const int f_data_idx,
     using quad_key_type = std::tuple<libMesh::ElemType, libMesh::QuadratureType, libMesh::Order>;
     FECache F_fe_cache(dim, F_fe_type, FEUpdateFlags::update_phi);
     FECache X_fe_cache(dim, X_fe_type, FEUpdateFlags::update_phi);
-    JacobianCalculatorCache jacobian_calculator_cache(mesh.spatial_dimension());
+    JacobianCalculatorCache& jacobian_calculator_cache = *d_fe_data->d_jacobian_calculator_cache;
 
     // Check to see if we are using nodal quadrature.
     const bool use_nodal_quadrature =
@@ -984,6 +1444,7 @@ FEDataManager::spread(const int f_data_idx,
             const std::vector<Elem*>& patch_elems = d_active_patch_elem_map[local_patch_num];
             const size_t num_active_patch_elems = patch_elems.size();
             if (!num_active_patch_elems) continue;
+            const double patch_start_time = d_default_workload_spec.use_measured_costs ? MPI_Wtime() : 0.0;
 
             const Pointer<Patch<NDIM> > patch = level->getPatch(p());
             const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
@@ -1034,8 +1495,8 @@ FEDataManager::spread(const int f_data_idx,
                 JacobianCalculator& jacobian_calculator = jacobian_calculator_cache[key];
                 const QBase& qrule = d_fe_data->d_quadrature_cache[key];
 
-                // JxW depends on the element
-                const std::vector<double>& JxW_F = jacobian_calculator.get_JxW(elem);
+                // JxW depends on the element (but not on its current position)
+                const std::vector<double>& JxW_F = jacobian_calculator.get_cached_JxW(elem);
                 const std::vector<std::vector<double> >& phi_F = F_fe.get_phi();
                 const std::vector<std::vector<double> >& phi_X = X_fe.get_phi();
 
@@ -1079,6 +1540,10 @@ FEDataManager::spread(const int f_data_idx,
                 f_phys_bdry_op->setPatchDataIndex(f_data_idx);
                 f_phys_bdry_op->accumulateFromPhysicalBoundaryData(*patch, fill_data_time, f_data->getGhostCellWidth());
             }
+            if (d_default_workload_spec.use_measured_costs)
+            {
+                recordMeasuredCosts(patch_elems, quad_keys, MPI_Wtime() - patch_start_time);
+            }
         }
 
         // Restore local form vectors.
@@ -1520,7 +1985,7 @@ FEDataManager::interpWeighted(const int f_data_idx,
     using quad_key_type = std::tuple<libMesh::ElemType, libMesh::QuadratureType, libMesh::Order>;
     FECache F_fe_cache(dim, F_fe_type, FEUpdateFlags::update_phi);
     FECache X_fe_cache(dim, X_fe_type, FEUpdateFlags::update_phi);
-    JacobianCalculatorCache jacobian_calculator_cache(mesh.spatial_dimension());
+    JacobianCalculatorCache& jacobian_calculator_cache = *d_fe_data->d_jacobian_calculator_cache;
 
     // Communicate any unsynchronized ghost data.
     for (const auto& f_refine_sched : f_refine_scheds)
@@ -1679,6 +2144,7 @@ FEDataManager::interpWeighted(const int f_data_idx,
             const std::vector<Elem*>& patch_elems = d_active_patch_elem_map[local_patch_num];
             const size_t num_active_patch_elems = patch_elems.size();
             if (!num_active_patch_elems) continue;
+            const double patch_start_time = d_default_workload_spec.use_measured_costs ? MPI_Wtime() : 0.0;
 
             const Pointer<Patch<NDIM> > patch = level->getPatch(p());
             const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
@@ -1776,8 +2242,8 @@ FEDataManager::interpWeighted(const int f_data_idx,
                 const QBase& qrule = d_fe_data->d_quadrature_cache[key];
                 JacobianCalculator& jacobian_calculator = jacobian_calculator_cache[key];
 
-                // JxW depends on the element
-                const std::vector<double>& JxW_F = jacobian_calculator.get_JxW(elem);
+                // JxW depends on the element (but not on its current position)
+                const std::vector<double>& JxW_F = jacobian_calculator.get_cached_JxW(elem);
                 const std::vector<std::vector<double> >& phi_F = F_fe.get_phi();
 
                 const unsigned int n_qp = qrule.n_points();
@@ -1811,6 +2277,10 @@ FEDataManager::interpWeighted(const int f_data_idx,
                 }
                 qp_offset += n_qp;
             }
+            if (d_default_workload_spec.use_measured_costs)
+            {
+                recordMeasuredCosts(patch_elems, quad_keys, MPI_Wtime() - patch_start_time);
+            }
         }
 
         // Restore local form vectors.
@@ -2360,6 +2830,28 @@ FEDataManager::buildDiagonalL2MassMatrix(const std::string& system_name)
     return d_fe_data->d_L2_proj_matrix_diag[system_name].get();
 } // buildDiagonalL2MassMatrix
 
+FEData::MatrixFreeL2ProjectionOperator*
+FEDataManager::buildMatrixFreeL2ProjectionOperator(const std::string& system_name)
+{
+    std::unique_ptr<FEData::MatrixFreeL2ProjectionOperator>& op = d_fe_data->d_L2_proj_mf_operator[system_name];
+    if (!op)
+    {
+        auto M_diag_vec = static_cast<PetscVector<double>*>(buildDiagonalL2MassMatrix(system_name));
+
+        IBTK_TIMER_START(t_build_matrix_free_l2_projection_operator);
+        if (d_enable_logging)
+        {
+            plog << "FEDataManager::buildMatrixFreeL2ProjectionOperator(): building matrix-free L2 projection "
+                    "operator for system: "
+                 << system_name << "\n";
+        }
+        System& system = d_fe_data->d_es->get_system(system_name);
+        op.reset(new FEData::MatrixFreeL2ProjectionOperator(system, *getDofMapCache(system_name), *M_diag_vec));
+        IBTK_TIMER_STOP(t_build_matrix_free_l2_projection_operator);
+    }
+    return op.get();
+} // buildMatrixFreeL2ProjectionOperator
+
 bool
 FEDataManager::computeL2Projection(NumericVector<double>& U_vec,
                                    NumericVector<double>& F_vec,
@@ -2378,7 +2870,23 @@ FEDataManager::computeL2Projection(NumericVector<double>& U_vec,
     if (close_F) F_vec.close();
     const System& system = d_fe_data->d_es->get_system(system_name);
     const DofMap& dof_map = system.get_dof_map();
-    if (consistent_mass_matrix)
+    if (consistent_mass_matrix && d_use_matrix_free_L2_projection)
+    {
+        FEData::MatrixFreeL2ProjectionOperator* op = buildMatrixFreeL2ProjectionOperator(system_name);
+        PetscBool rtol_set;
+        double runtime_rtol;
+        ierr = PetscOptionsGetReal(nullptr, "", "-ksp_rtol", &runtime_rtol, &rtol_set);
+        IBTK_CHKERRQ(ierr);
+        PetscBool max_it_set;
+        int runtime_max_it;
+        ierr = PetscOptionsGetInt(nullptr, "", "-ksp_max_it", &runtime_max_it, &max_it_set);
+        IBTK_CHKERRQ(ierr);
+        converged = op->solve(static_cast<PetscVector<double>&>(U_vec),
+                              static_cast<PetscVector<double>&>(F_vec),
+                              rtol_set ? runtime_rtol : tol,
+                              max_it_set ? runtime_max_it : max_its);
+    }
+    else if (consistent_mass_matrix)
     {
         std::pair<libMesh::LinearSolver<double>*, SparseMatrix<double>*> proj_solver_components =
             buildL2ProjectionSolver(system_name);
@@ -2488,7 +2996,7 @@ FEDataManager::addWorkloadEstimate(Pointer<PatchHierarchy<NDIM> > hierarchy,
     const int ln = d_fe_data->d_level_number;
     if (coarsest_ln <= ln && ln <= finest_ln)
     {
-        updateQuadPointCountData(ln, ln);
+        updateQuadPointCountData(ln, ln, d_default_workload_spec.use_measured_costs);
         HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(hierarchy, ln, ln);
         hier_cc_data_ops.axpy(
             workload_data_idx, d_default_workload_spec.q_point_weight, d_qp_count_idx, workload_data_idx);
@@ -2498,6 +3006,27 @@ FEDataManager::addWorkloadEstimate(Pointer<PatchHierarchy<NDIM> > hierarchy,
     return;
 } // addWorkloadEstimate
 
+void
+FEDataManager::decayMeasuredCosts()
+{
+    const double retention = d_default_workload_spec.measured_cost_retention;
+    for (double& t : d_fe_data->d_elem_work_time) t *= retention;
+    for (double& n : d_fe_data->d_elem_work_q_points) n *= retention;
+    return;
+} // decayMeasuredCosts
+
+const std::vector<double>&
+FEDataManager::getMeasuredElementTimes() const
+{
+    return d_fe_data->d_elem_work_time;
+} // getMeasuredElementTimes
+
+const std::vector<double>&
+FEDataManager::getMeasuredElementQuadPointCounts() const
+{
+    return d_fe_data->d_elem_work_q_points;
+} // getMeasuredElementQuadPointCounts
+
 void
 FEDataManager::applyGradientDetector(const Pointer<BasePatchHierarchy<NDIM> > hierarchy,
                                      const int level_number,
@@ -2713,6 +3242,8 @@ FEDataManager::FEDataManager(std::shared_ptr<FEData> fe_data,
             TimerManager::getManager()->getTimer("IBTK::FEDataManager::buildL2ProjectionSolver()");
         t_build_diagonal_l2_mass_matrix =
             TimerManager::getManager()->getTimer("IBTK::FEDataManager::buildDiagonalL2MassMatrix()");
+        t_build_matrix_free_l2_projection_operator =
+            TimerManager::getManager()->getTimer("IBTK::FEDataManager::buildMatrixFreeL2ProjectionOperator()");
         t_compute_l2_projection = TimerManager::getManager()->getTimer("IBTK::FEDataManager::computeL2Projection()");
         t_update_workload_estimates =
             TimerManager::getManager()->getTimer("IBTK::FEDataManager::updateWorkloadEstimates()");
@@ -2764,11 +3295,54 @@ FEDataManager::getLoggingEnabled() const
     return d_enable_logging;
 } // getLoggingEnabled
 
+void
+FEDataManager::setUseMatrixFreeL2Projection(bool use_matrix_free)
+{
+    d_use_matrix_free_L2_projection = use_matrix_free;
+    return;
+} // setUseMatrixFreeL2Projection
+
+bool
+FEDataManager::getUseMatrixFreeL2Projection() const
+{
+    return d_use_matrix_free_L2_projection;
+} // getUseMatrixFreeL2Projection
+
+void
+FEDataManager::setElementMappingDisplacementFraction(const double fraction)
+{
+    TBOX_ASSERT(fraction >= 0.0);
+    d_elem_mapping_displacement_fraction = fraction;
+    return;
+} // setElementMappingDisplacementFraction
+
+double
+FEDataManager::getElementMappingDisplacementFraction() const
+{
+    return d_elem_mapping_displacement_fraction;
+} // getElementMappingDisplacementFraction
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 void
-FEDataManager::updateQuadPointCountData(const int coarsest_ln, const int finest_ln)
+FEDataManager::updateQuadPointCountData(const int coarsest_ln, const int finest_ln, const bool use_measured_costs)
 {
+    // Determine the average measured cost per quadrature point over all
+    // processors: each quadrature point is weighted by the cost of its element
+    // relative to this value.
+    const std::vector<double>& elem_work_time = d_fe_data->d_elem_work_time;
+    const std::vector<double>& elem_work_q_points = d_fe_data->d_elem_work_q_points;
+    double avg_q_point_cost = 0.0;
+    if (use_measured_costs)
+    {
+        double totals[2] = { std::accumulate(elem_work_time.begin(), elem_work_time.end(), 0.0),
+                             std::accumulate(elem_work_q_points.begin(), elem_work_q_points.end(), 0.0) };
+        const int ierr =
+            MPI_Allreduce(MPI_IN_PLACE, totals, 2, MPI_DOUBLE, MPI_SUM, SAMRAI::tbox::SAMRAI_MPI::commWorld);
+        TBOX_ASSERT(ierr == 0);
+        if (totals[1] > 0.0) avg_q_point_cost = totals[0] / totals[1];
+    }
+
     // Set the node count data on the specified range of levels of the
     // hierarchy.
     unsigned long n_local_q_points = 0;
@@ -2842,13 +3416,23 @@ FEDataManager::updateQuadPointCountData(const int coarsest_ln, const int finest_
                 const std::vector<std::vector<double> >& X_phi = X_fe.get_phi();
                 TBOX_ASSERT(qrule.n_points() == X_phi[0].size());
 
+                // Elements for which no cost has been measured on this
+                // processor are assumed to have the average cost.
+                double q_point_weight = 1.0;
+                const dof_id_type elem_id = elem->id();
+                if (avg_q_point_cost > 0.0 && elem_id < elem_work_q_points.size() &&
+                    elem_work_q_points[elem_id] > 0.0)
+                {
+                    q_point_weight = elem_work_time[elem_id] / (elem_work_q_points[elem_id] * avg_q_point_cost);
+                }
+
                 for (unsigned int qp = 0; qp < qrule.n_points(); ++qp)
                 {
                     interpolate(&X_qp[0], qp, X_node, X_phi);
                     const hier::Index<NDIM> i = IndexUtilities::getCellIndex(X_qp, grid_geom, ratio);
                     if (patch_box.contains(i))
                     {
-                        (*qp_count_data)(i) += 1.0;
+                        (*qp_count_data)(i) += q_point_weight;
                         ++n_local_q_points;
                     }
                 }
@@ -2886,6 +3470,39 @@ FEDataManager::updateQuadPointCountData(const int coarsest_ln, const int finest_
     return;
 } // updateQuadPointCountData
 
+void
+FEDataManager::recordMeasuredCosts(const std::vector<Elem*>& patch_elems,
+                                   const std::vector<QuadratureCache::key_type>& quad_keys,
+                                   const double elapsed_time)
+{
+    TBOX_ASSERT(patch_elems.size() == quad_keys.size());
+    const MeshBase& mesh = d_fe_data->d_es->get_mesh();
+    std::vector<double>& elem_work_time = d_fe_data->d_elem_work_time;
+    std::vector<double>& elem_work_q_points = d_fe_data->d_elem_work_q_points;
+    if (elem_work_time.size() != mesh.max_elem_id())
+    {
+        elem_work_time.assign(mesh.max_elem_id(), 0.0);
+        elem_work_q_points.assign(mesh.max_elem_id(), 0.0);
+    }
+
+    double n_qp_patch = 0.0;
+    for (const QuadratureCache::key_type& key : quad_keys)
+    {
+        n_qp_patch += d_fe_data->d_quadrature_cache[key].n_points();
+    }
+    if (n_qp_patch == 0.0) return;
+
+    const double q_point_time = elapsed_time / n_qp_patch;
+    for (unsigned int e_idx = 0; e_idx < patch_elems.size(); ++e_idx)
+    {
+        const dof_id_type elem_id = patch_elems[e_idx]->id();
+        const double n_qp = d_fe_data->d_quadrature_cache[quad_keys[e_idx]].n_points();
+        elem_work_time[elem_id] += q_point_time * n_qp;
+        elem_work_q_points[elem_id] += n_qp;
+    }
+    return;
+} // recordMeasuredCosts
+
 std::vector<std::pair<Point, Point> >*
 FEDataManager::computeActiveElementBoundingBoxes()
 {
@@ -2913,11 +3530,9 @@ FEDataManager::collectActivePatchElements(std::vector<std::vector<Elem*> >& acti
 {
     // Get the necessary FE data.
     const MeshBase& mesh = d_fe_data->d_es->get_mesh();
-    System& X_system = d_fe_data->d_es->get_system(COORDINATES_SYSTEM_NAME);
 
     // Setup data structures used to assign elements to patches.
     Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_number);
-    const Pointer<CartesianGridGeometry<NDIM> > grid_geom = level->getGridGeometry();
     const int num_local_patches = level->getProcessorMapping().getNumberOfLocalIndices();
     std::vector<std::set<Elem*> > local_patch_elems(num_local_patches);
     active_patch_elems.resize(num_local_patches);
@@ -2926,6 +3541,177 @@ FEDataManager::collectActivePatchElements(std::vector<std::vector<Elem*> >& acti
     // bounding box (which is computed based on the bounds of quadrature
     // points) intersects the patch interior grown by the specified ghost cell
     // width.
+    std::vector<libMeshWrappers::BoundingBox> global_bboxes =
+        get_global_active_element_bounding_boxes(mesh, computeLocalActiveElementBoundingBoxes(level_number));
+
+    // If we update the mappings incrementally then the bounding boxes are
+    // grown by the permitted displacement and stored along with the patches
+    // with which they were intersected.
+    d_associated_patch_boxes.clear();
+    d_associated_elem_bboxes.clear();
+    d_associated_level_number = IBTK::invalid_level_number;
+    if (d_elem_mapping_displacement_fraction > 0.0)
+    {
+        growElementBoundingBoxes(global_bboxes, level_number, ghost_width);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            d_associated_patch_boxes.push_back(level->getPatch(p())->getBox());
+        }
+        d_associated_elem_bboxes = global_bboxes;
+        d_associated_level_number = level_number;
+    }
+
+    int local_patch_num = 0;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
+    {
+        std::set<Elem*>& elems = local_patch_elems[local_patch_num];
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        // TODO: reimplement this with an rtree description of SAMRAI's patches
+        const libMeshWrappers::BoundingBox patch_bbox = get_patch_bbox(*patch, ghost_width);
+
+        auto el_it = mesh.active_elements_begin();
+        for (const libMeshWrappers::BoundingBox& bbox : global_bboxes)
+        {
+            if (bboxes_intersect(bbox, patch_bbox)) elems.insert(*el_it);
+            ++el_it;
+        }
+    }
+
+    // Set the active patch element data.
+    local_patch_num = 0;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
+    {
+        const std::set<Elem*>& local_elems = local_patch_elems[local_patch_num];
+        std::vector<Elem*>& active_elems = active_patch_elems[local_patch_num];
+        active_elems.resize(local_elems.size());
+        std::copy(local_elems.begin(), local_elems.end(), active_elems.begin());
+    }
+    return;
+} // collectActivePatchElements
+
+bool
+FEDataManager::updateActivePatchElementsAndNodes(std::vector<std::vector<Elem*> >& active_patch_elems,
+                                                 std::vector<std::vector<Node*> >& active_patch_nodes,
+                                                 const int level_number,
+                                                 const IntVector<NDIM>& ghost_width)
+{
+    // Get the necessary FE data.
+    const MeshBase& mesh = d_fe_data->d_es->get_mesh();
+
+    // The previous association can only be reused if it was computed for the
+    // same set of local patches.
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_number);
+    std::vector<Box<NDIM> > patch_boxes;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        patch_boxes.push_back(level->getPatch(p())->getBox());
+    }
+    if (level_number != d_associated_level_number || patch_boxes != d_associated_patch_boxes ||
+        active_patch_elems.size() != patch_boxes.size() || active_patch_nodes.size() != patch_boxes.size() ||
+        d_associated_elem_bboxes.size() != mesh.n_active_elem())
+    {
+        return false;
+    }
+
+    // Determine which local elements have left the bounding boxes with which
+    // they were associated with patches. Since the associated bounding boxes
+    // are stored for all elements on every process, this check does not
+    // depend on which process previously owned each element.
+    const std::vector<libMeshWrappers::BoundingBox> local_bboxes = computeLocalActiveElementBoundingBoxes(level_number);
+    std::vector<libMeshWrappers::BoundingBox> grown_local_bboxes = local_bboxes;
+    growElementBoundingBoxes(grown_local_bboxes, level_number, ghost_width);
+    static const int MOVED_ELEM_DATA_SIZE = 1 + 2 * LIBMESH_DIM;
+    std::vector<double> local_moved_elem_data;
+    std::size_t local_elem_n = 0;
+    const auto el_begin = mesh.active_local_elements_begin();
+    const auto el_end = mesh.active_local_elements_end();
+    for (auto el_it = el_begin; el_it != el_end; ++el_it, ++local_elem_n)
+    {
+        const dof_id_type elem_id = (*el_it)->id();
+        const libMeshWrappers::BoundingBox& bbox = local_bboxes[local_elem_n];
+        const libMeshWrappers::BoundingBox& associated_bbox = d_associated_elem_bboxes[elem_id];
+        bool contained = true;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            contained = contained && associated_bbox.first(d) <= bbox.first(d) &&
+                        bbox.second(d) <= associated_bbox.second(d);
+        }
+        if (contained) continue;
+        const libMeshWrappers::BoundingBox& grown_bbox = grown_local_bboxes[local_elem_n];
+        local_moved_elem_data.push_back(static_cast<double>(elem_id));
+        for (unsigned int d = 0; d < LIBMESH_DIM; ++d) local_moved_elem_data.push_back(grown_bbox.first(d));
+        for (unsigned int d = 0; d < LIBMESH_DIM; ++d) local_moved_elem_data.push_back(grown_bbox.second(d));
+    }
+
+    // Only the new bounding boxes of the moved elements are communicated.
+    const int local_moved_elem_data_size = static_cast<int>(local_moved_elem_data.size());
+    const int moved_elem_data_size = SAMRAI_MPI::sumReduction(local_moved_elem_data_size);
+    std::vector<double> moved_elem_data(moved_elem_data_size);
+    if (moved_elem_data_size > 0)
+    {
+        SAMRAI_MPI::allGather(local_moved_elem_data.data(),
+                              local_moved_elem_data_size,
+                              moved_elem_data.data(),
+                              moved_elem_data_size);
+    }
+    std::vector<bool> elem_moved(d_associated_elem_bboxes.size(), false);
+    std::vector<Elem*> moved_elems;
+    for (int k = 0; k < moved_elem_data_size; k += MOVED_ELEM_DATA_SIZE)
+    {
+        const auto elem_id = static_cast<dof_id_type>(moved_elem_data[k]);
+        libMeshWrappers::BoundingBox& associated_bbox = d_associated_elem_bboxes[elem_id];
+        for (unsigned int d = 0; d < LIBMESH_DIM; ++d)
+        {
+            associated_bbox.first(d) = moved_elem_data[k + 1 + d];
+            associated_bbox.second(d) = moved_elem_data[k + 1 + LIBMESH_DIM + d];
+        }
+        elem_moved[elem_id] = true;
+        moved_elems.push_back(const_cast<Elem*>(mesh.elem_ptr(elem_id)));
+    }
+    if (d_enable_logging)
+    {
+        plog << "FEDataManager::updateActivePatchElementsAndNodes(): reassigning " << moved_elems.size() << " of "
+             << mesh.n_active_elem() << " elements\n";
+    }
+
+    // Reassign the moved elements. The elements associated with each patch
+    // are kept sorted by address, as in collectActivePatchElements().
+    int local_patch_num = 0;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
+    {
+        std::vector<Elem*>& elems = active_patch_elems[local_patch_num];
+        const std::size_t n_old_elems = elems.size();
+        elems.erase(std::remove_if(elems.begin(),
+                                   elems.end(),
+                                   [&](const Elem* const elem) { return elem_moved[elem->id()]; }),
+                    elems.end());
+        const std::size_t n_kept_elems = elems.size();
+
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        const libMeshWrappers::BoundingBox patch_bbox = get_patch_bbox(*patch, ghost_width);
+        for (Elem* const elem : moved_elems)
+        {
+            if (bboxes_intersect(d_associated_elem_bboxes[elem->id()], patch_bbox)) elems.push_back(elem);
+        }
+        std::sort(elems.begin() + n_kept_elems, elems.end());
+        std::inplace_merge(elems.begin(), elems.begin() + n_kept_elems, elems.end());
+
+        if (n_kept_elems != n_old_elems || elems.size() != n_kept_elems)
+        {
+            collect_patch_nodes(active_patch_nodes[local_patch_num], elems, mesh);
+        }
+    }
+    return true;
+} // updateActivePatchElementsAndNodes
+
+std::vector<libMeshWrappers::BoundingBox>
+FEDataManager::computeLocalActiveElementBoundingBoxes(const int level_number)
+{
+    // Get the necessary FE data.
+    const MeshBase& mesh = d_fe_data->d_es->get_mesh();
+    System& X_system = d_fe_data->d_es->get_system(COORDINATES_SYSTEM_NAME);
+
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_number);
     double dx_0 = std::numeric_limits<double>::max();
     for (PatchLevel<NDIM>::Iterator p(level); p; p++)
     {
@@ -2967,52 +3753,32 @@ FEDataManager::collectActivePatchElements(std::vector<std::vector<Elem*> >& acti
         local_bboxes.back().union_with(local_qp_bboxes[box_n]);
 #endif
     }
-    const std::vector<libMeshWrappers::BoundingBox> global_bboxes =
-        get_global_active_element_bounding_boxes(mesh, local_bboxes);
+    return local_bboxes;
+} // computeLocalActiveElementBoundingBoxes
 
-    int local_patch_num = 0;
-    for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
+void
+FEDataManager::growElementBoundingBoxes(std::vector<libMeshWrappers::BoundingBox>& bboxes,
+                                        const int level_number,
+                                        const IntVector<NDIM>& ghost_width) const
+{
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_number);
+    const Pointer<CartesianGridGeometry<NDIM> > grid_geom = level->getGridGeometry();
+    const IntVector<NDIM>& ratio = level->getRatio();
+    std::array<double, NDIM> delta;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        delta[d] = d_elem_mapping_displacement_fraction * ghost_width[d] * grid_geom->getDx()[d] / ratio(d);
+    }
+    for (libMeshWrappers::BoundingBox& bbox : bboxes)
     {
-        std::set<Elem*>& elems = local_patch_elems[local_patch_num];
-        Pointer<Patch<NDIM> > patch = level->getPatch(p());
-        const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
-        const double* const dx = pgeom->getDx();
-        // TODO: reimplement this with an rtree description of SAMRAI's patches
-        libMeshWrappers::BoundingBox patch_bbox;
         for (unsigned int d = 0; d < NDIM; ++d)
         {
-            patch_bbox.first(d) = pgeom->getXLower()[d] - dx[d] * ghost_width[d];
-            patch_bbox.second(d) = pgeom->getXUpper()[d] + dx[d] * ghost_width[d];
-        }
-        for (unsigned int d = NDIM; d < LIBMESH_DIM; ++d)
-        {
-            patch_bbox.first(d) = 0.0;
-            patch_bbox.second(d) = 0.0;
-        }
-
-        auto el_it = mesh.active_elements_begin();
-        for (const libMeshWrappers::BoundingBox& bbox : global_bboxes)
-        {
-#if LIBMESH_VERSION_LESS_THAN(1, 2, 0)
-            if (bbox.intersect(patch_bbox)) elems.insert(*el_it);
-#else
-            if (bbox.intersects(patch_bbox)) elems.insert(*el_it);
-#endif
-            ++el_it;
+            bbox.first(d) -= delta[d];
+            bbox.second(d) += delta[d];
         }
     }
-
-    // Set the active patch element data.
-    local_patch_num = 0;
-    for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
-    {
-        const std::set<Elem*>& local_elems = local_patch_elems[local_patch_num];
-        std::vector<Elem*>& active_elems = active_patch_elems[local_patch_num];
-        active_elems.resize(local_elems.size());
-        std::copy(local_elems.begin(), local_elems.end(), active_elems.begin());
-    }
     return;
-} // collectActivePatchElements
+} // growElementBoundingBoxes
 
 void
 FEDataManager::collectActivePatchNodes(std::vector<std::vector<Node*> >& active_patch_nodes,
@@ -3023,20 +3789,7 @@ FEDataManager::collectActivePatchNodes(std::vector<std::vector<Node*> >& active_
     active_patch_nodes.resize(num_local_patches);
     for (unsigned int k = 0; k < num_local_patches; ++k)
     {
-        std::set<dof_id_type> active_node_ids;
-        for (const auto& elem : active_patch_elems[k])
-        {
-            for (unsigned int n = 0; n < elem->n_nodes(); ++n)
-            {
-                active_node_ids.insert(elem->node_id(n));
-            }
-        }
-        const unsigned int num_active_nodes = active_node_ids.size();
-        active_patch_nodes[k].reserve(num_active_nodes);
-        for (const auto& active_node_id : active_node_ids)
-        {
-            active_patch_nodes[k].push_back(const_cast<Node*>(mesh.node_ptr(active_node_id)));
-        }
+        collect_patch_nodes(active_patch_nodes[k], active_patch_elems[k], mesh);
     }
     return;
 }
@@ -49,6 +49,14 @@ JacobianCalculator::get_JxW(const Elem*)
     return d_JxW;
 }
 
+const std::vector<double>&
+JacobianCalculator::get_cached_JxW(const Elem* elem)
+{
+    const auto it = d_cached_JxW.find(elem->id());
+    if (it != d_cached_JxW.end()) return it->second;
+    return d_cached_JxW[elem->id()] = get_JxW(elem);
+}
+
 template <int dim, int spacedim>
 LagrangeJacobianCalculator<dim, spacedim>::LagrangeJacobianCalculator(
     const typename LagrangeJacobianCalculator<dim, spacedim>::key_type quad_key)
@@ -205,6 +213,12 @@ Tri3JacobianCalculator::get_JxW(const Elem* elem)
     return d_JxW;
 }
 
+const std::vector<double>&
+Tri3JacobianCalculator::get_cached_JxW(const Elem* elem)
+{
+    return get_JxW(elem);
+}
+
 const std::vector<double>&
 Quad4JacobianCalculator::get_JxW(const Elem* elem)
 {
@@ -388,6 +402,67 @@ Tet4JacobianCalculator::get_JxW(const Elem* elem)
     return d_JxW;
 }
 
+const std::vector<double>&
+Tet4JacobianCalculator::get_cached_JxW(const Elem* elem)
+{
+    return get_JxW(elem);
+}
+
+Hex8JacobianCalculator::Hex8JacobianCalculator(const Hex8JacobianCalculator::key_type quad_key)
+    : JacobianCalculator(quad_key)
+{
+    TBOX_ASSERT(std::get<0>(d_quad_key) == libMesh::HEX8);
+    d_dphi.resize(d_quad_points.size());
+    for (unsigned int q = 0; q < d_quad_points.size(); ++q)
+    {
+        for (unsigned int d = 0; d < 3; ++d)
+        {
+            for (unsigned int node_n = 0; node_n < 8; ++node_n)
+            {
+                d_dphi[q][d][node_n] = libMesh::FE<3, libMesh::LAGRANGE>::shape_deriv(
+                    libMesh::HEX8, libMesh::FIRST, node_n, d, d_quad_points[q]);
+            }
+        }
+    }
+}
+
+const std::vector<double>&
+Hex8JacobianCalculator::get_JxW(const Elem* elem)
+{
+    TBOX_ASSERT(elem->type() == std::get<0>(d_quad_key));
+    std::copy(d_quad_weights.begin(), d_quad_weights.end(), d_JxW.begin());
+
+    double xs[3][8];
+    for (unsigned int node_n = 0; node_n < 8; ++node_n)
+    {
+        const Point p = elem->point(node_n);
+        for (unsigned int i = 0; i < 3; ++i) xs[i][node_n] = p(i);
+    }
+
+    for (unsigned int q = 0; q < d_JxW.size(); ++q)
+    {
+        double Jac[3][3];
+        for (unsigned int i = 0; i < 3; ++i)
+        {
+            for (unsigned int j = 0; j < 3; ++j)
+            {
+                double Jac_ij = 0.0;
+                for (unsigned int node_n = 0; node_n < 8; ++node_n)
+                {
+                    Jac_ij += xs[i][node_n] * d_dphi[q][j][node_n];
+                }
+                Jac[i][j] = Jac_ij;
+            }
+        }
+
+        const double J = determinant(Jac);
+        TBOX_ASSERT(J > 0.0);
+        d_JxW[q] *= J;
+    }
+
+    return d_JxW;
+}
+
 template class LagrangeJacobianCalculator<1, 1>;
 template class LagrangeJacobianCalculator<1, 2>;
 template class LagrangeJacobianCalculator<1, 3>;
@@ -286,6 +286,14 @@ HierarchyMathOps::resetLevels(const int coarsest_ln, const int finest_ln)
     TBOX_ASSERT(d_hierarchy);
     TBOX_ASSERT((coarsest_ln >= 0) && (finest_ln >= coarsest_ln) && (finest_ln <= d_hierarchy->getFinestLevelNumber()));
 #endif
+    // Cached data can only be reused if they were previously computed on all
+    // levels of the hierarchy starting from the same coarsest level.
+    if (coarsest_ln != d_coarsest_ln || d_finest_ln != d_hierarchy_fingerprint.getFinestLevelNumber())
+    {
+        d_hierarchy_fingerprint.clear();
+    }
+    const int old_finest_ln = d_hierarchy_fingerprint.getFinestLevelNumber();
+
     // Reset the level numbers.
     d_coarsest_ln = coarsest_ln;
     d_finest_ln = finest_ln;
@@ -294,21 +302,36 @@ HierarchyMathOps::resetLevels(const int coarsest_ln, const int finest_ln)
     d_hier_fc_data_ops->resetLevels(d_coarsest_ln, d_finest_ln);
     d_hier_sc_data_ops->resetLevels(d_coarsest_ln, d_finest_ln);
 
-    // Reset the CoarsenSchedule vectors.
+    // Reset the CoarsenSchedule vectors.  Schedules are only rebuilt if either
+    // of the levels involved has changed.
     d_of_coarsen_scheds.resize(d_finest_ln);
     d_os_coarsen_scheds.resize(d_finest_ln);
     for (int dst_ln = d_coarsest_ln; dst_ln < d_finest_ln; ++dst_ln)
     {
+        if (d_of_coarsen_scheds[dst_ln] && d_os_coarsen_scheds[dst_ln] &&
+            d_hierarchy_fingerprint.levelsAreUnchanged(d_hierarchy, dst_ln, dst_ln + 1))
+        {
+            continue;
+        }
         Pointer<PatchLevel<NDIM> > src_level = d_hierarchy->getPatchLevel(dst_ln + 1);
         Pointer<PatchLevel<NDIM> > dst_level = d_hierarchy->getPatchLevel(dst_ln);
         d_of_coarsen_scheds[dst_ln] = d_of_coarsen_alg->createSchedule(dst_level, src_level);
         d_os_coarsen_scheds[dst_ln] = d_os_coarsen_alg->createSchedule(dst_level, src_level);
     }
 
-    // Reset the cell weights and compute the volume of the domain.
-    resetCellWeights(d_coarsest_ln, d_finest_ln);
-    if (d_using_wgt_fc) resetFaceWeights(d_coarsest_ln, d_finest_ln);
-    if (d_using_wgt_sc) resetSideWeights(d_coarsest_ln, d_finest_ln);
+    // Reset the weights and compute the volume of the domain.  The weights on
+    // each level depend on that level and on the next finer level.
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        const bool level_is_unchanged =
+            d_hierarchy_fingerprint.levelIsUnchanged(d_hierarchy, ln) &&
+            (ln < d_finest_ln ? d_hierarchy_fingerprint.levelIsUnchanged(d_hierarchy, ln + 1) : ln == old_finest_ln);
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        if (!level_is_unchanged || !level->checkAllocated(d_wgt_cc_idx)) resetCellWeights(ln, ln);
+        if (d_using_wgt_fc && (!level_is_unchanged || !level->checkAllocated(d_wgt_fc_idx))) resetFaceWeights(ln, ln);
+        if (d_using_wgt_sc && (!level_is_unchanged || !level->checkAllocated(d_wgt_sc_idx))) resetSideWeights(ln, ln);
+    }
+    d_hierarchy_fingerprint.update(d_hierarchy);
     d_volume = d_hier_cc_data_ops->sumControlVolumes(d_wgt_cc_idx, d_wgt_cc_idx);
 
     // Deallocate scratch data.
@@ -382,6 +405,7 @@ HierarchyMathOps::setCoarsenOperatorName(const std::string& coarsen_op_name)
 {
     d_coarsen_op_name = coarsen_op_name;
     resetCoarsenOperators();
+    d_hierarchy_fingerprint.clear();
     return;
 } // setCoarsenOperatorName
 
@@ -0,0 +1,153 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2019 - 2019 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/CachedCartGridFunction.h"
+#include "ibtk/CartGridFunction.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+
+#include "IntVector.h"
+#include "Patch.h"
+#include "PatchData.h"
+#include "PatchHierarchy.h"
+#include "PatchLevel.h"
+#include "Variable.h"
+#include "VariableContext.h"
+#include "VariableDatabase.h"
+#include "tbox/Pointer.h"
+#include "tbox/Utilities.h"
+
+#include <ostream>
+#include <string>
+#include <utility>
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+CachedCartGridFunction::CachedCartGridFunction(std::string object_name,
+                                               Pointer<CartGridFunction> fcn,
+                                               const bool cache_time_dependent_data)
+    : CartGridFunction(std::move(object_name)), d_fcn(fcn)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_fcn);
+#endif
+    d_use_cache = cache_time_dependent_data || !d_fcn->isTimeDependent();
+    return;
+} // CachedCartGridFunction
+
+void
+CachedCartGridFunction::clearCache(Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                   const int coarsest_ln_in,
+                                   const int finest_ln_in)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(hierarchy);
+#endif
+    const int coarsest_ln = (coarsest_ln_in == -1 ? 0 : coarsest_ln_in);
+    const int finest_ln = (finest_ln_in == -1 ? hierarchy->getFinestLevelNumber() : finest_ln_in);
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (const auto& idx_pair : d_cache_idx_map)
+        {
+            if (level->checkAllocated(idx_pair.second)) level->deallocatePatchData(idx_pair.second);
+        }
+    }
+    return;
+} // clearCache
+
+bool
+CachedCartGridFunction::isTimeDependent() const
+{
+    return !d_use_cache;
+} // isTimeDependent
+
+void
+CachedCartGridFunction::setDataOnPatch(const int data_idx,
+                                       Pointer<Variable<NDIM> > var,
+                                       Pointer<Patch<NDIM> > patch,
+                                       const double data_time,
+                                       const bool initial_time,
+                                       Pointer<PatchLevel<NDIM> > patch_level)
+{
+    if (!d_use_cache || initial_time)
+    {
+        d_fcn->setDataOnPatch(data_idx, var, patch, data_time, initial_time, patch_level);
+        return;
+    }
+
+    // The cached data are only allocated on patches on which the function has
+    // already been evaluated.  New patches created by regridding do not have
+    // any cached data.
+    const int cache_idx = getCacheIndex(data_idx);
+    Pointer<PatchData<NDIM> > data = patch->getPatchData(data_idx);
+    if (patch->checkAllocated(cache_idx))
+    {
+        data->copy(*patch->getPatchData(cache_idx));
+    }
+    else
+    {
+        d_fcn->setDataOnPatch(data_idx, var, patch, data_time, initial_time, patch_level);
+        patch->allocatePatchData(cache_idx, data_time);
+        patch->getPatchData(cache_idx)->copy(*data);
+    }
+    return;
+} // setDataOnPatch
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+int
+CachedCartGridFunction::getCacheIndex(const int data_idx)
+{
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    Pointer<Variable<NDIM> > data_var;
+    if (!var_db->mapIndexToVariable(data_idx, data_var) || !data_var)
+    {
+        TBOX_ERROR(d_object_name << "::getCacheIndex():\n"
+                                 << "  patch data index " << data_idx << " is not associated with a variable\n");
+    }
+
+    // Temporary patch data indices (e.g., those used by CartGridFunctionSet)
+    // may be reused for other variables, so the cache is only reused when it
+    // stores the same variable.
+    auto it = d_cache_idx_map.find(data_idx);
+    if (it != d_cache_idx_map.end())
+    {
+        Pointer<Variable<NDIM> > cache_var;
+        var_db->mapIndexToVariable(it->second, cache_var);
+        if (cache_var == data_var) return it->second;
+    }
+
+    // Register the cached data without ghost cells, so that copying to and
+    // from the cache only affects the patch interior.
+    Pointer<VariableContext> cache_ctx =
+        var_db->getContext(d_object_name + "::CACHE::" + std::to_string(data_idx));
+    const int cache_idx = var_db->registerVariableAndContext(data_var, cache_ctx, IntVector<NDIM>(0));
+    d_cache_idx_map[data_idx] = cache_idx;
+    return cache_idx;
+} // getCacheIndex
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
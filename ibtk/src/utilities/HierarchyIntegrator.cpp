@@ -257,15 +257,29 @@ HierarchyIntegrator::advanceHierarchy(double dt)
         plog << d_object_name << "::advanceHierarchy(): time interval = [" << current_time << "," << new_time
              << "], dt = " << dt << "\n";
 
+    // Begin recording performance telemetry for this time step.
+    if (d_enable_telemetry && !d_parent_integrator)
+    {
+        if (!d_telemetry)
+        {
+            const bool from_restart = RestartManager::getManager()->isFromRestart();
+            d_telemetry.reset(new TelemetryLog(d_telemetry_file_name, d_enable_telemetry_summary, from_restart));
+        }
+        d_telemetry->beginRecord(d_integrator_step, current_time, new_time - current_time);
+    }
+    startTelemetryPhase("advance_hierarchy");
+
     // Regrid the patch hierarchy.
     if (atRegridPoint())
     {
         if (d_enable_logging)
             plog << d_object_name << "::advanceHierarchy(): regridding prior to timestep " << d_integrator_step << "\n";
+        startTelemetryPhase("regrid");
         d_regridding_hierarchy = true;
         regridHierarchy();
         d_regridding_hierarchy = false;
         d_at_regrid_time_step = true;
+        stopTelemetryPhase("regrid");
     }
 
     // Determine the number of cycles and the time step size.
@@ -275,7 +289,9 @@ HierarchyIntegrator::advanceHierarchy(double dt)
     // Execute the preprocessing method of the parent integrator, and
     // recursively execute all preprocessing callbacks registered with the
     // parent and child integrators.
+    startTelemetryPhase("preprocess_integrate_hierarchy");
     preprocessIntegrateHierarchy(current_time, new_time, d_current_num_cycles);
+    stopTelemetryPhase("preprocess_integrate_hierarchy");
 
     // Perform one or more cycles.  In each cycle, execute the integration
     // method of the parent integrator, and recursively execute all integration
@@ -288,14 +304,22 @@ HierarchyIntegrator::advanceHierarchy(double dt)
             plog << d_object_name << "::advanceHierarchy(): executing cycle " << cycle_num + 1 << " of "
                  << d_current_num_cycles << "\n";
         }
+        TelemetryLog* const telemetry = getTelemetryLog();
+        const std::string cycle_phase_name =
+            telemetry ? "integrate_hierarchy_cycle_" + std::to_string(cycle_num) : std::string();
+        if (telemetry) telemetry->startPhase(cycle_phase_name);
         integrateHierarchy(current_time, new_time, cycle_num);
+        if (telemetry) telemetry->stopPhase(cycle_phase_name);
     }
 
     // Execute the postprocessing method of the parent integrator, and
     // recursively execute all postprocessing callbacks registered with the
     // parent and child integrators.
     static const bool skip_synchronize_new_state_data = true;
+    startTelemetryPhase("postprocess_integrate_hierarchy");
     postprocessIntegrateHierarchy(current_time, new_time, skip_synchronize_new_state_data, d_current_num_cycles);
+    stopTelemetryPhase("postprocess_integrate_hierarchy");
+    recordTelemetryValue("num_cycles", d_current_num_cycles);
 
     // Ensure that the current values of num_cycles, cycle_num, and dt are
     // reset.
@@ -313,14 +337,35 @@ HierarchyIntegrator::advanceHierarchy(double dt)
 
     // Synchronize the updated data.
     if (d_enable_logging) plog << d_object_name << "::advanceHierarchy(): synchronizing updated data\n";
+    startTelemetryPhase("synchronize_hierarchy_data");
     synchronizeHierarchyData(NEW_DATA);
+    stopTelemetryPhase("synchronize_hierarchy_data");
 
     // Reset all time dependent data.
     if (d_enable_logging) plog << d_object_name << "::advanceHierarchy(): resetting time dependent data\n";
+    startTelemetryPhase("reset_time_dependent_hierarchy_data");
     resetTimeDependentHierarchyData(new_time);
+    stopTelemetryPhase("reset_time_dependent_hierarchy_data");
 
     // Reset the regrid indicator.
     d_at_regrid_time_step = false;
+
+    // Finish recording performance telemetry for this time step.
+    stopTelemetryPhase("advance_hierarchy");
+    if (d_telemetry && d_telemetry->isRecording())
+    {
+        int num_local_cells = 0;
+        for (int ln = 0; ln <= d_hierarchy->getFinestLevelNumber(); ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                num_local_cells += level->getPatch(p())->getBox().size();
+            }
+        }
+        d_telemetry->addValue("num_local_cells", num_local_cells);
+        d_telemetry->endRecord();
+    }
     return;
 } // advanceHierarchy
 
@@ -577,6 +622,37 @@ HierarchyIntegrator::setupPlotData()
     return;
 } // setupPlotData
 
+TelemetryLog*
+HierarchyIntegrator::getTelemetryLog() const
+{
+    if (d_parent_integrator) return d_parent_integrator->getTelemetryLog();
+    return d_telemetry.get();
+} // getTelemetryLog
+
+void
+HierarchyIntegrator::startTelemetryPhase(const std::string& name) const
+{
+    TelemetryLog* const telemetry = getTelemetryLog();
+    if (telemetry) telemetry->startPhase(name);
+    return;
+} // startTelemetryPhase
+
+void
+HierarchyIntegrator::stopTelemetryPhase(const std::string& name) const
+{
+    TelemetryLog* const telemetry = getTelemetryLog();
+    if (telemetry) telemetry->stopPhase(name);
+    return;
+} // stopTelemetryPhase
+
+void
+HierarchyIntegrator::recordTelemetryValue(const std::string& name, const double value) const
+{
+    TelemetryLog* const telemetry = getTelemetryLog();
+    if (telemetry) telemetry->addValue(name, value);
+    return;
+} // recordTelemetryValue
+
 int
 HierarchyIntegrator::getNumberOfCycles() const
 {
@@ -1601,6 +1677,10 @@ HierarchyIntegrator::getFromInput(Pointer<Database> db, bool is_from_restart)
             d_enable_logging_solver_iterations = d_enable_logging;
         }
     }
+    if (db->keyExists("enable_telemetry")) d_enable_telemetry = db->getBool("enable_telemetry");
+    if (db->keyExists("enable_telemetry_summary"))
+        d_enable_telemetry_summary = db->getBool("enable_telemetry_summary");
+    d_telemetry_file_name = db->getStringWithDefault("telemetry_file_name", d_object_name + ".telemetry");
     if (db->keyExists("bdry_extrap_type")) d_bdry_extrap_type = db->getString("bdry_extrap_type");
     if (db->keyExists("tag_buffer")) d_tag_buffer = db->getIntegerArray("tag_buffer");
     return;
@@ -19,6 +19,8 @@
 #include "tbox/SAMRAI_MPI.h"
 #include "tbox/Utilities.h"
 
+#include <mpi.h>
+
 #include <algorithm>
 #include <map>
 #include <ostream>
@@ -65,43 +67,62 @@ void
 ParallelEdgeMap::communicateData()
 {
     const int size = SAMRAI_MPI::getNodes();
-    const int rank = SAMRAI_MPI::getRank();
+    MPI_Comm communicator = SAMRAI_MPI::getCommunicator();
 
+    // Determine how many edges have been registered for addition and removal
+    // on each process.
+    const int num_local_additions_and_removals[2] = { static_cast<int>(d_pending_additions.size()),
+                                                      static_cast<int>(d_pending_removals.size()) };
     std::vector<int> num_additions_and_removals(2 * size, 0);
-    num_additions_and_removals[2 * rank] = static_cast<int>(d_pending_additions.size());
-    num_additions_and_removals[2 * rank + 1] = static_cast<int>(d_pending_removals.size());
-    SAMRAI_MPI::sumReduction(&num_additions_and_removals[0], 2 * size);
+    MPI_Allgather(
+        num_local_additions_and_removals, 2, MPI_INT, &num_additions_and_removals[0], 2, MPI_INT, communicator);
 
-    int num_transactions = 0, offset = 0;
+    static const int SIZE = 3;
+    std::vector<int> recv_counts(size, 0), recv_displs(size, 0);
+    int num_transactions = 0;
     for (int k = 0; k < size; ++k)
     {
-        int size_k = num_additions_and_removals[2 * k] + num_additions_and_removals[2 * k + 1];
+        const int size_k = num_additions_and_removals[2 * k] + num_additions_and_removals[2 * k + 1];
+        recv_counts[k] = SIZE * size_k;
+        recv_displs[k] = SIZE * num_transactions;
         num_transactions += size_k;
-        if (k < rank)
-        {
-            offset += size_k;
-        }
     }
 
     if (num_transactions == 0) return;
 
-    static const int SIZE = 3;
-    std::vector<int> transactions(SIZE * num_transactions, 0);
-    for (auto cit = d_pending_additions.begin(); cit != d_pending_additions.end(); ++cit, ++offset)
+    // Gather the transactions from all processes.  The transactions from each
+    // process are stored contiguously, with the additions preceding the
+    // removals.
+    std::vector<int> local_transactions;
+    local_transactions.reserve(SIZE * (d_pending_additions.size() + d_pending_removals.size()));
+    for (const auto& pending_addition : d_pending_additions)
     {
-        transactions[SIZE * offset] = cit->first;
-        transactions[SIZE * offset + 1] = cit->second.first;
-        transactions[SIZE * offset + 2] = cit->second.second;
+        local_transactions.push_back(pending_addition.first);
+        local_transactions.push_back(pending_addition.second.first);
+        local_transactions.push_back(pending_addition.second.second);
     }
-    for (auto cit = d_pending_removals.begin(); cit != d_pending_removals.end(); ++cit, ++offset)
+    for (const auto& pending_removal : d_pending_removals)
     {
-        transactions[SIZE * offset] = cit->first;
-        transactions[SIZE * offset + 1] = cit->second.first;
-        transactions[SIZE * offset + 2] = cit->second.second;
+        local_transactions.push_back(pending_removal.first);
+        local_transactions.push_back(pending_removal.second.first);
+        local_transactions.push_back(pending_removal.second.second);
     }
-    SAMRAI_MPI::sumReduction(&transactions[0], SIZE * num_transactions);
-
-    offset = 0;
+    std::vector<int> transactions(SIZE * num_transactions, 0);
+    MPI_Allgatherv(local_transactions.data(),
+                   static_cast<int>(local_transactions.size()),
+                   MPI_INT,
+                   &transactions[0],
+                   &recv_counts[0],
+                   &recv_displs[0],
+                   MPI_INT,
+                   communicator);
+
+    // The gathered transactions include the ones registered on this process,
+    // so the local lists are rebuilt from the gathered data to ensure that each
+    // transaction is applied exactly once.
+    d_pending_additions.clear();
+    d_pending_removals.clear();
+    int offset = 0;
     for (int k = 0; k < size; ++k)
     {
         for (int t = 0; t < num_additions_and_removals[2 * k]; ++t, ++offset)
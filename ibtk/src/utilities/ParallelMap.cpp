@@ -25,6 +25,8 @@
 #include "tbox/SAMRAI_MPI.h"
 #include "tbox/Utilities.h"
 
+#include <mpi.h>
+
 #include <map>
 #include <ostream>
 #include <utility>
@@ -69,49 +71,77 @@ ParallelMap::communicateData()
 {
     const int size = SAMRAI_MPI::getNodes();
     const int rank = SAMRAI_MPI::getRank();
+    MPI_Comm communicator = SAMRAI_MPI::getCommunicator();
+    StreamableManager* streamable_manager = StreamableManager::getManager();
+
+    // Get the local values to send.
+    std::vector<int> keys_to_send;
+    std::vector<tbox::Pointer<Streamable> > data_items_to_send;
+    for (const auto& pending_addition : d_pending_additions)
+    {
+        keys_to_send.push_back(pending_addition.first);
+        data_items_to_send.push_back(pending_addition.second);
+    }
+    const int num_local_additions = static_cast<int>(keys_to_send.size());
+    const int local_data_sz =
+        num_local_additions > 0 ?
+            static_cast<int>(tbox::AbstractStream::sizeofInt() * keys_to_send.size() +
+                             streamable_manager->getDataStreamSize(data_items_to_send)) :
+            0;
+
+    // Determine how many keys have been registered for addition and removal on
+    // each process, along with the amount of data to be sent by each process.
+    static const int SIZE = 3;
+    const int local_counts[SIZE] = { num_local_additions,
+                                     local_data_sz,
+                                     static_cast<int>(d_pending_removals.size()) };
+    std::vector<int> counts(SIZE * size, 0);
+    MPI_Allgather(local_counts, SIZE, MPI_INT, &counts[0], SIZE, MPI_INT, communicator);
+
+    std::vector<int> data_sz(size, 0), data_displs(size, 0), num_removals(size, 0), removal_displs(size, 0);
+    int total_data_sz = 0, total_num_removals = 0;
+    for (int k = 0; k < size; ++k)
+    {
+        data_sz[k] = counts[SIZE * k + 1];
+        data_displs[k] = total_data_sz;
+        total_data_sz += data_sz[k];
+        num_removals[k] = counts[SIZE * k + 2];
+        removal_displs[k] = total_num_removals;
+        total_num_removals += num_removals[k];
+    }
 
     // Add items to the map.
-    if (SAMRAI_MPI::maxReduction(static_cast<int>(d_pending_additions.size())) > 0)
+    if (total_data_sz > 0)
     {
-        StreamableManager* streamable_manager = StreamableManager::getManager();
-
-        // Determine how many keys have been registered for addition on each
-        // process.
-        std::vector<int> num_additions(size, 0);
-        num_additions[rank] = static_cast<int>(d_pending_additions.size());
-        SAMRAI_MPI::sumReduction(&num_additions[0], size);
-
-        // Get the local values to send and determine the amount of data to be
-        // broadcast by each process.
-        std::vector<int> keys_to_send;
-        std::vector<tbox::Pointer<Streamable> > data_items_to_send;
-        for (const auto& pending_addition : d_pending_additions)
+        // Pack the local data and gather the data from all processes.
+        FixedSizedStream send_stream(local_data_sz);
+        const void* send_buffer = nullptr;
+        if (num_local_additions > 0)
         {
-            keys_to_send.push_back(pending_addition.first);
-            data_items_to_send.push_back(pending_addition.second);
+            send_stream.pack(&keys_to_send[0], num_local_additions);
+            streamable_manager->packStream(send_stream, data_items_to_send);
+            send_buffer = send_stream.getBufferStart();
         }
-        std::vector<int> data_sz(size, 0);
-        data_sz[rank] = static_cast<int>(tbox::AbstractStream::sizeofInt() * keys_to_send.size() +
-                                         streamable_manager->getDataStreamSize(data_items_to_send));
-        SAMRAI_MPI::sumReduction(&data_sz[0], size);
-
-        // Broadcast data from each process.
+#if !defined(NDEBUG)
+        TBOX_ASSERT(send_stream.getCurrentSize() == local_data_sz);
+#endif
+        std::vector<char> buffer(total_data_sz);
+        MPI_Allgatherv(send_buffer,
+                       local_data_sz,
+                       MPI_CHAR,
+                       &buffer[0],
+                       &data_sz[0],
+                       &data_displs[0],
+                       MPI_CHAR,
+                       communicator);
+
+        // Unpack the data in the order of the sending processes.
         for (int sending_proc = 0; sending_proc < size; ++sending_proc)
         {
-            int num_keys = num_additions[sending_proc];
+            const int num_keys = counts[SIZE * sending_proc];
             if (num_keys == 0) continue;
             if (sending_proc == rank)
             {
-                // Pack and broadcast data on process sending_proc.
-                FixedSizedStream stream(data_sz[sending_proc]);
-                stream.pack(&keys_to_send[0], static_cast<int>(keys_to_send.size()));
-                streamable_manager->packStream(stream, data_items_to_send);
-                int data_size = stream.getCurrentSize();
-#if !defined(NDEBUG)
-                TBOX_ASSERT(static_cast<int>(d_pending_additions.size()) == num_keys);
-                TBOX_ASSERT(data_size == data_sz[sending_proc]);
-#endif
-                SAMRAI_MPI::bcast(static_cast<char*>(stream.getBufferStart()), data_size, sending_proc);
                 for (int k = 0; k < num_keys; ++k)
                 {
                     d_map[keys_to_send[k]] = data_items_to_send[k];
@@ -119,14 +149,7 @@ ParallelMap::communicateData()
             }
             else
             {
-                // Receive and unpack data broadcast from process sending_proc.
-                std::vector<char> buffer(data_sz[sending_proc]);
-                int data_size = data_sz[sending_proc];
-                SAMRAI_MPI::bcast(&buffer[0], data_size, sending_proc);
-#if !defined(NDEBUG)
-                TBOX_ASSERT(data_size == data_sz[sending_proc]);
-#endif
-                FixedSizedStream stream(&buffer[0], data_size);
+                FixedSizedStream stream(&buffer[data_displs[sending_proc]], data_sz[sending_proc]);
                 std::vector<int> keys_received(num_keys);
                 stream.unpack(&keys_received[0], num_keys);
                 std::vector<tbox::Pointer<Streamable> > data_items_received;
@@ -147,41 +170,20 @@ ParallelMap::communicateData()
     }
 
     // Remove items from the map.
-    if (SAMRAI_MPI::maxReduction(static_cast<int>(d_pending_removals.size())) > 0)
+    if (total_num_removals > 0)
     {
-        // Determine how many keys have been registered for removal on each
-        // process.
-        std::vector<int> num_removals(size, 0);
-        num_removals[rank] = static_cast<int>(d_pending_removals.size());
-        SAMRAI_MPI::sumReduction(&num_removals[0], size);
-
-        // Broadcast data from each process.
-        for (int sending_proc = 0; sending_proc < size; ++sending_proc)
+        std::vector<int> keys_received(total_num_removals);
+        MPI_Allgatherv(d_pending_removals.data(),
+                       num_removals[rank],
+                       MPI_INT,
+                       &keys_received[0],
+                       &num_removals[0],
+                       &removal_displs[0],
+                       MPI_INT,
+                       communicator);
+        for (const auto& key : keys_received)
         {
-            int num_keys = num_removals[sending_proc];
-            if (num_keys == 0) continue;
-            if (sending_proc == rank)
-            {
-// Pack and broadcast data on process sending_proc.
-#if !defined(NDEBUG)
-                TBOX_ASSERT(static_cast<int>(d_pending_removals.size()) == num_keys);
-#endif
-                SAMRAI_MPI::bcast(&d_pending_removals[0], num_keys, sending_proc);
-                for (int k = 0; k < num_keys; ++k)
-                {
-                    d_map.erase(d_pending_removals[k]);
-                }
-            }
-            else
-            {
-                // Receive and unpack data broadcast from process sending_proc.
-                std::vector<int> keys_received(num_removals[sending_proc]);
-                SAMRAI_MPI::bcast(&keys_received[0], num_keys, sending_proc);
-                for (int k = 0; k < num_keys; ++k)
-                {
-                    d_map.erase(keys_received[k]);
-                }
-            }
+            d_map.erase(key);
         }
 
         // Clear the set of pending removals.
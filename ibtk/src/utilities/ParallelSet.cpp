@@ -19,6 +19,8 @@
 #include "tbox/SAMRAI_MPI.h"
 #include "tbox/Utilities.h"
 
+#include <mpi.h>
+
 #include <ostream>
 #include <set>
 #include <vector>
@@ -61,91 +63,60 @@ void
 ParallelSet::communicateData()
 {
     const int size = SAMRAI_MPI::getNodes();
-    const int rank = SAMRAI_MPI::getRank();
-
-    // Add items from the set.
-    if (SAMRAI_MPI::maxReduction(static_cast<int>(d_pending_additions.size())) > 0)
+    MPI_Comm communicator = SAMRAI_MPI::getCommunicator();
+
+    // Determine how many keys have been registered for addition and removal on
+    // each process.
+    const int num_local_keys[2] = { static_cast<int>(d_pending_additions.size()),
+                                    static_cast<int>(d_pending_removals.size()) };
+    std::vector<int> num_keys(2 * size, 0);
+    MPI_Allgather(num_local_keys, 2, MPI_INT, &num_keys[0], 2, MPI_INT, communicator);
+
+    std::vector<int> recv_counts(size, 0), recv_displs(size, 0);
+    int num_transactions = 0;
+    for (int k = 0; k < size; ++k)
+    {
+        recv_counts[k] = num_keys[2 * k] + num_keys[2 * k + 1];
+        recv_displs[k] = num_transactions;
+        num_transactions += recv_counts[k];
+    }
+    if (num_transactions == 0) return;
+
+    // Gather the keys from all processes.  The keys from each process are
+    // stored contiguously, with the additions preceding the removals.
+    std::vector<int> keys_to_send(d_pending_additions);
+    keys_to_send.insert(keys_to_send.end(), d_pending_removals.begin(), d_pending_removals.end());
+    std::vector<int> keys_received(num_transactions);
+    MPI_Allgatherv(keys_to_send.data(),
+                   static_cast<int>(keys_to_send.size()),
+                   MPI_INT,
+                   &keys_received[0],
+                   &recv_counts[0],
+                   &recv_displs[0],
+                   MPI_INT,
+                   communicator);
+
+    // Add items to the set.
+    for (int k = 0; k < size; ++k)
     {
-        // Determine how many keys have been registered for addition on each
-        // process.
-        std::vector<int> num_additions(size, 0);
-        num_additions[rank] = static_cast<int>(d_pending_additions.size());
-        SAMRAI_MPI::sumReduction(&num_additions[0], size);
-
-        // Broadcast data from each process.
-        for (int sending_proc = 0; sending_proc < size; ++sending_proc)
+        for (int i = 0; i < num_keys[2 * k]; ++i)
         {
-            int num_keys = num_additions[sending_proc];
-            if (num_keys == 0) continue;
-            if (sending_proc == rank)
-            {
-// Pack and broadcast data on process sending_proc.
-#if !defined(NDEBUG)
-                TBOX_ASSERT(static_cast<int>(d_pending_additions.size()) == num_keys);
-#endif
-                SAMRAI_MPI::bcast(&d_pending_additions[0], num_keys, sending_proc);
-                for (int k = 0; k < num_keys; ++k)
-                {
-                    d_set.insert(d_pending_additions[k]);
-                }
-            }
-            else
-            {
-                // Receive and unpack data broadcast from process sending_proc.
-                std::vector<int> keys_received(num_additions[sending_proc]);
-                SAMRAI_MPI::bcast(&keys_received[0], num_keys, sending_proc);
-                for (int k = 0; k < num_keys; ++k)
-                {
-                    d_set.insert(keys_received[k]);
-                }
-            }
+            d_set.insert(keys_received[recv_displs[k] + i]);
         }
-
-        // Clear the set of pending additions.
-        d_pending_additions.clear();
     }
 
     // Remove items from the set.
-    if (SAMRAI_MPI::maxReduction(static_cast<int>(d_pending_removals.size())) > 0)
+    for (int k = 0; k < size; ++k)
     {
-        // Determine how many keys have been registered for removal on each
-        // process.
-        std::vector<int> num_removals(size, 0);
-        num_removals[rank] = static_cast<int>(d_pending_removals.size());
-        SAMRAI_MPI::sumReduction(&num_removals[0], size);
-
-        // Broadcast data from each process.
-        for (int sending_proc = 0; sending_proc < size; ++sending_proc)
+        for (int i = 0; i < num_keys[2 * k + 1]; ++i)
         {
-            int num_keys = num_removals[sending_proc];
-            if (num_keys == 0) continue;
-            if (sending_proc == rank)
-            {
-// Pack and broadcast data on process sending_proc.
-#if !defined(NDEBUG)
-                TBOX_ASSERT(static_cast<int>(d_pending_removals.size()) == num_keys);
-#endif
-                SAMRAI_MPI::bcast(&d_pending_removals[0], num_keys, sending_proc);
-                for (int k = 0; k < num_keys; ++k)
-                {
-                    d_set.erase(d_pending_removals[k]);
-                }
-            }
-            else
-            {
-                // Receive and unpack data broadcast from process sending_proc.
-                std::vector<int> keys_received(num_removals[sending_proc]);
-                SAMRAI_MPI::bcast(&keys_received[0], num_keys, sending_proc);
-                for (int k = 0; k < num_keys; ++k)
-                {
-                    d_set.erase(keys_received[k]);
-                }
-            }
+            d_set.erase(keys_received[recv_displs[k] + num_keys[2 * k] + i]);
         }
-
-        // Clear the set of pending removals.
-        d_pending_removals.clear();
     }
+
+    // Clear the pending additions and removals.
+    d_pending_additions.clear();
+    d_pending_removals.clear();
     return;
 } // communicateData
 
@@ -0,0 +1,110 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2019 - 2019 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/PatchHierarchyFingerprint.h"
+#include "ibtk/ibtk_utilities.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+
+#include "Box.h"
+#include "BoxArray.h"
+#include "IntVector.h"
+#include "PatchHierarchy.h"
+#include "PatchLevel.h"
+#include "ProcessorMapping.h"
+#include "tbox/Pointer.h"
+
+#include <vector>
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+void
+PatchHierarchyFingerprint::update(Pointer<PatchHierarchy<NDIM> > hierarchy)
+{
+    const int finest_ln = hierarchy->getFinestLevelNumber();
+    d_levels.resize(finest_ln + 1);
+    d_level_layouts.resize(finest_ln + 1);
+    for (int ln = 0; ln <= finest_ln; ++ln)
+    {
+        d_levels[ln] = hierarchy->getPatchLevel(ln);
+        d_level_layouts[ln] = computeLevelLayout(d_levels[ln]);
+    }
+    return;
+} // update
+
+void
+PatchHierarchyFingerprint::clear()
+{
+    d_levels.clear();
+    d_level_layouts.clear();
+    return;
+} // clear
+
+int
+PatchHierarchyFingerprint::getFinestLevelNumber() const
+{
+    return d_levels.empty() ? invalid_level_number : static_cast<int>(d_levels.size()) - 1;
+} // getFinestLevelNumber
+
+bool
+PatchHierarchyFingerprint::levelIsUnchanged(Pointer<PatchHierarchy<NDIM> > hierarchy, const int ln) const
+{
+    if (ln < 0 || ln > getFinestLevelNumber() || ln > hierarchy->getFinestLevelNumber()) return false;
+    Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+    if (level.getPointer() != d_levels[ln].getPointer()) return false;
+    return computeLevelLayout(level) == d_level_layouts[ln];
+} // levelIsUnchanged
+
+bool
+PatchHierarchyFingerprint::levelsAreUnchanged(Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                              const int coarsest_ln,
+                                              const int finest_ln) const
+{
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        if (!levelIsUnchanged(hierarchy, ln)) return false;
+    }
+    return true;
+} // levelsAreUnchanged
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+std::vector<int>
+PatchHierarchyFingerprint::computeLevelLayout(Pointer<PatchLevel<NDIM> > level)
+{
+    const BoxArray<NDIM>& boxes = level->getBoxes();
+    const ProcessorMapping& mapping = level->getProcessorMapping();
+    const IntVector<NDIM>& ratio = level->getRatio();
+    std::vector<int> layout;
+    layout.reserve(NDIM + boxes.getNumberOfBoxes() * (2 * NDIM + 1));
+    for (unsigned int d = 0; d < NDIM; ++d) layout.push_back(ratio(d));
+    for (int i = 0; i < boxes.getNumberOfBoxes(); ++i)
+    {
+        const Box<NDIM>& box = boxes[i];
+        for (unsigned int d = 0; d < NDIM; ++d) layout.push_back(box.lower()(d));
+        for (unsigned int d = 0; d < NDIM; ++d) layout.push_back(box.upper()(d));
+        layout.push_back(mapping.getProcessorAssignment(i));
+    }
+    return layout;
+} // computeLevelLayout
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -158,6 +158,9 @@ SideDataSynchronization::initializeOperatorState(
         d_refine_scheds[ln] = d_refine_alg->createSchedule(level);
     }
 
+    // Record the configuration of the hierarchy.
+    d_hierarchy_fingerprint.update(d_hierarchy);
+
     // Indicate the operator is initialized.
     d_is_initialized = true;
     return;
@@ -259,6 +262,52 @@ SideDataSynchronization::resetTransactionComponents(
     return;
 } // resetTransactionComponents
 
+void
+SideDataSynchronization::reinitializeOperatorState(Pointer<PatchHierarchy<NDIM> > hierarchy)
+{
+    if (!d_is_initialized) return;
+
+    if (hierarchy.getPointer() != d_hierarchy.getPointer())
+    {
+        initializeOperatorState(d_transaction_comps, hierarchy);
+        return;
+    }
+
+    // Rebuild the coarsen schedules that involve levels that have changed.
+    bool registered_coarsen_op = false;
+    for (const auto& transaction_comp : d_transaction_comps)
+    {
+        if (transaction_comp.d_coarsen_op_name != "NONE") registered_coarsen_op = true;
+    }
+    d_finest_ln = d_hierarchy->getFinestLevelNumber();
+    CoarsenPatchStrategy<NDIM>* coarsen_strategy = nullptr;
+    d_coarsen_scheds.resize(d_finest_ln + 1);
+    if (registered_coarsen_op)
+    {
+        for (int ln = d_coarsest_ln + 1; ln <= d_finest_ln; ++ln)
+        {
+            if (d_coarsen_scheds[ln] && d_hierarchy_fingerprint.levelsAreUnchanged(d_hierarchy, ln - 1, ln)) continue;
+            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+            Pointer<PatchLevel<NDIM> > coarser_level = d_hierarchy->getPatchLevel(ln - 1);
+            d_coarsen_scheds[ln] = d_coarsen_alg->createSchedule(coarser_level, level, coarsen_strategy);
+        }
+    }
+
+    // Rebuild the refine schedules for levels that have changed.  These
+    // schedules only involve a single level.
+    d_refine_scheds.resize(d_finest_ln + 1);
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        if (d_refine_scheds[ln] && d_hierarchy_fingerprint.levelIsUnchanged(d_hierarchy, ln)) continue;
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        d_refine_scheds[ln] = d_refine_alg->createSchedule(level);
+    }
+
+    // Record the new configuration of the hierarchy.
+    d_hierarchy_fingerprint.update(d_hierarchy);
+    return;
+} // reinitializeOperatorState
+
 void
 SideDataSynchronization::deallocateOperatorState()
 {
@@ -271,6 +320,8 @@ SideDataSynchronization::deallocateOperatorState()
     d_refine_alg.setNull();
     d_refine_scheds.clear();
 
+    d_hierarchy_fingerprint.clear();
+
     // Indicate that the operator is NOT initialized.
     d_is_initialized = false;
     return;
@@ -0,0 +1,230 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2019 - 2019 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/TelemetryLog.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+
+#include "tbox/SAMRAI_MPI.h"
+#include "tbox/Utilities.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <ios>
+#include <string>
+#include <utility>
+#include <vector>
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+static const int TELEMETRY_PRECISION = 12;
+
+// Compute a 32-bit FNV-1a hash of the names of the recorded quantities.  The
+// hash is exactly representable as a double, so that it can be reduced along
+// with the recorded values.
+double
+hash_names(const std::vector<std::pair<std::string, double> >& values)
+{
+    static const std::uint32_t FNV_OFFSET_BASIS = 2166136261u;
+    static const std::uint32_t FNV_PRIME = 16777619u;
+    std::uint32_t hash = FNV_OFFSET_BASIS;
+    for (const auto& name_value_pair : values)
+    {
+        // Include the terminating null character so that, e.g., the names
+        // "ab","c" and "a","bc" hash differently.
+        for (const char c : name_value_pair.first)
+        {
+            hash = (hash ^ static_cast<unsigned char>(c)) * FNV_PRIME;
+        }
+        hash *= FNV_PRIME;
+    }
+    return static_cast<double>(hash);
+} // hash_names
+} // namespace
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+TelemetryLog::TelemetryLog(const std::string& file_name, const bool write_summary, const bool append)
+    : d_write_summary(write_summary)
+{
+    const std::ios_base::openmode mode = append ? std::ios_base::app : std::ios_base::out;
+    const std::string header = "step,time,dt,quantity,value";
+    const int rank = SAMRAI_MPI::getRank();
+    d_stream.open(file_name + "." + std::to_string(rank) + ".csv", mode);
+    if (!d_stream.is_open())
+    {
+        TBOX_ERROR("TelemetryLog::TelemetryLog():\n"
+                   << "  unable to open file " << file_name << "." << rank << ".csv\n");
+    }
+    d_stream << std::setprecision(TELEMETRY_PRECISION);
+    if (!append) d_stream << header << "\n";
+    if (d_write_summary && rank == 0)
+    {
+        d_summary_stream.open(file_name + ".summary.csv", mode);
+        if (!d_summary_stream.is_open())
+        {
+            TBOX_ERROR("TelemetryLog::TelemetryLog():\n"
+                       << "  unable to open file " << file_name << ".summary.csv\n");
+        }
+        d_summary_stream << std::setprecision(TELEMETRY_PRECISION);
+        if (!append) d_summary_stream << "step,time,dt,quantity,min,mean,max\n";
+    }
+    return;
+} // TelemetryLog
+
+TelemetryLog::~TelemetryLog()
+{
+    if (d_recording) endRecord();
+    return;
+} // ~TelemetryLog
+
+void
+TelemetryLog::beginRecord(const int step, const double time, const double dt)
+{
+    if (d_recording)
+    {
+        TBOX_ERROR("TelemetryLog::beginRecord():\n"
+                   << "  record for step " << d_step << " has not been finished.\n");
+    }
+    d_recording = true;
+    d_step = step;
+    d_time = time;
+    d_dt = dt;
+    d_values.clear();
+    d_phase_start_times.clear();
+    return;
+} // beginRecord
+
+void
+TelemetryLog::endRecord()
+{
+    if (!d_recording) return;
+    for (const auto& name_value_pair : d_values)
+    {
+        d_stream << d_step << "," << d_time << "," << d_dt << "," << name_value_pair.first << ","
+                 << name_value_pair.second << "\n";
+    }
+    d_stream.flush();
+    if (d_write_summary) writeSummary();
+    d_recording = false;
+    return;
+} // endRecord
+
+bool
+TelemetryLog::isRecording() const
+{
+    return d_recording;
+} // isRecording
+
+void
+TelemetryLog::startPhase(const std::string& name)
+{
+    if (!d_recording) return;
+    d_phase_start_times[name] = std::chrono::steady_clock::now();
+    return;
+} // startPhase
+
+void
+TelemetryLog::stopPhase(const std::string& name)
+{
+    if (!d_recording) return;
+    const auto it = d_phase_start_times.find(name);
+    if (it == d_phase_start_times.end())
+    {
+        TBOX_ERROR("TelemetryLog::stopPhase():\n"
+                   << "  phase " << name << " was not started.\n");
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - it->second;
+    d_phase_start_times.erase(it);
+    addValue(name, elapsed.count());
+    return;
+} // stopPhase
+
+void
+TelemetryLog::addValue(const std::string& name, const double value)
+{
+    if (!d_recording) return;
+    auto it = std::find_if(d_values.begin(),
+                           d_values.end(),
+                           [&name](const std::pair<std::string, double>& v) { return v.first == name; });
+    if (it == d_values.end())
+    {
+        d_values.emplace_back(name, value);
+    }
+    else
+    {
+        it->second += value;
+    }
+    return;
+} // addValue
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+TelemetryLog::writeSummary()
+{
+    // Check that all processes have recorded the same quantities in the same
+    // order by comparing the number of quantities and a hash of their names.
+    // Both are compared with a single reduction by negating the values used to
+    // compute the maxima.
+    const int n_values = static_cast<int>(d_values.size());
+    const double names_hash = hash_names(d_values);
+    std::array<double, 4> check_vals = { { static_cast<double>(n_values), -static_cast<double>(n_values), names_hash,
+                                           -names_hash } };
+    SAMRAI_MPI::minReduction(check_vals.data(), static_cast<int>(check_vals.size()));
+    if (check_vals[0] != -check_vals[1] || check_vals[2] != -check_vals[3])
+    {
+        TBOX_ERROR("TelemetryLog::writeSummary():\n"
+                   << "  all processes must record the same quantities in the same order when summaries are "
+                      "enabled.\n"
+                   << "  step " << d_step << " recorded different quantities on different processes.\n");
+    }
+    if (n_values == 0) return;
+
+    // Compute minima and maxima with a single reduction by negating the values
+    // used to compute the maxima.
+    std::vector<double> min_vals(2 * n_values), sum_vals(n_values);
+    for (int k = 0; k < n_values; ++k)
+    {
+        min_vals[k] = d_values[k].second;
+        min_vals[n_values + k] = -d_values[k].second;
+        sum_vals[k] = d_values[k].second;
+    }
+    SAMRAI_MPI::minReduction(min_vals.data(), 2 * n_values);
+    SAMRAI_MPI::sumReduction(sum_vals.data(), n_values);
+    if (SAMRAI_MPI::getRank() != 0) return;
+    const int nodes = SAMRAI_MPI::getNodes();
+    for (int k = 0; k < n_values; ++k)
+    {
+        d_summary_stream << d_step << "," << d_time << "," << d_dt << "," << d_values[k].first << "," << min_vals[k]
+                         << "," << sum_vals[k] / static_cast<double>(nodes) << "," << -min_vals[n_values + k] << "\n";
+    }
+    d_summary_stream.flush();
+    return;
+} // writeSummary
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -251,13 +251,41 @@ muParserCartGridFunction::muParserCartGridFunction(std::string object_name,
             parser.DefineVar("x_" + postfix, &(d_parser_posn[d]));
         }
     }
+
+    // Functions that do not use the time variable may be treated as
+    // time-independent.
+    if (input_db->keyExists("is_time_dependent")) d_is_time_dependent = input_db->getBool("is_time_dependent");
+    if (!d_is_time_dependent)
+    {
+        for (unsigned int k = 0; k < d_parsers.size(); ++k)
+        {
+            bool uses_time = false;
+            try
+            {
+                const mu::varmap_type& used_vars = d_parsers[k].GetUsedVar();
+                uses_time = used_vars.count("t") || used_vars.count("T");
+            }
+            catch (mu::ParserError& e)
+            {
+                TBOX_ERROR("muParserCartGridFunction::muParserCartGridFunction():\n"
+                           << "  error: " << e.GetMsg() << "\n"
+                           << "  in:    " << e.GetExpr() << "\n");
+            }
+            if (uses_time)
+            {
+                TBOX_ERROR("muParserCartGridFunction::muParserCartGridFunction():\n"
+                           << "  is_time_dependent = FALSE but function " << d_function_strings[k]
+                           << " depends on time." << std::endl);
+            }
+        }
+    }
     return;
 } // muParserCartGridFunction
 
 bool
 muParserCartGridFunction::isTimeDependent() const
 {
-    return true;
+    return d_is_time_dependent;
 } // isTimeDependent
 
 void
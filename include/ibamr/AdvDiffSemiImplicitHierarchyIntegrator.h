@@ -29,6 +29,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <vector>
 
 namespace IBAMR
 {
@@ -76,6 +77,17 @@ namespace IBAMR
  *
  * Various options are available for the spatial and temporal discretizations.
  *
+ * When the input database entry <code>share_helmholtz_solvers</code> is set to
+ * <code>TRUE</code>, quantities with the same depth, diffusion and damping
+ * coefficients, diffusion time stepping type, and boundary condition objects
+ * share a single Helmholtz solver and right-hand-side operator.  This avoids
+ * redundant solver initialization when many such quantities (e.g., chemical
+ * species) are transported.  Only the solver objects are shared: each quantity
+ * is still filled and solved separately.  Quantities whose Helmholtz solver or
+ * right-hand-side operator is set (or retrieved) by the user before the
+ * integrator is initialized are never grouped, so user-provided solvers are
+ * always used.
+ *
  * \see HierarchyIntegrator
  * \see SAMRAI::mesh::StandardTagAndInitStrategy
  * \see SAMRAI::algs::TimeRefinementIntegrator
@@ -341,6 +353,19 @@ protected:
         d_Q_convective_op;
     std::map<SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> >, bool> d_Q_convective_op_needs_init;
 
+    /*!
+     * Helmholtz solver sharing: d_helmholtz_solver_idx[l] is the index of the
+     * quantity whose Helmholtz solver and RHS operator are used for quantity l.
+     */
+    bool d_share_helmholtz_solvers = false;
+    std::vector<unsigned int> d_helmholtz_solver_idx;
+
+    /*!
+     * Whether the Helmholtz solver or RHS operator of each quantity was
+     * provided by the user. Such quantities are excluded from solver sharing.
+     */
+    std::vector<bool> d_has_user_helmholtz_solver;
+
 private:
     /*!
      * \brief Default constructor.
@@ -369,6 +394,13 @@ private:
      */
     AdvDiffSemiImplicitHierarchyIntegrator& operator=(const AdvDiffSemiImplicitHierarchyIntegrator& that) = delete;
 
+    /*!
+     * Determine whether two transported quantities lead to the same Helmholtz
+     * system, so that they may share a single solver and RHS operator.
+     */
+    bool haveSameHelmholtzSystem(SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > Q1_var,
+                                 SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > Q2_var) const;
+
     /*!
      * Read input values from a given database.
      */
@@ -80,22 +80,9 @@ public:
     ~CFGiesekusRelaxation() = default;
 
     /*!
-     * \name Methods to set patch data.
+     * \brief Compute the relaxation function for the conformation tensor \em conform.
      */
-    //\{
-
-    /*!
-     * \brief Evaluate the function on the patch interior.
-     */
-    void setDataOnPatch(const int data_idx,
-                        SAMRAI::tbox::Pointer<SAMRAI::hier::Variable<NDIM> > var,
-                        SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
-                        const double data_time,
-                        const bool initial_time = false,
-                        SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level =
-                            SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> >(NULL)) override;
-
-    //\}
+    IBTK::MatrixNd computeRelaxation(const IBTK::MatrixNd& conform) override;
 
 private:
     double d_alpha, d_lambda;
@@ -80,22 +80,16 @@ public:
     ~CFOldroydBRelaxation() = default;
 
     /*!
-     * \name Methods to set patch data.
+     * \brief Compute the relaxation function for the conformation tensor \em conform.
      */
-    //\{
+    IBTK::MatrixNd computeRelaxation(const IBTK::MatrixNd& conform) override;
 
     /*!
-     * \brief Evaluate the function on the patch interior.
+     * \brief Integrate the relaxation of the conformation tensor \em conform over a time step of size \em dt.
+     *
+     * The linear Oldroyd-B relaxation is integrated exactly.
      */
-    void setDataOnPatch(const int data_idx,
-                        SAMRAI::tbox::Pointer<SAMRAI::hier::Variable<NDIM> > var,
-                        SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
-                        const double data_time,
-                        const bool initial_time = false,
-                        SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level =
-                            SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> >(NULL)) override;
-
-    //\}
+    IBTK::MatrixNd relaxTensor(const IBTK::MatrixNd& conform, double dt) override;
 
 private:
     double d_lambda;
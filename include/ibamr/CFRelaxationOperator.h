@@ -17,6 +17,7 @@
 #include "IBAMR_config.h"
 
 #include "ibamr/AdvDiffHierarchyIntegrator.h"
+#include "ibamr/CFTensorUtilities.h"
 #include "ibamr/ibamr_enums.h"
 
 #include "ibtk/CartGridFunction.h"
@@ -49,6 +50,12 @@ namespace IBAMR
  * The patch data index specifying either the conformation tensor or the square root or logarithm of the conformation
  * tensor is given to the class. The function setDataOnPatchHierarchy is called by the advection diffusion integrator
  * and expects the relaxation tensor.
+ *
+ * Concrete models implement computeRelaxation(), which evaluates the relaxation function of the conformation tensor
+ * in a single cell. setStepAveragedDataOnPatchHierarchy() instead sets the patch data to the step-averaged
+ * relaxation \f$ (\hat{C} - C)/\Delta t \f$, in which \f$ \hat{C} \f$ is obtained by integrating the relaxation of
+ * \f$ C \f$ over the time step via relaxTensor(). Because \f$ \hat{C} \f$ is computed implicitly (or exactly), this
+ * source remains bounded for relaxation times that are much shorter than the time step size.
  */
 class CFRelaxationOperator : public IBTK::CartGridFunction
 {
@@ -96,6 +103,65 @@ public:
      */
     bool isTimeDependent() const override;
 
+    /*!
+     * \name Methods to set patch data.
+     */
+    //\{
+
+    /*!
+     * \brief Evaluate the function on the patch interior.
+     */
+    void setDataOnPatch(const int data_idx,
+                        SAMRAI::tbox::Pointer<SAMRAI::hier::Variable<NDIM> > var,
+                        SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                        const double data_time,
+                        const bool initial_time = false,
+                        SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level =
+                            SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> >(NULL)) override;
+
+    /*!
+     * \brief Set the step-averaged relaxation \f$ (\hat{C} - C)/\Delta t \f$ over a time step of size \em dt on the
+     * specified levels of the patch hierarchy.
+     *
+     * If the Newton iteration of relaxTensor() does not converge in some cells, a single warning is emitted for each
+     * patch level that reports the number of such cells.
+     *
+     * \note A nonpositive value of \em dt results in an unrecoverable error.
+     */
+    void setStepAveragedDataOnPatchHierarchy(int data_idx,
+                                             SAMRAI::tbox::Pointer<SAMRAI::hier::Variable<NDIM> > var,
+                                             SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                                             double data_time,
+                                             double dt,
+                                             int coarsest_ln = IBTK::invalid_level_number,
+                                             int finest_ln = IBTK::invalid_level_number);
+
+    /*!
+     * \brief Return the number of local cells in which the Newton iteration of relaxTensor() did not converge during
+     * the most recent call to setStepAveragedDataOnPatchHierarchy().
+     */
+    unsigned int getNumberOfUnconvergedRelaxationSolves() const;
+
+    //\}
+
+    /*!
+     * \brief Compute the relaxation function for the conformation tensor \em conform.
+     *
+     * \note The default implementation emits an unrecoverable error. Concrete models that do not override
+     * setDataOnPatch() must override this function.
+     */
+    virtual IBTK::MatrixNd computeRelaxation(const IBTK::MatrixNd& conform);
+
+    /*!
+     * \brief Integrate the relaxation of the conformation tensor \em conform over a time step of size \em dt.
+     *
+     * The default implementation uses the backward Euler method, in which the resulting nonlinear system of equations
+     * is solved by Newton's method with a finite difference approximation to the Jacobian. Newton iterations that do
+     * not converge are counted (see getNumberOfUnconvergedRelaxationSolves()), and an unrecoverable error results if
+     * the iteration does not yield a finite tensor.
+     */
+    virtual IBTK::MatrixNd relaxTensor(const IBTK::MatrixNd& conform, double dt);
+
 protected:
     /*!
      * \brief This function converts the data stored in the patch data index to the conformation tensor. This has a
@@ -106,7 +172,22 @@ protected:
     int d_W_cc_idx = IBTK::invalid_index;
 
 private:
+    /*!
+     * \brief Set either the relaxation function (if \em dt is nonpositive) or the step-averaged relaxation over a time
+     * step of size \em dt on the patch interior.
+     */
+    void setRelaxationOnPatch(int data_idx,
+                              SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                              bool initial_time,
+                              double dt);
+
     TensorEvolutionType d_evolve_type = STANDARD;
+
+    /*!
+     * \brief Number of unconverged Newton iterations in relaxTensor() since the last call to
+     * setStepAveragedDataOnPatchHierarchy().
+     */
+    unsigned int d_num_unconverged_relaxation_solves = 0;
 };
 
 } // Namespace IBAMR
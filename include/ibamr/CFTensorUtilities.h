@@ -0,0 +1,217 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2019 - 2019 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+#ifndef included_CFTensorUtilities
+#define included_CFTensorUtilities
+/////////////////////////////// INCLUDES /////////////////////////////////////
+#include "IBAMR_config.h"
+
+#include "ibtk/ibtk_macros.h"
+#include "ibtk/ibtk_utilities.h"
+
+#include "CellData.h"
+#include "CellIndex.h"
+
+IBTK_DISABLE_EXTRA_WARNINGS
+#include <Eigen/Eigenvalues>
+IBTK_ENABLE_EXTRA_WARNINGS
+
+#include <algorithm>
+#include <cmath>
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBAMR
+{
+/*!
+ * \brief Class CFTensorUtilities provides closed-form kernels for the small
+ * symmetric tensors used by the complex fluid models.
+ *
+ * Symmetric tensors are stored in cell-centered data with depth 3 (in 2D) or 6
+ * (in 3D), with components ordered as \f$ (xx, yy, xy) \f$ or \f$ (xx, yy, zz,
+ * yz, xz, xy) \f$.  Unlike general purpose routines such as
+ * <code>Eigen::MatrixBase::exp()</code> or <code>Eigen::LLT</code>, the
+ * routines provided here exploit the symmetry and the size of the tensors and
+ * are intended to be called once per cell.
+ */
+class CFTensorUtilities
+{
+public:
+    /*!
+     * \brief Read the symmetric tensor stored at cell \em idx.
+     */
+    static inline IBTK::MatrixNd getTensor(const SAMRAI::pdat::CellData<NDIM, double>& data,
+                                           const SAMRAI::pdat::CellIndex<NDIM>& idx)
+    {
+        IBTK::MatrixNd mat;
+#if (NDIM == 2)
+        mat(0, 0) = data(idx, 0);
+        mat(1, 1) = data(idx, 1);
+        mat(0, 1) = mat(1, 0) = data(idx, 2);
+#endif
+#if (NDIM == 3)
+        mat(0, 0) = data(idx, 0);
+        mat(1, 1) = data(idx, 1);
+        mat(2, 2) = data(idx, 2);
+        mat(1, 2) = mat(2, 1) = data(idx, 3);
+        mat(0, 2) = mat(2, 0) = data(idx, 4);
+        mat(0, 1) = mat(1, 0) = data(idx, 5);
+#endif
+        return mat;
+    } // getTensor
+
+    /*!
+     * \brief Store the symmetric tensor \em mat at cell \em idx.
+     */
+    static inline void setTensor(SAMRAI::pdat::CellData<NDIM, double>& data,
+                                 const SAMRAI::pdat::CellIndex<NDIM>& idx,
+                                 const IBTK::MatrixNd& mat)
+    {
+#if (NDIM == 2)
+        data(idx, 0) = mat(0, 0);
+        data(idx, 1) = mat(1, 1);
+        data(idx, 2) = mat(0, 1);
+#endif
+#if (NDIM == 3)
+        data(idx, 0) = mat(0, 0);
+        data(idx, 1) = mat(1, 1);
+        data(idx, 2) = mat(2, 2);
+        data(idx, 3) = mat(1, 2);
+        data(idx, 4) = mat(0, 2);
+        data(idx, 5) = mat(0, 1);
+#endif
+        return;
+    } // setTensor
+
+    /*!
+     * \brief Determine whether the symmetric tensor \em mat is positive definite
+     * by checking the signs of its leading principal minors.
+     */
+    static inline bool isPositiveDefinite(const IBTK::MatrixNd& mat)
+    {
+        if (!(mat(0, 0) > 0.0)) return false;
+        const double minor_2 = mat(0, 0) * mat(1, 1) - mat(0, 1) * mat(0, 1);
+#if (NDIM == 2)
+        return minor_2 > 0.0;
+#endif
+#if (NDIM == 3)
+        if (!(minor_2 > 0.0)) return false;
+        return mat.determinant() > 0.0;
+#endif
+    } // isPositiveDefinite
+
+    /*!
+     * \brief Compute the eigenvalues (in increasing order) and the corresponding
+     * orthonormal eigenvectors of the symmetric tensor \em mat.
+     *
+     * The eigensystem is computed in closed form.  In 3D, the closed-form
+     * solution loses accuracy when two eigenvalues nearly coincide, and in that
+     * case the eigensystem is instead computed iteratively.
+     */
+    static inline void computeEigenDecomposition(const IBTK::MatrixNd& mat,
+                                                 IBTK::VectorNd& eig_vals,
+                                                 IBTK::MatrixNd& eig_vecs)
+    {
+        Eigen::SelfAdjointEigenSolver<IBTK::MatrixNd> eigs;
+        eigs.computeDirect(mat);
+#if (NDIM == 3)
+        const IBTK::VectorNd& direct_eig_vals = eigs.eigenvalues();
+        const double min_gap =
+            std::min(direct_eig_vals(1) - direct_eig_vals(0), direct_eig_vals(2) - direct_eig_vals(1));
+        if (min_gap < 1.0e-2 * direct_eig_vals.cwiseAbs().maxCoeff()) eigs.compute(mat);
+#endif
+        eig_vals = eigs.eigenvalues();
+        eig_vecs = eigs.eigenvectors();
+        return;
+    } // computeEigenDecomposition
+
+    /*!
+     * \brief Compute the exponential of the symmetric tensor \em mat.
+     */
+    static inline IBTK::MatrixNd exponentiate(const IBTK::MatrixNd& mat)
+    {
+#if (NDIM == 2)
+        // Write mat = m*I + B with B traceless, so that B*B = d^2*I and
+        // exp(mat) = exp(m)*(cosh(d)*I + sinh(d)/d*B).
+        const double m = 0.5 * (mat(0, 0) + mat(1, 1));
+        const double h = 0.5 * (mat(0, 0) - mat(1, 1));
+        const double d = std::sqrt(h * h + mat(0, 1) * mat(0, 1));
+        const double exp_m = std::exp(m);
+        const double c = std::cosh(d);
+        const double s = (d > 1.0e-8 ? std::sinh(d) / d : 1.0 + d * d / 6.0);
+        IBTK::MatrixNd exp_mat;
+        exp_mat(0, 0) = exp_m * (c + s * h);
+        exp_mat(1, 1) = exp_m * (c - s * h);
+        exp_mat(0, 1) = exp_mat(1, 0) = exp_m * s * mat(0, 1);
+        return exp_mat;
+#endif
+#if (NDIM == 3)
+        IBTK::VectorNd eig_vals;
+        IBTK::MatrixNd eig_vecs;
+        computeEigenDecomposition(mat, eig_vals, eig_vecs);
+        for (int d = 0; d < NDIM; ++d) eig_vals(d) = std::exp(eig_vals(d));
+        return eig_vecs * eig_vals.asDiagonal() * eig_vecs.transpose();
+#endif
+    } // exponentiate
+
+    /*!
+     * \brief Compute the symmetric positive semi-definite tensor that is
+     * nearest to the symmetric tensor \em mat by setting its negative
+     * eigenvalues to zero.
+     *
+     * \return Whether the tensor was modified.
+     */
+    static inline bool projectToPositiveSemiDefinite(IBTK::MatrixNd& mat)
+    {
+        if (isPositiveDefinite(mat)) return false;
+        IBTK::VectorNd eig_vals;
+        IBTK::MatrixNd eig_vecs;
+        computeEigenDecomposition(mat, eig_vals, eig_vecs);
+        for (int d = 0; d < NDIM; ++d) eig_vals(d) = std::max(eig_vals(d), 0.0);
+        mat = eig_vecs * eig_vals.asDiagonal() * eig_vecs.transpose();
+        return true;
+    } // projectToPositiveSemiDefinite
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    CFTensorUtilities() = delete;
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    CFTensorUtilities(const CFTensorUtilities& from) = delete;
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    CFTensorUtilities& operator=(const CFTensorUtilities& that) = delete;
+};
+} // namespace IBAMR
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_CFTensorUtilities
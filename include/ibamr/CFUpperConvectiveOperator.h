@@ -60,6 +60,12 @@ namespace IBAMR
  * be chosen from any current convective operators. If the advected quantity allows for a square root or logarithmic
  * decomposition, this class can advect the symmetric square root or logarithm of the tensor. Note that this class
  * requires the registration of a source funtion before it can be applied.
+ *
+ * If the input database entry <code>implicit_relaxation</code> is set to true, the relaxation source is replaced by
+ * its average over the current time step, which is obtained by integrating the relaxation in each cell with
+ * CFRelaxationOperator::relaxTensor(). This keeps the source bounded when the relaxation time is much shorter than
+ * the time step size. In this case, the time interval must be set via setTimeInterval() before the operator is
+ * applied.
  */
 
 class CFUpperConvectiveOperator : public ConvectiveOperator
@@ -118,6 +124,7 @@ private:
     const std::vector<SAMRAI::solv::RobinBcCoefStrategy<NDIM>*> d_u_bc_coefs;
     TensorEvolutionType d_evolve_type = STANDARD;
     std::string d_interp_type = "LINEAR";
+    bool d_implicit_relaxation = false;
 };
 } // namespace IBAMR
 
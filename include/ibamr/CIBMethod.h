@@ -379,6 +379,20 @@ public:
                                  double f_periodic_corr,
                                  const int managing_rank) override;
 
+    // \see CIBStrategy::constructHierarchicalMobilityOperator() method.
+    /*!
+     * \brief Initialize a matrix-free approximation to the
+     * Rotne-Prager-Yamakawa mobility matrix for the structures identified by
+     * their indices.
+     */
+    void constructHierarchicalMobilityOperator(HierarchicalMobilityOperator& mobility_op,
+                                               const std::vector<unsigned>& struct_ids,
+                                               const double* grid_dx,
+                                               const bool initial_time,
+                                               double mu,
+                                               double f_periodic_corr,
+                                               const int managing_rank) override;
+
     // \see CIBStrategy::constructGeometricMatrix() method.
     /*!
      * \brief Generate block-diagonal geometric matrix for the prototypical structures
@@ -34,6 +34,11 @@ IBTK_ENABLE_EXTRA_WARNINGS
 #include <map>
 #include <vector>
 
+namespace IBAMR
+{
+class HierarchicalMobilityOperator;
+} // namespace IBAMR
+
 /////////////////////////////// CLASS DEFINITION /////////////////////////////
 
 namespace IBAMR
@@ -504,6 +509,38 @@ public:
                                          double f_periodic_corr,
                                          const int managing_rank);
 
+    /*!
+     * \brief Initialize a matrix-free approximation to the
+     * Rotne-Prager-Yamakawa mobility matrix for the structures identified by
+     * their indices.
+     * \note A default empty implementation is provided in this class. The
+     * derived class provides the actual implementation.
+     *
+     * \param mobility_op Hierarchical mobility operator to be initialized on
+     * the managing processor.
+     *
+     * \param struct_ids Indices of the structures as registered with \see
+     * IBAMR::IBStrategy class.
+     *
+     * \param grid_dx NDIM vector of grid spacing of structure level.
+     *
+     * \param initial_time Boolean to indicate if the operator is to be
+     * generated for the initial position of the structures.
+     *
+     * \param mu Fluid viscosity.
+     *
+     * \param f_periodic_corr Periodic domain correction.
+     *
+     * \param managing_rank Rank of the processor managing the operator.
+     */
+    virtual void constructHierarchicalMobilityOperator(HierarchicalMobilityOperator& mobility_op,
+                                                       const std::vector<unsigned>& struct_ids,
+                                                       const double* grid_dx,
+                                                       const bool initial_time,
+                                                       double mu,
+                                                       double f_periodic_corr,
+                                                       const int managing_rank);
+
     /*!
      * \brief Construct a geometric matrix for the prototypical structures
      * identified by their indices. A geometric matrix maps center of mass rigid
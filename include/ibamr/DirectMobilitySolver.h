@@ -236,8 +236,15 @@ private:
 
     /*!
      * \brief Compute solution and store in the rhs vector.
+     *
+     * The right-hand side may consist of \em nrhs column-major vectors, which
+     * are solved for simultaneously.
      */
-    void computeSolution(Mat& mat, const MobilityMatrixInverseType& inv_type, int* ipiv, double* rhs);
+    void computeSolution(Mat& mat,
+                         const MobilityMatrixInverseType& inv_type,
+                         int* ipiv,
+                         double* rhs,
+                         const int nrhs = 1);
 
     // Solver stuff
     std::string d_object_name;
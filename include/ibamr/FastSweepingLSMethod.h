@@ -38,7 +38,14 @@ template <int DIM>
 class Box;
 template <int DIM>
 class Patch;
+template <int DIM>
+class PatchHierarchy;
 } // namespace hier
+namespace xfer
+{
+template <int DIM>
+class RefineSchedule;
+} // namespace xfer
 } // namespace SAMRAI
 
 /////////////////////////////// CLASS DEFINITION /////////////////////////////
@@ -55,6 +62,26 @@ namespace IBAMR
  * specified through input file. In presence of a physical domain wall, the distance function
  * at a grid point is D = min(distance from interface, distance from wall location).
  *
+ * If the input key <code>narrow_band_width</code> is set to a positive value, the
+ * distance is only computed within that many grid cells of the interface. Patches
+ * that lie entirely outside of this band are not swept and values outside of the
+ * band are clamped to the signed band width.
+ *
+ * Both first-order (<code>order = "FIRST_ORDER"</code>) and second-order
+ * (<code>order = "SECOND_ORDER"</code>) upwind discretizations are supported. The
+ * second-order scheme uses one-sided second-order differences wherever the upwind
+ * values are monotone and requires two ghost cells.
+ *
+ * Each outer iteration performs a full ghost cell fill over the hierarchy followed
+ * by a sweep of every patch. Because information crosses only one patch per outer
+ * iteration, the input key <code>max_local_iterations</code> (default 0) enables up
+ * to that many additional rounds of same-level ghost exchanges between neighboring
+ * patches per outer iteration. In each round only the patches with a ghost value
+ * that changed by more than <code>local_exchange_tol</code> (default 1.0e-12) are
+ * swept again, and the rounds stop early once no patch changes on any processor.
+ * Unlike <code>abs_tol</code>, which bounds the L2-norm of the change between
+ * outer iterations, this tolerance applies to individual values.
+ *
  * References
  * Zhao, H., <A HREF="http://www.ams.org/journals/mcom/2005-74-250/S0025-5718-04-01678-3/">
  * A Fast Sweeping Method For Eikonal Equations</A>
@@ -87,6 +114,8 @@ protected:
     // Algorithm parameters.
     bool d_consider_phys_bdry_wall = false;
     int d_wall_location_idx[2 * NDIM];
+    int d_max_local_its = 0;
+    double d_local_exchange_tol = 1.0e-12;
 
 private:
     /*!
@@ -94,6 +123,20 @@ private:
      */
     void fastSweep(SAMRAI::tbox::Pointer<IBTK::HierarchyMathOps> hier_math_ops, int dist_idx) const;
 
+    /*!
+     * \brief Repeatedly exchange ghost values between neighboring patches on
+     * each level and sweep the patches whose ghost values changed, until no
+     * patch changes or max_local_iterations rounds have been performed.
+     *
+     * \return The number of exchange rounds that were performed.
+     */
+    int exchangeAndSweep(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                         int dist_idx,
+                         int dist_copy_idx,
+                         const std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > >&
+                             exchange_scheds,
+                         double time);
+
     /*!
      * \brief Do one fast sweep over a patch.
      */
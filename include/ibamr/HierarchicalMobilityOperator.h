@@ -0,0 +1,223 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2019 - 2019 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+#ifndef included_IBAMR_HierarchicalMobilityOperator
+#define included_IBAMR_HierarchicalMobilityOperator
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "tbox/Database.h"
+#include "tbox/DescribedClass.h"
+#include "tbox/Pointer.h"
+
+#include <array>
+#include <string>
+#include <vector>
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBAMR
+{
+/*!
+ * \brief Class HierarchicalMobilityOperator provides a matrix-free
+ * approximation to the Rotne-Prager-Yamakawa (RPY) mobility matrix
+ * constructed by MobilityFunctions::constructRPYMobilityMatrix(), together
+ * with a preconditioner for the corresponding mobility problem.
+ *
+ * The markers are organized in a binary cluster tree that is obtained by
+ * recursively bisecting the markers along the direction of largest extent.
+ * The action of the mobility matrix is computed with a treecode: interactions
+ * with clusters that are well separated from the target marker (i.e., whose
+ * radius is less than <code>opening_angle</code> times their distance from the
+ * target) are approximated using the net force and the force dipole moment of
+ * the cluster about its centroid, and all other interactions are computed
+ * exactly.  This requires \f$ O(N \log N) \f$ operations and \f$ O(N) \f$
+ * storage for \f$ N \f$ markers, compared to \f$ O(N^2) \f$ for the dense
+ * mobility matrix.  An opening angle of zero reproduces the dense matrix
+ * exactly.
+ *
+ * The preconditioner is the block-diagonal part of the mobility matrix with
+ * respect to the leaves of the cluster tree, which contain at most
+ * <code>leaf_size</code> markers each.  The leaf blocks are factorized using
+ * dense Cholesky factorizations, so that setting up and applying the
+ * preconditioner requires \f$ O(N) \f$ operations for a fixed leaf size.
+ * When <code>num_pc_iterations</code> is larger than one, the preconditioner
+ * additionally performs block Jacobi iterations for the treecode approximation
+ * of the mobility matrix, i.e., each additional iteration corrects the forces
+ * by the leaf block solve of the residual \f$ U - M F \f$ computed with
+ * apply().  These iterations improve the preconditioner for structures whose
+ * leaves interact only weakly, but need not converge for closely packed
+ * structures.
+ *
+ * Sample input database entries:
+ \verbatim
+ opening_angle = 0.5    // default: 0.5
+ leaf_size = 32         // default: 32
+ num_pc_iterations = 1  // default: 1
+ \endverbatim
+ *
+ * \note This class operates on data that are stored on a single processor.
+ */
+class HierarchicalMobilityOperator : public SAMRAI::tbox::DescribedClass
+{
+public:
+    /*!
+     * \brief Constructor.
+     */
+    HierarchicalMobilityOperator(std::string object_name, SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db);
+
+    /*!
+     * \brief Destructor.
+     */
+    ~HierarchicalMobilityOperator() = default;
+
+    /*!
+     * \brief Build the cluster tree for the markers and factorize the blocks
+     * of the preconditioner.
+     *
+     * \param kernel_name IB kernel function used to determine the
+     * hydrodynamic radius of the markers.
+     *
+     * \param mu Fluid viscosity.
+     *
+     * \param dx Cartesian grid spacing.
+     *
+     * \param X Array of IB markers' location.
+     *
+     * \param num_nodes Number of Lagrangian markers.
+     *
+     * \param periodic_correction Input parameter for incorporating periodic
+     * domain correction. Set it to zero if not needed.
+     */
+    void initializeOperatorState(const char* kernel_name,
+                                 double mu,
+                                 double dx,
+                                 const double* X,
+                                 int num_nodes,
+                                 double periodic_correction = 0.0);
+
+    /*!
+     * \brief Remove all data allocated by initializeOperatorState().
+     */
+    void deallocateOperatorState();
+
+    /*!
+     * \brief Indicate whether the operator state is initialized.
+     */
+    bool isInitialized() const;
+
+    /*!
+     * \brief Return the number of markers.
+     */
+    int getNumberOfNodes() const;
+
+    /*!
+     * \brief Compute the approximate velocities \f$ U = M F \f$ of the markers
+     * induced by the forces \em F.
+     */
+    void apply(const double* F, double* U) const;
+
+    /*!
+     * \brief Apply the preconditioner, i.e., approximately compute \f$ F =
+     * M^{-1} U \f$.
+     *
+     * \note \em U and \em F may point to the same array.
+     */
+    void applyPreconditioner(const double* U, double* F) const;
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    HierarchicalMobilityOperator() = delete;
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    HierarchicalMobilityOperator(const HierarchicalMobilityOperator& from) = delete;
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    HierarchicalMobilityOperator& operator=(const HierarchicalMobilityOperator& that) = delete;
+
+    /*!
+     * \brief A cluster of markers, which are stored contiguously in the
+     * sorted marker ordering.
+     */
+    struct Cluster
+    {
+        int begin, end;
+        std::array<double, NDIM> center;
+        double radius;
+        int child[2];
+    };
+
+    /*!
+     * \brief Recursively build the cluster containing the sorted markers in
+     * the range [begin, end) and return its index.
+     */
+    int buildCluster(int begin, int end);
+
+    /*!
+     * \brief Factorize the diagonal blocks of the mobility matrix that are
+     * associated with the leaves of the cluster tree.
+     */
+    void factorizeLeafBlocks();
+
+    /*!
+     * \brief Solve the leaf block systems, i.e., compute \f$ F = D^{-1} U \f$
+     * in which \f$ D \f$ is the block-diagonal part of the mobility matrix.
+     *
+     * \note \em U and \em F may point to the same array.
+     */
+    void applyLeafBlockInverse(const double* U, double* F) const;
+
+    std::string d_object_name;
+
+    // Parameters of the approximation.
+    double d_opening_angle = 0.5;
+    int d_leaf_size = 32;
+    int d_num_pc_iterations = 1;
+
+    // Physical parameters.
+    double d_mu = 0.0, d_hydro_radius = 0.0, d_periodic_correction = 0.0;
+
+    // Cluster tree.
+    bool d_is_initialized = false;
+    int d_num_nodes = 0;
+    std::vector<int> d_perm;
+    std::vector<double> d_X_sorted;
+    std::vector<Cluster> d_clusters;
+    std::vector<int> d_leaves;
+
+    // Cholesky factors of the leaf blocks of the mobility matrix.
+    std::vector<std::vector<double> > d_leaf_factors;
+};
+} // namespace IBAMR
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBAMR_HierarchicalMobilityOperator
@@ -24,6 +24,8 @@
 #include "ibtk/SAMRAIDataCache.h"
 #include "ibtk/libmesh_utilities.h"
 
+#include "Box.h"
+#include "BoxList.h"
 #include "GriddingAlgorithm.h"
 #include "IntVector.h"
 #include "LoadBalancer.h"
@@ -139,6 +141,11 @@ namespace IBAMR
  *   previous entry.
  *   <li><code>IB_use_consistent_mass_matrix</code>: Overriding alias of
  *   the previous entry.</li>
+ *   <li><code>use_matrix_free_L2_projection</code>: Whether or not L2
+ *   projections with a consistent mass matrix should be solved without
+ *   assembling the mass matrix (see
+ *   IBTK::FEData::MatrixFreeL2ProjectionOperator). Defaults to
+ *   <code>FALSE</code>.</li>
  *   <li><code>interp_use_nodal_quadrature</code>: Whether or not nodal
  *   quadrature should be used, which is essentially interpolation instead of
  *   projection. This is an experimental feature. Defaults to
@@ -267,11 +274,52 @@ namespace IBAMR
  * it reduces the total number of elements which end up in patch ghost
  * regions since some patches will be merged together.
  *
+ * By default all data on the finest level are copied between the primary and
+ * scratch hierarchies before and after each interpolation and spreading
+ * operation. Setting <code>use_sparse_scratch_transfer = TRUE</code> restricts
+ * these copies to boxes around the elements assigned to each scratch patch.
+ * These boxes are computed after each regrid and are grown by
+ * <code>sparse_scratch_transfer_buffer</code> cells (the default is
+ * <code>1</code>), which should be at least the distance (in cells on the
+ * finest level) the structure moves between regrids: e.g., it should not be
+ * smaller than the <code>regrid_cfl_interval</code> of the
+ * IBHierarchyIntegrator. At the start of each time step the boxes are
+ * checked against the current positions of the nodes grown by the ghost cell
+ * width and the displacement predicted from the current velocity over the
+ * time step plus one cell: if the structure may leave the boxes during the
+ * time step then they are recomputed with a buffer of at least the predicted
+ * displacement. Each transfer to the scratch hierarchy then checks, without
+ * communication, that the positions used for spreading or interpolation are
+ * inside the boxes and aborts if they are not.
+ *
  * The parameter <code>workload_quad_point_weight</code> is the multiplier
  * assigned to an IB point when calculating the work per processor: in the
  * future additional weights, such as <code>workload_node_point_weight</code>
  * will also be added.
  *
+ * Setting <code>workload_use_measured_costs = TRUE</code> (the default is
+ * <code>FALSE</code>) scales the weight of each quadrature point by the
+ * measured cost of spreading and interpolation on its element relative to the
+ * average cost per quadrature point: see IBTK::FEDataManager::WorkloadSpec. In
+ * combination with <code>libmesh_partitioner_type = SAMRAI_BOX</code> this
+ * balances the measured Lagrangian-Eulerian interaction work and assigns
+ * elements to the processors that own the patches on which they are spread
+ * and interpolated. The measured costs are multiplied by
+ * <code>workload_measured_cost_retention</code> after each regrid (the default
+ * is <code>0.0</code>, i.e., only the costs measured since the previous regrid
+ * are used).
+ *
+ * <h2>Options Controlling Element Reassignment</h2>
+ * Every regrid requires reassigning the elements of each part to the patches
+ * with which they interact. When <code>element_mapping_displacement_fraction</code>
+ * is positive, elements are associated with patches using bounding boxes
+ * grown by that fraction of the ghost cell width: if the patches owned by a
+ * processor did not change during a regrid then only the elements which have
+ * moved further than that are reassigned. This makes reassignment much
+ * cheaper for slowly moving structures. See
+ * IBTK::FEDataManager::setElementMappingDisplacementFraction(). Defaults to
+ * <code>0.0</code>, i.e., all elements are always reassigned.
+ *
  * <h2>Options Controlling Logging</h2>
  * The logging options set by this class are propagated to the owned
  * FEDataManager objects.
@@ -952,6 +1000,57 @@ protected:
                                 const int data_idx,
                                 SAMRAI::xfer::RefinePatchStrategy<NDIM>* patch_strategy = nullptr);
 
+    /*!
+     * Get the boxes on the given level of the scratch hierarchy which contain
+     * all Eulerian data used to spread from and interpolate to the structure
+     * until the next regrid. If necessary the boxes are computed: this is a
+     * collective operation.
+     *
+     * The schedules returned by getPrimaryToScratchSchedule() and
+     * getScratchToPrimarySchedule() only transfer data inside these boxes
+     * when <code>use_sparse_scratch_transfer</code> is <code>TRUE</code>.
+     */
+    const SAMRAI::hier::BoxList<NDIM>& getScratchTransferBoxes(int level_number);
+
+    /*!
+     * Compute, for each local patch of the given level of the scratch
+     * hierarchy, the bounding box of the nodes associated with that patch
+     * grown by <code>buffer</code> and restricted to the ghost region of the
+     * patch. The node positions are read from the ghosted vectors
+     * <code>X_ghost_vecs</code>, one per part. Patches with no nodes have
+     * empty boxes.
+     */
+    std::vector<SAMRAI::hier::Box<NDIM> >
+    computeScratchTransferPatchBoxes(int level_number,
+                                     const SAMRAI::hier::IntVector<NDIM>& buffer,
+                                     const std::vector<libMesh::NumericVector<double>*>& X_ghost_vecs);
+
+    /*!
+     * Determine whether or not the scratch transfer boxes of the local patches
+     * contain all Eulerian data used to spread from and interpolate to the
+     * structure when its nodes are at the positions stored in the ghosted
+     * vectors <code>X_ghost_vecs</code> and may move by <code>buffer</code>
+     * additional cells. This does not communicate.
+     */
+    bool scratchTransferBoxesContainStructure(int level_number,
+                                              const SAMRAI::hier::IntVector<NDIM>& buffer,
+                                              const std::vector<libMesh::NumericVector<double>*>& X_ghost_vecs);
+
+    /*!
+     * Check, once per time step, whether the structure may leave the scratch
+     * transfer boxes during the time step, based on the current positions and
+     * velocities of the nodes, and if so recompute the boxes and invalidate
+     * the transfer schedules. This is a collective operation.
+     */
+    void updateScratchTransferBoxes(double current_time, double new_time);
+
+    /*!
+     * Verify, without communication, that the scratch transfer boxes contain
+     * all Eulerian data used to spread from and interpolate to the positions
+     * currently stored in d_X_IB_ghost_vecs.
+     */
+    void assertScratchTransferBoxesContainStructure(int level_number);
+
     /*!
      * Indicates whether the integrator should output logging messages.
      */
@@ -978,6 +1077,40 @@ protected:
      */
     bool d_use_scratch_hierarchy = false;
 
+    /*
+     * Whether or not data are only transferred between the primary and
+     * scratch hierarchies in the vicinity of the structure and the number of
+     * cells (beyond the ghost cell width) by which the structure may move
+     * between regrids.
+     */
+    bool d_use_sparse_scratch_transfer = false;
+    int d_sparse_scratch_transfer_buffer = 1;
+
+    /*
+     * Boxes, known on all processors, outside of which no data are
+     * transferred between the primary and scratch hierarchies, along with the
+     * boxes computed for each local patch from which they were assembled.
+     * These are recomputed after each regrid and whenever the structure moves
+     * outside of them.
+     */
+    SAMRAI::hier::BoxList<NDIM> d_scratch_transfer_boxes;
+    std::vector<SAMRAI::hier::Box<NDIM> > d_scratch_transfer_patch_boxes;
+    bool d_scratch_transfer_boxes_valid = false;
+
+    /*
+     * The displacement, in cells on the finest level, which the structure is
+     * predicted to undergo during the current time step. The scratch transfer
+     * boxes are grown by at least this many cells when they are recomputed.
+     */
+    SAMRAI::hier::IntVector<NDIM> d_scratch_transfer_predicted_displacement = 0;
+
+    /*
+     * Fraction of the ghost cell width by which elements may move before
+     * they are reassigned to patches: see
+     * IBTK::FEDataManager::setElementMappingDisplacementFraction().
+     */
+    double d_elem_mapping_displacement_fraction = 0.0;
+
     /*
      * Pointers to the patch hierarchy and gridding algorithm objects associated
      * with this object.
@@ -1159,6 +1292,7 @@ protected:
     std::vector<libMesh::QuadratureType> d_default_quad_type;
     std::vector<libMesh::Order> d_default_quad_order;
     bool d_use_consistent_mass_matrix = true;
+    bool d_use_matrix_free_L2_projection = false;
 
     /*
      * Data related to handling stress normalization.
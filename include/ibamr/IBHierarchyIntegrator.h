@@ -290,6 +290,20 @@ protected:
      */
     double d_regrid_cfl_interval = 0.0, d_regrid_cfl_estimate = 0.0;
 
+    /*
+     * The structure regrid CFL interval indicates the number of meshwidths a
+     * Lagrangian point may move between invocations of the regridding process.
+     * Unlike the regrid CFL interval, which is based on an estimate of the
+     * maximum fluid velocity, this criterion uses the actual displacements of
+     * the Lagrangian points (see IBStrategy::getMaxPointDisplacement()).  When
+     * this value is positive, the tag buffer is also enlarged so that the
+     * structure remains within the refined region until the next regrid.
+     *
+     * NOTE: If the IB method implementation does not track point displacements,
+     * the regrid CFL interval or the fixed-step regrid interval is used instead.
+     */
+    double d_regrid_structure_cfl_interval = 0.0;
+
     /*
      * IB method implementation object.
      */
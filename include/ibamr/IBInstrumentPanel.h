@@ -225,42 +225,34 @@ private:
     std::vector<double> d_flow_values, d_mean_pres_values, d_point_pres_values;
 
     /*!
-     * \brief Data structures employed to manage mappings between cell indices
-     * and web patch data (i.e., patch centroids and area-weighted normals) and
-     * meter centroid data.
+     * \brief Data structures employed to manage mappings between local patches
+     * and the web patch data (i.e., patch centroids and area-weighted normals)
+     * and meter centroid data that are sampled on those patches.
+     *
+     * The web patches and web centroids are binned by the local patches that
+     * contain them when the hierarchy dependent data are initialized, so that
+     * reading the instrument data only visits the cells that are actually
+     * sampled by the meters.
      */
-    struct IndexFortranOrder
-    {
-        inline bool operator()(const SAMRAI::hier::Index<NDIM>& lhs, const SAMRAI::hier::Index<NDIM>& rhs) const
-        {
-            return (lhs(0) < rhs(0)
-#if (NDIM > 1)
-                    || (lhs(0) == rhs(0) && lhs(1) < rhs(1))
-#if (NDIM > 2)
-                    || (lhs(0) == rhs(0) && lhs(1) == rhs(1) && lhs(2) < rhs(2))
-#endif
-#endif
-            );
-        } // operator()
-    };
-
     struct WebPatch
     {
         int meter_num;
         const IBTK::Vector* X;
         const IBTK::Vector* dA;
+        SAMRAI::hier::Index<NDIM> cell_idx;
     };
 
-    using WebPatchMap = std::multimap<SAMRAI::hier::Index<NDIM>, WebPatch, IndexFortranOrder>;
+    using WebPatchMap = std::map<int, std::vector<WebPatch> >;
     std::vector<WebPatchMap> d_web_patch_map;
 
     struct WebCentroid
     {
         int meter_num;
         const IBTK::Vector* X;
+        SAMRAI::hier::Index<NDIM> cell_idx;
     };
 
-    using WebCentroidMap = std::multimap<SAMRAI::hier::Index<NDIM>, WebCentroid, IndexFortranOrder>;
+    using WebCentroidMap = std::map<int, std::vector<WebCentroid> >;
     std::vector<WebCentroidMap> d_web_centroid_map;
 
     /*
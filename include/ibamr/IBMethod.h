@@ -378,6 +378,16 @@ public:
     void endDataRedistribution(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
                                SAMRAI::tbox::Pointer<SAMRAI::mesh::GriddingAlgorithm<NDIM> > gridding_alg) override;
 
+    /*!
+     * Return the maximum displacement of any IB point since the last call to
+     * endDataRedistribution(), measured in units of the grid spacing of the
+     * level on which the point is located.
+     *
+     * \note Points that are moved across periodic boundaries appear to be
+     * displaced by the period, so that the hierarchy is regridded.
+     */
+    double getMaxPointDisplacement() const override;
+
     /*!
      * Initialize data on a new level after it is inserted into an AMR patch
      * hierarchy by the gridding algorithm.
@@ -529,6 +539,11 @@ protected:
     std::vector<SAMRAI::tbox::Pointer<IBTK::LData> > d_U_current_data, d_U_new_data, d_U_half_data, d_U_jac_data;
     std::vector<SAMRAI::tbox::Pointer<IBTK::LData> > d_F_current_data, d_F_new_data, d_F_half_data, d_F_jac_data;
 
+    /*
+     * Positions of the IB points at the time of the last regrid.
+     */
+    std::vector<SAMRAI::tbox::Pointer<IBTK::LData> > d_X_regrid_data;
+
     /*
      * List of local indices of local anchor points.
      *
@@ -177,6 +177,11 @@ private:
 
     /*!
      * \name Data maintained separately for each level of the patch hierarchy.
+     *
+     * Springs and beams are ordered so that those that involve only local
+     * nodes come first.  The forces generated by these "interior" springs and
+     * beams are computed while the positions of the ghost nodes are being
+     * communicated.
      */
     //\{
     struct SpringData
@@ -187,6 +192,7 @@ private:
         std::vector<SpringForceFcnPtr> force_fcns;
         std::vector<SpringForceDerivFcnPtr> force_deriv_fcns;
         std::vector<const double*> parameters;
+        int num_interior_springs = 0;
     };
     std::vector<SpringData> d_spring_data;
 
@@ -196,6 +202,7 @@ private:
         std::vector<int> petsc_global_mastr_node_idxs, petsc_global_next_node_idxs, petsc_global_prev_node_idxs;
         std::vector<const double*> rigidities;
         std::vector<const IBTK::Vector*> curvatures;
+        int num_interior_beams = 0;
     };
     std::vector<BeamData> d_beam_data;
 
@@ -225,7 +232,9 @@ private:
                                       SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
                                       int level_number,
                                       double data_time,
-                                      IBTK::LDataManager* l_data_manager);
+                                      IBTK::LDataManager* l_data_manager,
+                                      int spring_begin,
+                                      int spring_end);
 
     /*!
      * Beam force routines.
@@ -241,7 +250,9 @@ private:
                                     SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
                                     int level_number,
                                     double data_time,
-                                    IBTK::LDataManager* l_data_manager);
+                                    IBTK::LDataManager* l_data_manager,
+                                    int beam_begin,
+                                    int beam_end);
 
     /*!
      * TargetPoint force routines.
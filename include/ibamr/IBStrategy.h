@@ -363,6 +363,20 @@ public:
     virtual void endDataRedistribution(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
                                        SAMRAI::tbox::Pointer<SAMRAI::mesh::GriddingAlgorithm<NDIM> > gridding_alg);
 
+    /*!
+     * Return the maximum displacement of any Lagrangian point since the last
+     * call to endDataRedistribution(), measured in units of the grid spacing of
+     * the level on which the point is located.  This is used to determine when
+     * the patch hierarchy must be regridded to keep the structure within the
+     * refined region.
+     *
+     * \note This function must be called collectively.
+     *
+     * A default implementation is provided that returns a negative value,
+     * indicating that point displacements are not tracked.
+     */
+    virtual double getMaxPointDisplacement() const;
+
     /*!
      * Initialize data on a new level after it is inserted into an AMR patch
      * hierarchy by the gridding algorithm.
@@ -181,6 +181,9 @@ public:
 
     /*!
      * Supply a body force.
+     *
+     * \note Body force functions that are not time-dependent are evaluated
+     * only once on each patch of the hierarchy.
      */
     void registerBodyForceFunction(SAMRAI::tbox::Pointer<IBTK::CartGridFunction> F_fcn);
 
@@ -526,6 +529,7 @@ protected:
     TractionBcType d_traction_bc_type = TRACTION;
     SAMRAI::solv::RobinBcCoefStrategy<NDIM>*d_P_bc_coef, *d_Phi_bc_coef;
     SAMRAI::tbox::Pointer<IBTK::CartGridFunction> d_F_fcn, d_Q_fcn;
+    int d_num_cached_F_fcns = 0;
     SAMRAI::tbox::Pointer<IBTK::HierarchyGhostCellInterpolation> d_U_bdry_bc_fill_op, d_P_bdry_bc_fill_op,
         d_Q_bdry_bc_fill_op, d_no_fill_op;
 
@@ -21,8 +21,10 @@
 #include "ibamr/ibamr_enums.h"
 
 #include "ibtk/HierarchyGhostCellInterpolation.h"
+#include "ibtk/ScratchPatchDataPool.h"
 #include "ibtk/ibtk_utilities.h"
 
+#include "FaceData.h"
 #include "IntVector.h"
 #include "PatchHierarchy.h"
 #include "SideVariable.h"
@@ -194,6 +196,10 @@ private:
     // Scratch data.
     SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, double> > d_U_var;
     int d_U_scratch_idx = IBTK::invalid_index;
+
+    // Temporary patch data that are reused by each call to applyConvectiveOperator()
+    // unless the input database sets reuse_scratch_data = FALSE.
+    IBTK::ScratchPatchDataPool<SAMRAI::pdat::FaceData<NDIM, double> > d_face_scratch_data_pool;
 };
 } // namespace IBAMR
 
@@ -21,10 +21,14 @@
 #include "ibamr/ibamr_enums.h"
 
 #include "ibtk/HierarchyGhostCellInterpolation.h"
+#include "ibtk/ScratchPatchDataPool.h"
 #include "ibtk/ibtk_utilities.h"
 
+#include "Box.h"
+#include "FaceData.h"
 #include "IntVector.h"
 #include "PatchHierarchy.h"
+#include "SideData.h"
 #include "SideVariable.h"
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
@@ -56,6 +60,13 @@ namespace IBAMR
  * a side-centered velocity field using the xsPPM7 method of Rider, Greenough,
  * and Kamm.
  *
+ * When the optional input database entry <code>tile_size</code> is positive,
+ * patches that are larger than <code>tile_size</code> cells in every direction
+ * are processed in tiles of (at most) <code>tile_size</code> cells per
+ * direction, so that the temporary data used by the Godunov predictor remain
+ * cache resident.  Tiling does not change the computed values.  By default,
+ * patches are not tiled.
+ *
  * \see INSStaggeredHierarchyIntegrator
  */
 class INSStaggeredPPMConvectiveOperator : public ConvectiveOperator
@@ -170,6 +181,16 @@ private:
      */
     INSStaggeredPPMConvectiveOperator& operator=(const INSStaggeredPPMConvectiveOperator& that) = delete;
 
+    /*!
+     * \brief Compute the convective derivative on the cell-centered box \em box,
+     * which is the patch box of the side-centered data \em U_data and \em
+     * N_data.
+     */
+    void computeConvectiveDerivative(const SAMRAI::hier::Box<NDIM>& box,
+                                     const double* dx,
+                                     SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > U_data,
+                                     SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > N_data);
+
     // Boundary condition helper object.
     SAMRAI::tbox::Pointer<StaggeredStokesPhysicalBoundaryHelper> d_bc_helper;
 
@@ -186,6 +207,15 @@ private:
     // Scratch data.
     SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, double> > d_U_var;
     int d_U_scratch_idx = IBTK::invalid_index;
+
+    // Temporary patch data that are reused by each call to applyConvectiveOperator()
+    // unless the input database sets reuse_scratch_data = FALSE.
+    IBTK::ScratchPatchDataPool<SAMRAI::pdat::FaceData<NDIM, double> > d_face_scratch_data_pool;
+    IBTK::ScratchPatchDataPool<SAMRAI::pdat::SideData<NDIM, double> > d_side_scratch_data_pool;
+
+    // Tile size (in cells) used to process large patches; nonpositive values
+    // disable tiling.
+    int d_tile_size = 0;
 };
 } // namespace IBAMR
 
@@ -21,10 +21,13 @@
 #include "ibamr/ibamr_enums.h"
 
 #include "ibtk/HierarchyGhostCellInterpolation.h"
+#include "ibtk/ScratchPatchDataPool.h"
 #include "ibtk/ibtk_utilities.h"
 
+#include "FaceData.h"
 #include "IntVector.h"
 #include "PatchHierarchy.h"
+#include "SideData.h"
 #include "SideVariable.h"
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
@@ -196,6 +199,11 @@ private:
     // Scratch data.
     SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, double> > d_U_var;
     int d_U_scratch_idx = IBTK::invalid_index;
+
+    // Temporary patch data that are reused by each call to applyConvectiveOperator()
+    // unless the input database sets reuse_scratch_data = FALSE.
+    IBTK::ScratchPatchDataPool<SAMRAI::pdat::FaceData<NDIM, double> > d_face_scratch_data_pool;
+    IBTK::ScratchPatchDataPool<SAMRAI::pdat::SideData<NDIM, double> > d_side_scratch_data_pool;
 };
 } // namespace IBAMR
 
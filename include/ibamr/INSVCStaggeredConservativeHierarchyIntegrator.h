@@ -53,6 +53,11 @@ namespace IBAMR
  * momentum convection to obtain \f$N(\rho u)\f$ and mass advection to obtain \f$\rho^{n+1}\f$. Hence, a consistent
  * momentum and mass transport is carried out, which leads to stable solutions for high-density ratio flows.
  *
+ * If density error estimation is enabled in the input database <code>mass_momentum_integrator_db</code> (see
+ * INSVCStaggeredConservativeMassMomentumIntegrator), the time step size is additionally limited by the estimated
+ * error of the density update, so that the CFL number <code>cfl</code> can be chosen less conservatively. This only
+ * controls the size of the following time steps: a time step whose estimated error exceeds the tolerance is not
+ * rejected or repeated.
  */
 class INSVCStaggeredConservativeHierarchyIntegrator : public INSVCStaggeredHierarchyIntegrator
 {
@@ -161,6 +166,13 @@ public:
     SAMRAI::tbox::Pointer<ConvectiveOperator> getConvectiveOperator() override;
 
 protected:
+    /*!
+     * Return the maximum stable time step size, which also accounts for the
+     * estimated error of the density update when error estimation is enabled
+     * in the mass and momentum integrator.
+     */
+    double getMaximumTimeStepSizeSpecialized() override;
+
     /*!
      * Initialize data on a new level after it is inserted into an AMR patch
      * hierarchy by the gridding algorithm.
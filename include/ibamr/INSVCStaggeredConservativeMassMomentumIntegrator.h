@@ -84,6 +84,15 @@ namespace IBAMR
  * This operator is to be used in conjuction with the conservative form of the variable coefficient
  * Navier-Stokes equations, which will produce better results for high density ratio flows.
  *
+ * When the input database entry <code>density_error_tolerance</code> is positive and an SSPRK2 or SSPRK3 density
+ * update is used, the local error of the density update is estimated from the embedded lower-order solution of the
+ * SSPRK(2,1) or SSPRK(3,2) pair, which requires no additional flux evaluations. The largest time step size that keeps
+ * the relative error below the tolerance (scaled by <code>density_error_safety_factor</code>, which defaults to 0.9)
+ * is available through getMaximumTimeStepSize().
+ *
+ * \note The error estimate is used only to select the size of the next time step. A step whose estimated error exceeds
+ * the tolerance is accepted as it is; it is not rejected or repeated with a smaller time step size.
+ *
  * \see INSVCStaggeredHierarchyIntegrator
  */
 class INSVCStaggeredConservativeMassMomentumIntegrator : public virtual SAMRAI::tbox::DescribedClass
@@ -158,6 +167,14 @@ public:
      */
     int getUpdatedSideCenteredDensityPatchDataIndex();
 
+    /*!
+     * \brief Get the largest time step size allowed by the estimated local error of the most recent density update.
+     *
+     * \note If density error estimation is disabled or no update has been computed yet, this function returns
+     * std::numeric_limits<double>::max().
+     */
+    double getMaximumTimeStepSize() const;
+
     /*!
      * \brief Set an optional mass density source term.
      */
@@ -302,6 +319,12 @@ private:
      */
     void enforceDivergenceFreeConditionAtCoarseFineInterface(const int U_idx);
 
+    /*!
+     * \brief Estimate the local error of the density update from the embedded
+     * lower-order solution and compute the corresponding maximum time step size.
+     */
+    void estimateDensityError(double dt, int wgt_sc_idx);
+
     // Book keeping
     std::string d_object_name;
 
@@ -335,7 +358,7 @@ private:
         d_V_new_idx = IBTK::invalid_index, d_V_composite_idx, d_N_idx = IBTK::invalid_index;
     SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, double> > d_rho_sc_var;
     int d_rho_sc_current_idx = IBTK::invalid_index, d_rho_sc_scratch_idx = IBTK::invalid_index,
-        d_rho_sc_new_idx = IBTK::invalid_index;
+        d_rho_sc_new_idx = IBTK::invalid_index, d_rho_sc_embedded_idx = IBTK::invalid_index;
 
     // Hierarchy operation objects.
     SAMRAI::tbox::Pointer<SAMRAI::math::HierarchySideDataOpsReal<NDIM, double> > d_hier_sc_data_ops;
@@ -361,6 +384,11 @@ private:
     // Variable to indicate the density update time-stepping type.
     TimeSteppingType d_density_time_stepping_type = FORWARD_EULER;
 
+    // Parameters for the embedded error estimate of the density update; a
+    // nonpositive tolerance disables error estimation.
+    double d_density_error_tol = 0.0, d_density_error_safety_factor = 0.9;
+    double d_max_error_dt = std::numeric_limits<double>::max();
+
     // Source term variable and function for the mass density update.
     SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, double> > d_S_var;
     int d_S_scratch_idx = IBTK::invalid_index;
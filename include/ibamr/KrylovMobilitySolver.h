@@ -27,6 +27,7 @@
 
 #include "petscksp.h"
 
+#include <limits>
 #include <vector>
 
 namespace IBAMR
@@ -35,6 +36,7 @@ class StaggeredStokesSolver;
 class INSStaggeredHierarchyIntegrator;
 class StaggeredStokesPhysicalBoundaryHelper;
 class CIBStrategy;
+class HierarchicalMobilityOperator;
 } // namespace IBAMR
 namespace IBTK
 {
@@ -54,6 +56,15 @@ namespace IBAMR
  * operator, \f$ L \f$ is the Stokes operator, and \f$ S \f$ is the spreading
  * operator.
  *
+ * When <code>pc_type</code> is set to <code>"shell"</code>, the solver is
+ * preconditioned by the inverse of the block-diagonal part of the
+ * Rotne-Prager-Yamakawa approximation to \f$ M \f$ that is provided by class
+ * HierarchicalMobilityOperator, optionally followed by block Jacobi iterations
+ * that use the treecode approximation of the full RPY mobility matrix (see
+ * <code>num_pc_iterations</code>).  The parameters of the preconditioner are read
+ * from the optional input database <code>HierarchicalMobilityOperator</code>.
+ * The preconditioner is set up on the root processor and is rebuilt whenever
+ * the time step changes.
  */
 class KrylovMobilitySolver : public SAMRAI::tbox::DescribedClass
 {
@@ -254,6 +265,12 @@ private:
      */
     void destroyKSP();
 
+    /*!
+     * \brief Rebuild the mobility preconditioner for the marker positions at
+     * the midpoint of the current time interval, when necessary.
+     */
+    void resetMobilityPreconditioner();
+
     /*!
      * \name Static functions for use by PETSc KSP and MatShell objects.
      */
@@ -332,6 +349,12 @@ private:
 
     // Scaling parameters and force normalization of the problem.
     double d_scale_interp = 1.0, d_scale_spread = 1.0, d_reg_mob_factor = 0.0, d_normalize_spread_force;
+
+    // Mobility preconditioner.
+    SAMRAI::tbox::Pointer<IBAMR::HierarchicalMobilityOperator> d_mob_pc_op;
+    std::vector<unsigned> d_mob_pc_struct_ids;
+    double d_mob_pc_time = std::numeric_limits<double>::signaling_NaN();
+    double d_f_periodic_corr = 0.0;
 };
 } // namespace IBAMR
 
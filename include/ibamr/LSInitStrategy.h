@@ -106,6 +106,15 @@ public:
      */
     virtual void setReinitializeLSData(bool reinit_ls_data);
 
+    /*!
+     * \brief Set the half-width, in units of the local grid spacing, of the
+     * narrow band about the zero level set in which the signed distance is
+     * computed. Patches that do not intersect the band are skipped, and values
+     * outside the band are clamped to the band width. A nonpositive width (the
+     * default) reinitializes the level set over the entire patch hierarchy.
+     */
+    virtual void setNarrowBandWidth(double narrow_band_width);
+
     /*!
      * Write out object state to the given database.
      *
@@ -114,6 +123,28 @@ public:
     void putToDatabase(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db) override;
 
 protected:
+    /*!
+     * \brief Flag every patch whose data (including ghost cells) intersects the
+     * narrow band. Patches remain flagged once they enter the band, so the
+     * active region only grows over the course of a reinitialization. The
+     * flags should be cleared before the first call.
+     */
+    void updateNarrowBandPatches(int D_idx, SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy);
+
+    /*!
+     * \brief Whether the patch with the given number on level \em ln should be
+     * processed. Always true if narrow band reinitialization is disabled.
+     */
+    bool isNarrowBandPatch(int ln, int patch_num) const;
+
+    /*!
+     * \brief Clamp the interior values that lie outside the narrow band to the
+     * signed band width, either on all patches or only on the flagged ones.
+     */
+    void clampToNarrowBand(int D_idx,
+                           SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                           bool narrow_band_patches_only) const;
+
     // Book-keeping.
     std::string d_object_name;
     bool d_registered_for_restart;
@@ -128,8 +159,13 @@ protected:
     bool d_reinitialize_ls = false;
     int d_reinit_interval = 0;
 
+    // Narrow band half-width (in grid cells) and the per-level, per-patch flags
+    // indicating which patches intersect the band.
+    double d_narrow_band_width = 0.0;
+    std::vector<std::vector<bool> > d_narrow_band_patches;
+
     // Boundary condition object for level set.
-    SAMRAI::solv::RobinBcCoefStrategy<NDIM>* d_bc_coef;
+    SAMRAI::solv::RobinBcCoefStrategy<NDIM>* d_bc_coef = nullptr;
 
     // Neighborhood locating functions.
     std::vector<LocateInterfaceNeighborhoodFcnPtr> d_locate_interface_fcns;
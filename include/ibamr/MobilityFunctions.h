@@ -68,7 +68,7 @@ public:
                                                  double* mm);
 
     /*!
-     * \brief Construct the mobility matrix from Rotne-Pragner-Yamakawa tensor.
+     * \brief Construct the mobility matrix from Rotne-Prager-Yamakawa tensor.
      *
      * \param kernel_name IB kernel function.
      * \note Supported IB kernels are "IB_3", "IB_4" and "IB_6".
@@ -95,6 +95,38 @@ public:
                                            const int num_nodes,
                                            const double periodic_correction,
                                            double* mm);
+
+    /*!
+     * \brief Get the hydrodynamic radius of a marker.
+     *
+     * \param kernel_name IB kernel function.
+     * \note Supported IB kernels are "IB_3", "IB_4" and "IB_6".
+     *
+     * \param dx Cartesian grid spacing.
+     */
+    static double getHydrodynamicRadius(const char* kernel_name, const double dx);
+
+    /*!
+     * \brief Compute the NDIM x NDIM block of the Rotne-Prager-Yamakawa
+     * mobility matrix that couples two markers separated by the vector \em
+     * r_vec.
+     *
+     * \param r_vec Separation vector between the two markers.
+     *
+     * \param hydro_radius Hydrodynamic radius of the markers.
+     *
+     * \param mu Fluid viscosity.
+     *
+     * \param periodic_correction Input parameter for incorporating
+     * periodic domain correction. Set it to zero if not known.
+     *
+     * \param block Pointer to the (symmetric) mobility block.
+     */
+    static void getRPYMobilityBlock(const double* r_vec,
+                                    const double hydro_radius,
+                                    const double mu,
+                                    const double periodic_correction,
+                                    double* block);
 }; // MobilityFunctions
 
 } // namespace IBAMR
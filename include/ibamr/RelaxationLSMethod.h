@@ -62,6 +62,10 @@ namespace IBAMR
  * constraint assumes that \f$Q^0\f$ is already close to a signed distance function and
  * is hence, by default, disabled at initial time.
  *
+ * If the input key <code>narrow_band_width</code> is set to a positive value, only
+ * patches within that many grid cells of the interface are relaxed, and values
+ * outside of this band are clamped to the signed band width.
+ *
  *
  * References
  * Min, C., <A HREF="http://www.sciencedirect.com/science/article/pii/S0021999109007189">
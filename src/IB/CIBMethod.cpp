@@ -14,6 +14,7 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include "ibamr/CIBMethod.h"
+#include "ibamr/HierarchicalMobilityOperator.h"
 #include "ibamr/IBHierarchyIntegrator.h"
 #include "ibamr/MobilityFunctions.h"
 #include "ibamr/StokesSpecifications.h"
@@ -1450,6 +1451,50 @@ CIBMethod::constructMobilityMatrix(const std::string& /*mat_name*/,
     return;
 } // constructMobilityMatrix
 
+void
+CIBMethod::constructHierarchicalMobilityOperator(HierarchicalMobilityOperator& mobility_op,
+                                                 const std::vector<unsigned>& struct_ids,
+                                                 const double* grid_dx,
+                                                 const bool initial_time,
+                                                 double mu,
+                                                 double f_periodic_corr,
+                                                 const int managing_rank)
+{
+    const int struct_ln = getStructuresLevelNumber();
+    const char* ib_kernel = d_l_data_manager->getDefaultInterpKernelFunction().c_str();
+    const int rank = SAMRAI_MPI::getRank();
+
+    unsigned num_nodes = 0;
+    for (const auto& struct_id : struct_ids)
+    {
+        num_nodes += getNumberOfNodes(struct_id);
+    }
+
+    // Get the position data on the managing processor.
+    std::vector<double> XW;
+    if (rank == managing_rank) XW.resize(num_nodes * NDIM);
+    Vec X;
+    if (initial_time)
+    {
+        X = d_l_data_manager->getLData("X0_unshifted", struct_ln)->getVec();
+    }
+    else
+    {
+        std::vector<Pointer<LData> >* X_half_data;
+        bool* X_half_needs_ghost_fill;
+        getPositionData(&X_half_data, &X_half_needs_ghost_fill, d_half_time);
+        X = (*X_half_data)[struct_ln]->getVec();
+    }
+    copyVecToArray(X, XW.data(), struct_ids, /*depth*/ NDIM, managing_rank);
+
+    if (rank == managing_rank)
+    {
+        mobility_op.initializeOperatorState(ib_kernel, mu, grid_dx[0], XW.data(), num_nodes, f_periodic_corr);
+    }
+
+    return;
+} // constructHierarchicalMobilityOperator
+
 void
 CIBMethod::constructGeometricMatrix(const std::string& /*mat_name*/,
                                     Mat& geometric_mat,
@@ -817,6 +817,20 @@ CIBStrategy::constructMobilityMatrix(const std::string& /*mat_name*/,
     return;
 } // constructMobilityMatrix
 
+void
+CIBStrategy::constructHierarchicalMobilityOperator(HierarchicalMobilityOperator& /*mobility_op*/,
+                                                   const std::vector<unsigned>& /*struct_ids*/,
+                                                   const double* /*grid_dx*/,
+                                                   const bool /*initial_time*/,
+                                                   double /*mu*/,
+                                                   double /*f_periodic_corr*/,
+                                                   const int /*managing_rank*/)
+{
+    // intentionally left blank.
+
+    return;
+} // constructHierarchicalMobilityOperator
+
 void
 CIBStrategy::constructGeometricMatrix(const std::string& /*mat_name*/,
                                       Mat& /*geometric_mat*/,
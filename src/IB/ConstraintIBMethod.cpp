@@ -126,6 +126,42 @@ find_struct_handle_position(itr begin, itr end, const T& value)
     return -1;
 }
 
+// Helper class to sum several small arrays over all processors with a single
+// reduction. Arrays are registered with add() and are overwritten with their
+// global sums by reduce().
+class SumReductionBuffer
+{
+public:
+    inline void add(double* data, const int size)
+    {
+        d_arrays.emplace_back(data, size);
+        d_buffer_size += size;
+        return;
+    }
+
+    inline void reduce()
+    {
+        if (d_arrays.empty()) return;
+        std::vector<double> buffer;
+        buffer.reserve(d_buffer_size);
+        for (const auto& array : d_arrays) buffer.insert(buffer.end(), array.first, array.first + array.second);
+        SAMRAI_MPI::sumReduction(buffer.data(), d_buffer_size);
+        auto it = buffer.cbegin();
+        for (const auto& array : d_arrays)
+        {
+            std::copy(it, it + array.second, array.first);
+            it += array.second;
+        }
+        d_arrays.clear();
+        d_buffer_size = 0;
+        return;
+    }
+
+private:
+    std::vector<std::pair<double*, int> > d_arrays;
+    int d_buffer_size = 0;
+};
+
 #if (NDIM == 3)
 // Routine to solve 3X3 equation to get rigid body rotational velocity.
 inline void
@@ -921,25 +957,27 @@ ConstraintIBMethod::calculateCOMandMOIOfStructures()
         ptr_x_lag_data_new->restoreArrays();
     }
 
+    SumReductionBuffer com_reduction;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        com_reduction.add(d_center_of_mass_current[struct_no].data(),
+                          static_cast<int>(d_center_of_mass_current[struct_no].size()));
+        com_reduction.add(d_center_of_mass_new[struct_no].data(),
+                          static_cast<int>(d_center_of_mass_new[struct_no].size()));
+        com_reduction.add(&tagged_position[struct_no][0], 3);
+    }
+    com_reduction.reduce();
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
         const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
         const int total_nodes = struct_param.getTotalNodes();
 
-        SAMRAI_MPI::sumReduction(d_center_of_mass_current[struct_no].data(),
-                                 d_center_of_mass_current[struct_no].size());
-        SAMRAI_MPI::sumReduction(d_center_of_mass_new[struct_no].data(), d_center_of_mass_new[struct_no].size());
-
         for (int i = 0; i < 3; ++i)
         {
             d_center_of_mass_current[struct_no][i] /= total_nodes;
             d_center_of_mass_new[struct_no][i] /= total_nodes;
         }
-    }
-
-    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
-    {
-        SAMRAI_MPI::sumReduction(&tagged_position[struct_no][0], 3);
         d_tagged_pt_position[struct_no] = tagged_position[struct_no];
     }
 
@@ -1041,15 +1079,17 @@ ConstraintIBMethod::calculateCOMandMOIOfStructures()
         ptr_x_lag_data_new->restoreArrays();
     } // all levels
 
+    SumReductionBuffer moi_reduction;
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
         const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
         if (struct_param.getStructureIsSelfRotating())
         {
-            SAMRAI_MPI::sumReduction(&d_moment_of_inertia_current[struct_no](0, 0), 9);
-            SAMRAI_MPI::sumReduction(&d_moment_of_inertia_new[struct_no](0, 0), 9);
+            moi_reduction.add(&d_moment_of_inertia_current[struct_no](0, 0), 9);
+            moi_reduction.add(&d_moment_of_inertia_new[struct_no](0, 0), 9);
         }
     }
+    moi_reduction.reduce();
 
     // Fill-in symmetric part of inertia tensor.
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
@@ -1103,8 +1143,6 @@ ConstraintIBMethod::calculateKinematicsVelocity()
     // Theta_new = Theta_old + Omega_old*dt
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
-
         for (int d = 0; d < 3; ++d)
             d_incremented_angle_from_reference_axis[struct_no][d] +=
                 (d_rigid_rot_vel_current[struct_no][d] - d_omega_com_def_current[struct_no][d]) * dt;
@@ -1115,78 +1153,34 @@ ConstraintIBMethod::calculateKinematicsVelocity()
                                                           d_tagged_pt_position[struct_no]);
 
         d_ib_kinematics[struct_no]->setShape(d_FuRMoRP_new_time, d_incremented_angle_from_reference_axis[struct_no]);
-
-        if (struct_param.getStructureIsSelfTranslating()) calculateMomentumOfKinematicsVelocity(struct_no);
     }
 
+    calculateMomentumOfKinematicsVelocity();
+
     return;
 } // calculateKinematicsVelocity
 
 void
-ConstraintIBMethod::calculateMomentumOfKinematicsVelocity(const int position_handle)
+ConstraintIBMethod::calculateMomentumOfKinematicsVelocity()
 {
     using StructureParameters = ConstraintIBKinematics::StructureParameters;
-    Pointer<ConstraintIBKinematics> ptr_ib_kinematics = d_ib_kinematics[position_handle];
-    const StructureParameters& struct_param = ptr_ib_kinematics->getStructureParameters();
-    Array<int> calculate_trans_mom = struct_param.getCalculateTranslationalMomentum();
-    Array<int> calculate_rot_mom = struct_param.getCalculateRotationalMomentum();
-    const int coarsest_ln = struct_param.getCoarsestLevelNumber();
-    const int finest_ln = struct_param.getFinestLevelNumber();
-    const std::vector<std::pair<int, int> >& range = struct_param.getLagIdxRange();
-    const int total_nodes = struct_param.getTotalNodes();
-
-    // Zero out linear momentum of kinematics velocity of the structure.
-    for (int d = 0; d < 3; ++d) d_vel_com_def_new[position_handle][d] = 0.0;
-
-    // Calculate linear momentum
-    for (int ln = coarsest_ln, itr = 0; ln <= finest_ln && static_cast<unsigned int>(itr) < range.size(); ++ln, ++itr)
-    {
-#if !defined(NDEBUG)
-        TBOX_ASSERT(d_l_data_manager->levelContainsLagrangianData(ln));
-#endif
 
-        std::pair<int, int> lag_idx_range = range[itr];
-        const int offset = lag_idx_range.first;
-        double U_com_def[NDIM] = { 0.0 };
-
-        // Get LMesh corresponding to the present position of the structures
-        // on this level.
-        const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
-        const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
-        const std::vector<std::vector<double> >& def_vel = ptr_ib_kinematics->getKinematicsVelocity(ln);
-
-        for (const auto& node_idx : local_nodes)
-        {
-            const int lag_idx = node_idx->getLagrangianIndex();
-            if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
-            {
-                for (unsigned int d = 0; d < NDIM; ++d)
-                {
-                    U_com_def[d] += def_vel[d][lag_idx - offset];
-                }
-            }
-        }
-        for (int d = 0; d < NDIM; ++d)
-        {
-            d_vel_com_def_new[position_handle][d] += U_com_def[d];
-        }
-    }
-    SAMRAI_MPI::sumReduction(d_vel_com_def_new[position_handle].data(), d_vel_com_def_new[position_handle].size());
-
-    for (int d = 0; d < 3; ++d)
+    // Accumulate the local contributions of all self-translating structures,
+    // and sum them over all processors with a single reduction.
+    SumReductionBuffer reduction;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        if (calculate_trans_mom[d])
-            d_vel_com_def_new[position_handle][d] /= total_nodes;
-        else
-            d_vel_com_def_new[position_handle][d] = 0.0;
-    }
+        Pointer<ConstraintIBKinematics> ptr_ib_kinematics = d_ib_kinematics[struct_no];
+        const StructureParameters& struct_param = ptr_ib_kinematics->getStructureParameters();
+        if (!struct_param.getStructureIsSelfTranslating()) continue;
+        const int coarsest_ln = struct_param.getCoarsestLevelNumber();
+        const int finest_ln = struct_param.getFinestLevelNumber();
+        const std::vector<std::pair<int, int> >& range = struct_param.getLagIdxRange();
 
-    // Calculate angular momentum.
-    if (struct_param.getStructureIsSelfRotating())
-    {
-        // Zero out angular momentum of kinematics velocity of the structure.
-        for (int d = 0; d < 3; ++d) d_omega_com_def_new[position_handle][d] = 0.0;
+        // Zero out linear momentum of kinematics velocity of the structure.
+        for (int d = 0; d < 3; ++d) d_vel_com_def_new[struct_no][d] = 0.0;
 
+        // Calculate linear momentum
         for (int ln = coarsest_ln, itr = 0; ln <= finest_ln && static_cast<unsigned int>(itr) < range.size();
              ++ln, ++itr)
         {
@@ -1196,20 +1190,10 @@ ConstraintIBMethod::calculateMomentumOfKinematicsVelocity(const int position_han
 
             std::pair<int, int> lag_idx_range = range[itr];
             const int offset = lag_idx_range.first;
-            double R_cross_U_def[3] = { 0.0 };
-
-            // Get LData corresponding to the present position of the structures.
-            Pointer<LData> ptr_x_lag_data;
-            if (MathUtilities<double>::equalEps(d_FuRMoRP_current_time, 0.0))
-            {
-                ptr_x_lag_data = d_l_data_manager->getLData("X", ln);
-            }
-            else
-            {
-                ptr_x_lag_data = d_l_data_X_half_Euler[ln];
-            }
+            double U_com_def[NDIM] = { 0.0 };
 
-            const boost::multi_array_ref<double, 2>& X_data = *ptr_x_lag_data->getLocalFormVecArray();
+            // Get LMesh corresponding to the present position of the structures
+            // on this level.
             const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
             const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
             const std::vector<std::vector<double> >& def_vel = ptr_ib_kinematics->getKinematicsVelocity(ln);
@@ -1219,47 +1203,120 @@ ConstraintIBMethod::calculateMomentumOfKinematicsVelocity(const int position_han
                 const int lag_idx = node_idx->getLagrangianIndex();
                 if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
                 {
-                    const int local_idx = node_idx->getLocalPETScIndex();
-                    const double* const X = &X_data[local_idx][0];
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        U_com_def[d] += def_vel[d][lag_idx - offset];
+                    }
+                }
+            }
+            for (int d = 0; d < NDIM; ++d)
+            {
+                d_vel_com_def_new[struct_no][d] += U_com_def[d];
+            }
+        }
+        reduction.add(d_vel_com_def_new[struct_no].data(), static_cast<int>(d_vel_com_def_new[struct_no].size()));
+
+        // Calculate angular momentum.
+        if (struct_param.getStructureIsSelfRotating())
+        {
+            // Zero out angular momentum of kinematics velocity of the structure.
+            for (int d = 0; d < 3; ++d) d_omega_com_def_new[struct_no][d] = 0.0;
+
+            for (int ln = coarsest_ln, itr = 0; ln <= finest_ln && static_cast<unsigned int>(itr) < range.size();
+                 ++ln, ++itr)
+            {
+#if !defined(NDEBUG)
+                TBOX_ASSERT(d_l_data_manager->levelContainsLagrangianData(ln));
+#endif
+
+                std::pair<int, int> lag_idx_range = range[itr];
+                const int offset = lag_idx_range.first;
+                double R_cross_U_def[3] = { 0.0 };
+
+                // Get LData corresponding to the present position of the structures.
+                Pointer<LData> ptr_x_lag_data;
+                if (MathUtilities<double>::equalEps(d_FuRMoRP_current_time, 0.0))
+                {
+                    ptr_x_lag_data = d_l_data_manager->getLData("X", ln);
+                }
+                else
+                {
+                    ptr_x_lag_data = d_l_data_X_half_Euler[ln];
+                }
+
+                const boost::multi_array_ref<double, 2>& X_data = *ptr_x_lag_data->getLocalFormVecArray();
+                const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
+                const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
+                const std::vector<std::vector<double> >& def_vel = ptr_ib_kinematics->getKinematicsVelocity(ln);
+
+                for (const auto& node_idx : local_nodes)
+                {
+                    const int lag_idx = node_idx->getLagrangianIndex();
+                    if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
+                    {
+                        const int local_idx = node_idx->getLocalPETScIndex();
+                        const double* const X = &X_data[local_idx][0];
 #if (NDIM == 2)
-                    double x = X[0] - d_center_of_mass_new[position_handle][0];
-                    double y = X[1] - d_center_of_mass_new[position_handle][1];
-                    R_cross_U_def[2] += (x * (def_vel[1][lag_idx - offset]) - y * (def_vel[0][lag_idx - offset]));
+                        double x = X[0] - d_center_of_mass_new[struct_no][0];
+                        double y = X[1] - d_center_of_mass_new[struct_no][1];
+                        R_cross_U_def[2] += (x * (def_vel[1][lag_idx - offset]) - y * (def_vel[0][lag_idx - offset]));
 
 #endif
 
 #if (NDIM == 3)
-                    double x = X[0] - d_center_of_mass_new[position_handle][0];
-                    double y = X[1] - d_center_of_mass_new[position_handle][1];
-                    double z = X[2] - d_center_of_mass_new[position_handle][2];
+                        double x = X[0] - d_center_of_mass_new[struct_no][0];
+                        double y = X[1] - d_center_of_mass_new[struct_no][1];
+                        double z = X[2] - d_center_of_mass_new[struct_no][2];
 
-                    R_cross_U_def[0] += (y * (def_vel[2][lag_idx - offset]) - z * (def_vel[1][lag_idx - offset]));
+                        R_cross_U_def[0] += (y * (def_vel[2][lag_idx - offset]) - z * (def_vel[1][lag_idx - offset]));
 
-                    R_cross_U_def[1] += (-x * (def_vel[2][lag_idx - offset]) + z * (def_vel[0][lag_idx - offset]));
+                        R_cross_U_def[1] += (-x * (def_vel[2][lag_idx - offset]) + z * (def_vel[0][lag_idx - offset]));
 
-                    R_cross_U_def[2] += (x * (def_vel[1][lag_idx - offset]) - y * (def_vel[0][lag_idx - offset]));
+                        R_cross_U_def[2] += (x * (def_vel[1][lag_idx - offset]) - y * (def_vel[0][lag_idx - offset]));
 #endif
+                    }
                 }
-            }
-            for (int d = 0; d < 3; ++d)
-            {
-                d_omega_com_def_new[position_handle][d] += R_cross_U_def[d];
-            }
-            ptr_x_lag_data->restoreArrays();
-        } // all levels
-        SAMRAI_MPI::sumReduction(&d_omega_com_def_new[position_handle][0], 3);
+                for (int d = 0; d < 3; ++d)
+                {
+                    d_omega_com_def_new[struct_no][d] += R_cross_U_def[d];
+                }
+                ptr_x_lag_data->restoreArrays();
+            } // all levels
+            reduction.add(&d_omega_com_def_new[struct_no][0], 3);
+        } // if struct is rotating
+    }
+    reduction.reduce();
+
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
+        if (!struct_param.getStructureIsSelfTranslating()) continue;
+        Array<int> calculate_trans_mom = struct_param.getCalculateTranslationalMomentum();
+        Array<int> calculate_rot_mom = struct_param.getCalculateRotationalMomentum();
+        const int total_nodes = struct_param.getTotalNodes();
+
+        for (int d = 0; d < 3; ++d)
+        {
+            if (calculate_trans_mom[d])
+                d_vel_com_def_new[struct_no][d] /= total_nodes;
+            else
+                d_vel_com_def_new[struct_no][d] = 0.0;
+        }
 
+        if (struct_param.getStructureIsSelfRotating())
+        {
 // Find angular velocity of deformational velocity.
 #if (NDIM == 2)
-        d_omega_com_def_new[position_handle][2] /= d_moment_of_inertia_new[position_handle](2, 2);
+            d_omega_com_def_new[struct_no][2] /= d_moment_of_inertia_new[struct_no](2, 2);
 #endif
 
 #if (NDIM == 3)
-        solveSystemOfEqns(d_omega_com_def_new[position_handle], d_moment_of_inertia_new[position_handle]);
-        for (int d = 0; d < 3; ++d)
-            if (!calculate_rot_mom[d]) d_omega_com_def_new[position_handle][d] = 0.0;
+            solveSystemOfEqns(d_omega_com_def_new[struct_no], d_moment_of_inertia_new[struct_no]);
+            for (int d = 0; d < 3; ++d)
+                if (!calculate_rot_mom[d]) d_omega_com_def_new[struct_no][d] = 0.0;
 #endif
-    } // if struct is rotating
+        } // if struct is rotating
+    }
 
     return;
 } // calculateMomentumOfKinematicsVelocity
@@ -1469,12 +1526,23 @@ ConstraintIBMethod::calculateRigidTranslationalMomentum()
         d_l_data_U_interp[ln]->restoreArrays();
     } // all levels
 
+    SumReductionBuffer trans_reduction;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
+        if (struct_param.getStructureIsSelfTranslating())
+        {
+            trans_reduction.add(d_rigid_trans_vel_new[struct_no].data(),
+                                static_cast<int>(d_rigid_trans_vel_new[struct_no].size()));
+        }
+    }
+    trans_reduction.reduce();
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
         const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
         if (struct_param.getStructureIsSelfTranslating())
         {
-            SAMRAI_MPI::sumReduction(d_rigid_trans_vel_new[struct_no].data(), d_rigid_trans_vel_new[struct_no].size());
             Array<int> calculate_trans_mom = struct_param.getCalculateTranslationalMomentum();
             for (int d = 0; d < NDIM; ++d)
             {
@@ -1573,12 +1641,19 @@ ConstraintIBMethod::calculateRigidRotationalMomentum()
         d_l_data_X_half_Euler[ln]->restoreArrays();
     } // all levels
 
+    SumReductionBuffer rot_reduction;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
+        if (struct_param.getStructureIsSelfRotating()) rot_reduction.add(&d_rigid_rot_vel_new[struct_no][0], 3);
+    }
+    rot_reduction.reduce();
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
         const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
         if (struct_param.getStructureIsSelfRotating())
         {
-            SAMRAI_MPI::sumReduction(&d_rigid_rot_vel_new[struct_no][0], 3);
 #if (NDIM == 2)
             d_rigid_rot_vel_new[struct_no][2] /= d_moment_of_inertia_new[struct_no](2, 2);
 #endif
@@ -2418,10 +2493,16 @@ ConstraintIBMethod::calculateDrag()
         d_l_data_U_correction[ln]->restoreArrays();
     }
 
+    SumReductionBuffer reduction;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        reduction.add(&inertia_force[struct_no][0], 3);
+        reduction.add(&constraint_force[struct_no][0], 3);
+    }
+    reduction.reduce();
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        SAMRAI_MPI::sumReduction(&inertia_force[struct_no][0], 3);
-        SAMRAI_MPI::sumReduction(&constraint_force[struct_no][0], 3);
         for (int d = 0; d < NDIM; ++d)
         {
             inertia_force[struct_no][d] *= (d_rho_solid[struct_no] / dt) * d_vol_element[struct_no];
@@ -2528,10 +2609,16 @@ ConstraintIBMethod::calculateTorque()
         d_l_data_U_correction[ln]->restoreArrays();
         d_X_new_data[ln]->restoreArrays();
     }
+    SumReductionBuffer reduction;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        reduction.add(&inertia_torque[struct_no][0], 3);
+        reduction.add(&constraint_torque[struct_no][0], 3);
+    }
+    reduction.reduce();
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        SAMRAI_MPI::sumReduction(&inertia_torque[struct_no][0], 3);
-        SAMRAI_MPI::sumReduction(&constraint_torque[struct_no][0], 3);
         for (int d = 0; d < 3; ++d)
         {
             inertia_torque[struct_no][d] *= (d_rho_solid[struct_no] / dt) * d_vol_element[struct_no];
@@ -2610,10 +2697,16 @@ ConstraintIBMethod::calculatePower()
         d_l_data_U_correction[ln]->restoreArrays();
     }
 
+    SumReductionBuffer reduction;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        reduction.add(&inertia_power[struct_no][0], 3);
+        reduction.add(&constraint_power[struct_no][0], 3);
+    }
+    reduction.reduce();
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        SAMRAI_MPI::sumReduction(&inertia_power[struct_no][0], 3);
-        SAMRAI_MPI::sumReduction(&constraint_power[struct_no][0], 3);
         for (int d = 0; d < NDIM; ++d)
         {
             inertia_power[struct_no][d] *= (d_rho_solid[struct_no] / dt) * d_vol_element[struct_no];
@@ -2680,9 +2773,12 @@ ConstraintIBMethod::calculateStructureMomentum()
         d_l_data_U_new[ln]->restoreArrays();
     }
 
+    SumReductionBuffer reduction;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no) reduction.add(&d_structure_mom[struct_no][0], 3);
+    reduction.reduce();
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        SAMRAI_MPI::sumReduction(&d_structure_mom[struct_no][0], 3);
         for (int d = 0; d < NDIM; ++d)
         {
             d_structure_mom[struct_no][d] *= d_rho_solid[struct_no] * d_vol_element[struct_no];
@@ -2759,9 +2855,15 @@ ConstraintIBMethod::calculateStructureRotationalMomentum()
         d_l_data_U_new[ln]->restoreArrays();
         d_X_new_data[ln]->restoreArrays();
     }
+    SumReductionBuffer reduction;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        reduction.add(&d_structure_rotational_mom[struct_no][0], 3);
+    }
+    reduction.reduce();
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        SAMRAI_MPI::sumReduction(&d_structure_rotational_mom[struct_no][0], 3);
         for (int d = 0; d < 3; ++d)
         {
             d_structure_rotational_mom[struct_no][d] *= d_rho_solid[struct_no] * d_vol_element[struct_no];
@@ -60,6 +60,21 @@ extern "C"
                 const int& ldb,
                 int& info);
 
+    // BLAS function to compute a general matrix-matrix product.
+    void dgemm_(const char* transa,
+                const char* transb,
+                const int& m,
+                const int& n,
+                const int& k,
+                const double& alpha,
+                const double* a,
+                const int& lda,
+                const double* b,
+                const int& ldb,
+                const double& beta,
+                double* c,
+                const int& ldc);
+
     // LAPACK function to do SVD factorization.
     void dsyevr_(const char* jobz,
                  const char* range,
@@ -588,14 +603,11 @@ DirectMobilitySolver::constructBodyMobilityMatrix()
         MatCreateSeqDense(PETSC_COMM_SELF, row_size, col_size, product_mat_data.data(), &product_mat);
         MatCopy(geometric_mat, product_mat, SAME_NONZERO_PATTERN);
 
-        for (int col = 0; col < col_size; ++col)
-        {
-            double* col_data;
-            MatDenseGetArray(product_mat, &col_data);
-            computeSolution(
-                mobility_mat, mobility_inv_type, d_ipiv_map[mat_name].first.data(), &col_data[col * row_size]);
-            MatDenseRestoreArray(product_mat, &col_data);
-        }
+        // Solve for all columns of the product matrix at once.
+        double* product_data = nullptr;
+        MatDenseGetArray(product_mat, &product_data);
+        computeSolution(mobility_mat, mobility_inv_type, d_ipiv_map[mat_name].first.data(), product_data, col_size);
+        MatDenseRestoreArray(product_mat, &product_data);
         MatTransposeMatMult(geometric_mat, product_mat, MAT_REUSE_MATRIX, PETSC_DEFAULT, &body_mob_mat);
 
         MatDestroy(&product_mat);
@@ -783,7 +795,11 @@ DirectMobilitySolver::factorizeDenseMatrix(double* mat_data,
 } // factorizeDenseMatrix
 
 void
-DirectMobilitySolver::computeSolution(Mat& mat, const MobilityMatrixInverseType& inv_type, int* ipiv, double* rhs)
+DirectMobilitySolver::computeSolution(Mat& mat,
+                                      const MobilityMatrixInverseType& inv_type,
+                                      int* ipiv,
+                                      double* rhs,
+                                      const int nrhs)
 {
     // Get pointer to matrix.
     int mat_size;
@@ -794,7 +810,7 @@ DirectMobilitySolver::computeSolution(Mat& mat, const MobilityMatrixInverseType&
     int err = 0;
     if (inv_type == LAPACK_CHOLESKY)
     {
-        dpotrs_((char*)"L", mat_size, 1, mat_data, mat_size, rhs, mat_size, err);
+        dpotrs_((char*)"L", mat_size, nrhs, mat_data, mat_size, rhs, mat_size, err);
         if (err)
         {
             TBOX_ERROR("DirectMobilitySolver::computeSolution(). Solution failed using "
@@ -803,7 +819,7 @@ DirectMobilitySolver::computeSolution(Mat& mat, const MobilityMatrixInverseType&
     }
     else if (inv_type == LAPACK_LU)
     {
-        dgetrs_((char*)"N", mat_size, 1, mat_data, mat_size, ipiv, rhs, mat_size, err);
+        dgetrs_((char*)"N", mat_size, nrhs, mat_data, mat_size, ipiv, rhs, mat_size, err);
 
         if (err)
         {
@@ -813,24 +829,35 @@ DirectMobilitySolver::computeSolution(Mat& mat, const MobilityMatrixInverseType&
     }
     else if (inv_type == LAPACK_SVD)
     {
-        std::vector<double> temp(mat_size);
-        for (int i = 0; i < mat_size; ++i)
-        {
-            temp[i] = 0.0;
-            for (int j = 0; j < mat_size; ++j)
-            {
-                temp[i] += mat_data[i * mat_size + j] * rhs[j];
-            }
-        }
-
-        for (int i = 0; i < mat_size; ++i)
-        {
-            rhs[i] = 0.0;
-            for (int j = 0; j < mat_size; ++j)
-            {
-                rhs[i] += mat_data[j * mat_size + i] * temp[j];
-            }
-        }
+        // The factorization stores Z = V*inv(sqrt(W)), so that the solution is
+        // given by Z*Z^T*rhs.
+        std::vector<double> temp(mat_size * nrhs);
+        dgemm_((char*)"T",
+               (char*)"N",
+               mat_size,
+               nrhs,
+               mat_size,
+               1.0,
+               mat_data,
+               mat_size,
+               rhs,
+               mat_size,
+               0.0,
+               temp.data(),
+               mat_size);
+        dgemm_((char*)"N",
+               (char*)"N",
+               mat_size,
+               nrhs,
+               mat_size,
+               1.0,
+               mat_data,
+               mat_size,
+               temp.data(),
+               mat_size,
+               0.0,
+               rhs,
+               mat_size);
     }
     else
     {
@@ -0,0 +1,467 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2019 - 2019 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibamr/HierarchicalMobilityOperator.h"
+#include "ibamr/MobilityFunctions.h"
+#include "ibamr/namespaces.h"
+
+#include "tbox/Utilities.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <utility>
+
+extern "C"
+{
+    // LAPACK function to do Cholesky factorization.
+    int dpotrf_(const char* uplo, const int& n, double* a, const int& lda, int& info);
+
+    // LAPACK function to find solution using Cholesky factorization.
+    int dpotrs_(const char* uplo,
+                const int& n,
+                const int& nrhs,
+                const double* a,
+                const int& lda,
+                double* b,
+                const int& ldb,
+                int& info);
+}
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBAMR
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Compute the contraction T_d = sum_{k,e} (d/dr_k) M_de(r) D_ke of the gradient
+// of the far-field RPY tensor M(r) = A(r) I + B(r) r^r^ with the force dipole
+// moment D of a cluster.
+void
+contractRPYGradient(const double* r_vec, const double hydro_radius, const double mu, const double* D, double* T)
+{
+    const double a = hydro_radius;
+    const double mu_tt = 1.0 / (6.0 * M_PI * mu * a);
+    double r_sq = 0.0;
+    for (int d = 0; d < NDIM; ++d) r_sq += r_vec[d] * r_vec[d];
+    const double r = std::sqrt(r_sq);
+    const double a_cube = a * a * a;
+    const double B = mu_tt * (0.75 * a / r - 1.5 * a_cube / (r_sq * r));
+    const double dA = mu_tt * (-0.75 * a / r_sq - 1.5 * a_cube / (r_sq * r_sq));
+    const double dB = mu_tt * (-0.75 * a / r_sq + 4.5 * a_cube / (r_sq * r_sq));
+
+    double r_hat[NDIM], Dt_r_hat[NDIM], D_r_hat[NDIM];
+    for (int d = 0; d < NDIM; ++d) r_hat[d] = r_vec[d] / r;
+    double r_hat_D_r_hat = 0.0, trace_D = 0.0;
+    for (int d = 0; d < NDIM; ++d)
+    {
+        Dt_r_hat[d] = 0.0;
+        D_r_hat[d] = 0.0;
+        for (int k = 0; k < NDIM; ++k)
+        {
+            Dt_r_hat[d] += D[k * NDIM + d] * r_hat[k];
+            D_r_hat[d] += D[d * NDIM + k] * r_hat[k];
+        }
+        r_hat_D_r_hat += r_hat[d] * D_r_hat[d];
+        trace_D += D[d * NDIM + d];
+    }
+    for (int d = 0; d < NDIM; ++d)
+    {
+        T[d] = dA * Dt_r_hat[d] + (dB - 2.0 * B / r) * r_hat_D_r_hat * r_hat[d] +
+               B / r * (D_r_hat[d] + trace_D * r_hat[d]);
+    }
+    return;
+} // contractRPYGradient
+} // namespace
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+HierarchicalMobilityOperator::HierarchicalMobilityOperator(std::string object_name, Pointer<Database> input_db)
+    : d_object_name(std::move(object_name))
+{
+    if (input_db)
+    {
+        d_opening_angle = input_db->getDoubleWithDefault("opening_angle", d_opening_angle);
+        d_leaf_size = input_db->getIntegerWithDefault("leaf_size", d_leaf_size);
+        d_num_pc_iterations = input_db->getIntegerWithDefault("num_pc_iterations", d_num_pc_iterations);
+    }
+    if (d_opening_angle < 0.0 || d_opening_angle >= 1.0)
+    {
+        TBOX_ERROR(d_object_name << "::HierarchicalMobilityOperator():\n"
+                                 << "  opening_angle must be in the range [0,1)\n");
+    }
+    if (d_leaf_size < 1)
+    {
+        TBOX_ERROR(d_object_name << "::HierarchicalMobilityOperator():\n"
+                                 << "  leaf_size must be positive\n");
+    }
+    if (d_num_pc_iterations < 1)
+    {
+        TBOX_ERROR(d_object_name << "::HierarchicalMobilityOperator():\n"
+                                 << "  num_pc_iterations must be positive\n");
+    }
+    return;
+} // HierarchicalMobilityOperator
+
+void
+HierarchicalMobilityOperator::initializeOperatorState(const char* kernel_name,
+                                                      const double mu,
+                                                      const double dx,
+                                                      const double* X,
+                                                      const int num_nodes,
+                                                      const double periodic_correction)
+{
+    if (d_is_initialized) deallocateOperatorState();
+
+    d_mu = mu;
+    d_hydro_radius = MobilityFunctions::getHydrodynamicRadius(kernel_name, dx);
+    d_periodic_correction = periodic_correction;
+
+    // Build the cluster tree.
+    d_num_nodes = num_nodes;
+    d_perm.resize(d_num_nodes);
+    std::iota(d_perm.begin(), d_perm.end(), 0);
+    d_X_sorted.assign(X, X + NDIM * d_num_nodes);
+    if (d_num_nodes > 0) buildCluster(0, d_num_nodes);
+
+    // Store the marker positions in the sorted ordering.
+    for (int k = 0; k < d_num_nodes; ++k)
+    {
+        for (int d = 0; d < NDIM; ++d) d_X_sorted[NDIM * k + d] = X[NDIM * d_perm[k] + d];
+    }
+
+    factorizeLeafBlocks();
+
+    d_is_initialized = true;
+    return;
+} // initializeOperatorState
+
+void
+HierarchicalMobilityOperator::deallocateOperatorState()
+{
+    if (!d_is_initialized) return;
+
+    d_num_nodes = 0;
+    d_perm.clear();
+    d_X_sorted.clear();
+    d_clusters.clear();
+    d_leaves.clear();
+    d_leaf_factors.clear();
+
+    d_is_initialized = false;
+    return;
+} // deallocateOperatorState
+
+bool
+HierarchicalMobilityOperator::isInitialized() const
+{
+    return d_is_initialized;
+} // isInitialized
+
+int
+HierarchicalMobilityOperator::getNumberOfNodes() const
+{
+    return d_num_nodes;
+} // getNumberOfNodes
+
+void
+HierarchicalMobilityOperator::apply(const double* F, double* U) const
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_is_initialized);
+#endif
+    if (d_num_nodes == 0) return;
+
+    // Compute the net force F_c = sum_j F_j and the force dipole moment D_c =
+    // sum_j (X_j - X_c) F_j^T of each cluster.  Children are always stored
+    // after their parents, so that a reverse sweep visits the children first.
+    const auto num_clusters = static_cast<int>(d_clusters.size());
+    std::vector<double> F_cluster(NDIM * num_clusters, 0.0), D_cluster(NDIM * NDIM * num_clusters, 0.0);
+    for (int c = num_clusters - 1; c >= 0; --c)
+    {
+        const Cluster& cluster = d_clusters[c];
+        double* const F_c = &F_cluster[NDIM * c];
+        double* const D_c = &D_cluster[NDIM * NDIM * c];
+        if (cluster.child[0] < 0)
+        {
+            for (int k = cluster.begin; k < cluster.end; ++k)
+            {
+                const double* const F_k = &F[NDIM * d_perm[k]];
+                for (int d = 0; d < NDIM; ++d)
+                {
+                    F_c[d] += F_k[d];
+                    const double dX = d_X_sorted[NDIM * k + d] - cluster.center[d];
+                    for (int e = 0; e < NDIM; ++e) D_c[d * NDIM + e] += dX * F_k[e];
+                }
+            }
+        }
+        else
+        {
+            for (const int child : cluster.child)
+            {
+                const double* const F_child = &F_cluster[NDIM * child];
+                const double* const D_child = &D_cluster[NDIM * NDIM * child];
+                for (int d = 0; d < NDIM; ++d)
+                {
+                    F_c[d] += F_child[d];
+                    const double dX = d_clusters[child].center[d] - cluster.center[d];
+                    for (int e = 0; e < NDIM; ++e) D_c[d * NDIM + e] += D_child[d * NDIM + e] + dX * F_child[e];
+                }
+            }
+        }
+    }
+
+    // Traverse the tree for each marker.
+    std::vector<int> stack;
+    double r_vec[NDIM], block[NDIM * NDIM], T[NDIM];
+    for (int i = 0; i < d_num_nodes; ++i)
+    {
+        const double* const X_i = &d_X_sorted[NDIM * i];
+        double U_i[NDIM] = { 0.0 };
+        stack.assign(1, 0);
+        while (!stack.empty())
+        {
+            const Cluster& cluster = d_clusters[stack.back()];
+            const int c = stack.back();
+            stack.pop_back();
+
+            double dist_sq = 0.0;
+            for (int d = 0; d < NDIM; ++d)
+            {
+                r_vec[d] = X_i[d] - cluster.center[d];
+                dist_sq += r_vec[d] * r_vec[d];
+            }
+            const double dist = std::sqrt(dist_sq);
+            if (cluster.radius < d_opening_angle * dist && dist - cluster.radius > 2.0 * d_hydro_radius)
+            {
+                // Far field: interact with the net force and the force dipole
+                // of the cluster.
+                MobilityFunctions::getRPYMobilityBlock(r_vec, d_hydro_radius, d_mu, d_periodic_correction, block);
+                contractRPYGradient(r_vec, d_hydro_radius, d_mu, &D_cluster[NDIM * NDIM * c], T);
+                for (int d = 0; d < NDIM; ++d)
+                {
+                    for (int e = 0; e < NDIM; ++e) U_i[d] += block[d * NDIM + e] * F_cluster[NDIM * c + e];
+                    U_i[d] -= T[d];
+                }
+            }
+            else if (cluster.child[0] < 0)
+            {
+                // Near field: interact directly with the markers of the leaf.
+                for (int k = cluster.begin; k < cluster.end; ++k)
+                {
+                    for (int d = 0; d < NDIM; ++d) r_vec[d] = X_i[d] - d_X_sorted[NDIM * k + d];
+                    MobilityFunctions::getRPYMobilityBlock(r_vec, d_hydro_radius, d_mu, d_periodic_correction, block);
+                    const double* const F_k = &F[NDIM * d_perm[k]];
+                    for (int d = 0; d < NDIM; ++d)
+                    {
+                        for (int e = 0; e < NDIM; ++e) U_i[d] += block[d * NDIM + e] * F_k[e];
+                    }
+                }
+            }
+            else
+            {
+                stack.push_back(cluster.child[0]);
+                stack.push_back(cluster.child[1]);
+            }
+        }
+        for (int d = 0; d < NDIM; ++d) U[NDIM * d_perm[i] + d] = U_i[d];
+    }
+    return;
+} // apply
+
+void
+HierarchicalMobilityOperator::applyPreconditioner(const double* U, double* F) const
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_is_initialized);
+#endif
+    if (d_num_pc_iterations == 1)
+    {
+        applyLeafBlockInverse(U, F);
+        return;
+    }
+
+    // Perform block Jacobi iterations F <- F + D^{-1} (U - M F) for the
+    // treecode approximation of the mobility matrix.  U is copied first
+    // because it may share storage with F.
+    const int size = NDIM * d_num_nodes;
+    std::vector<double> U_copy(U, U + size), R(size);
+    applyLeafBlockInverse(U_copy.data(), F);
+    for (int it = 1; it < d_num_pc_iterations; ++it)
+    {
+        apply(F, R.data());
+        for (int k = 0; k < size; ++k) R[k] = U_copy[k] - R[k];
+        applyLeafBlockInverse(R.data(), R.data());
+        for (int k = 0; k < size; ++k) F[k] += R[k];
+    }
+    return;
+} // applyPreconditioner
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+int
+HierarchicalMobilityOperator::buildCluster(const int begin, const int end)
+{
+    const auto c = static_cast<int>(d_clusters.size());
+    d_clusters.emplace_back();
+    {
+        Cluster& cluster = d_clusters[c];
+        cluster.begin = begin;
+        cluster.end = end;
+        cluster.child[0] = cluster.child[1] = -1;
+    }
+
+    // Compute the centroid, the radius, and the bounding box of the markers.
+    // Note that d_X_sorted still stores the positions in the original
+    // ordering at this point.
+    std::array<double, NDIM> center, X_lower, X_upper;
+    center.fill(0.0);
+    X_lower.fill(std::numeric_limits<double>::max());
+    X_upper.fill(-std::numeric_limits<double>::max());
+    for (int k = begin; k < end; ++k)
+    {
+        const double* const X_k = &d_X_sorted[NDIM * d_perm[k]];
+        for (int d = 0; d < NDIM; ++d)
+        {
+            center[d] += X_k[d];
+            X_lower[d] = std::min(X_lower[d], X_k[d]);
+            X_upper[d] = std::max(X_upper[d], X_k[d]);
+        }
+    }
+    for (int d = 0; d < NDIM; ++d) center[d] /= static_cast<double>(end - begin);
+    double radius_sq = 0.0;
+    for (int k = begin; k < end; ++k)
+    {
+        const double* const X_k = &d_X_sorted[NDIM * d_perm[k]];
+        double dist_sq = 0.0;
+        for (int d = 0; d < NDIM; ++d) dist_sq += (X_k[d] - center[d]) * (X_k[d] - center[d]);
+        radius_sq = std::max(radius_sq, dist_sq);
+    }
+    d_clusters[c].center = center;
+    d_clusters[c].radius = std::sqrt(radius_sq);
+
+    if (end - begin <= d_leaf_size)
+    {
+        d_leaves.push_back(c);
+        return c;
+    }
+
+    // Bisect the markers along the direction of largest extent.
+    int split_dir = 0;
+    for (int d = 1; d < NDIM; ++d)
+    {
+        if (X_upper[d] - X_lower[d] > X_upper[split_dir] - X_lower[split_dir]) split_dir = d;
+    }
+    const int mid = begin + (end - begin) / 2;
+    std::nth_element(d_perm.begin() + begin,
+                     d_perm.begin() + mid,
+                     d_perm.begin() + end,
+                     [this, split_dir](const int a, const int b) {
+                         return d_X_sorted[NDIM * a + split_dir] < d_X_sorted[NDIM * b + split_dir];
+                     });
+    const int child_0 = buildCluster(begin, mid);
+    const int child_1 = buildCluster(mid, end);
+    d_clusters[c].child[0] = child_0;
+    d_clusters[c].child[1] = child_1;
+    return c;
+} // buildCluster
+
+void
+HierarchicalMobilityOperator::factorizeLeafBlocks()
+{
+    d_leaf_factors.resize(d_leaves.size());
+    double r_vec[NDIM], block[NDIM * NDIM];
+    for (unsigned int l = 0; l < d_leaves.size(); ++l)
+    {
+        const Cluster& leaf = d_clusters[d_leaves[l]];
+        const int num_leaf_nodes = leaf.end - leaf.begin;
+        const int block_size = NDIM * num_leaf_nodes;
+        std::vector<double>& mat = d_leaf_factors[l];
+        mat.resize(block_size * block_size);
+        for (int row = 0; row < num_leaf_nodes; ++row)
+        {
+            for (int col = 0; col < num_leaf_nodes; ++col)
+            {
+                for (int d = 0; d < NDIM; ++d)
+                {
+                    r_vec[d] = d_X_sorted[NDIM * (leaf.begin + row) + d] - d_X_sorted[NDIM * (leaf.begin + col) + d];
+                }
+                MobilityFunctions::getRPYMobilityBlock(r_vec, d_hydro_radius, d_mu, d_periodic_correction, block);
+                for (int idir = 0; idir < NDIM; ++idir)
+                {
+                    for (int jdir = 0; jdir < NDIM; ++jdir)
+                    {
+                        // column-major for LAPACK
+                        mat[(col * NDIM + jdir) * block_size + row * NDIM + idir] = block[idir * NDIM + jdir];
+                    }
+                }
+            }
+        }
+
+        int err = 0;
+        dpotrf_((char*)"L", block_size, mat.data(), block_size, err);
+        if (err)
+        {
+            TBOX_ERROR(d_object_name << "::factorizeLeafBlocks():\n"
+                                     << "  Cholesky factorization failed for leaf " << l << " with error code "
+                                     << err << "\n"
+                                     << "  the mobility matrix may not be positive definite; try reducing "
+                                        "the periodic correction\n");
+        }
+    }
+    return;
+} // factorizeLeafBlocks
+
+void
+HierarchicalMobilityOperator::applyLeafBlockInverse(const double* U, double* F) const
+{
+    std::vector<double> rhs;
+    for (unsigned int l = 0; l < d_leaves.size(); ++l)
+    {
+        const Cluster& leaf = d_clusters[d_leaves[l]];
+        const int block_size = NDIM * (leaf.end - leaf.begin);
+        rhs.resize(block_size);
+        for (int k = leaf.begin; k < leaf.end; ++k)
+        {
+            for (int d = 0; d < NDIM; ++d) rhs[NDIM * (k - leaf.begin) + d] = U[NDIM * d_perm[k] + d];
+        }
+
+        int err = 0;
+        dpotrs_((char*)"L", block_size, 1, d_leaf_factors[l].data(), block_size, rhs.data(), block_size, err);
+        if (err)
+        {
+            TBOX_ERROR(d_object_name << "::applyLeafBlockInverse():\n"
+                                     << "  Cholesky solve failed for leaf " << l << " with error code " << err
+                                     << "\n");
+        }
+
+        for (int k = leaf.begin; k < leaf.end; ++k)
+        {
+            for (int d = 0; d < NDIM; ++d) F[NDIM * d_perm[k] + d] = rhs[NDIM * (k - leaf.begin) + d];
+        }
+    }
+    return;
+} // applyLeafBlockInverse
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // namespace IBAMR
+
+//////////////////////////////////////////////////////////////////////////////
@@ -148,7 +148,9 @@ IBExplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const double current
     case BACKWARD_EULER:
     case TRAPEZOIDAL_RULE:
         if (d_enable_logging) plog << d_object_name << "::preprocessIntegrateHierarchy(): computing Lagrangian force\n";
+        startTelemetryPhase("compute_lagrangian_force");
         d_ib_method_ops->computeLagrangianForce(current_time);
+        stopTelemetryPhase("compute_lagrangian_force");
         if (d_enable_logging)
             plog << d_object_name
                  << "::preprocessIntegrateHierarchy(): spreading Lagrangian force "
@@ -156,8 +158,10 @@ IBExplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const double current
         d_hier_velocity_data_ops->setToScalar(d_f_idx, 0.0);
         d_u_phys_bdry_op->setPatchDataIndex(d_f_idx);
         d_u_phys_bdry_op->setHomogeneousBc(true);
+        startTelemetryPhase("spread_force");
         d_ib_method_ops->spreadForce(
             d_f_idx, d_u_phys_bdry_op, getProlongRefineSchedules(d_object_name + "::f"), current_time);
+        stopTelemetryPhase("spread_force");
         d_u_phys_bdry_op->setHomogeneousBc(false);
         if (d_f_current_idx != -1) d_hier_velocity_data_ops->copyData(d_f_current_idx, d_f_idx);
         break;
@@ -211,14 +215,18 @@ IBExplicitHierarchyIntegrator::integrateHierarchy(const double current_time, con
         break;
     case MIDPOINT_RULE:
         if (d_enable_logging) plog << d_object_name << "::integrateHierarchy(): computing Lagrangian force\n";
+        startTelemetryPhase("compute_lagrangian_force");
         d_ib_method_ops->computeLagrangianForce(half_time);
+        stopTelemetryPhase("compute_lagrangian_force");
         if (d_enable_logging)
             plog << d_object_name << "::integrateHierarchy(): spreading Lagrangian force to the Eulerian grid\n";
         d_hier_velocity_data_ops->setToScalar(d_f_idx, 0.0);
         d_u_phys_bdry_op->setPatchDataIndex(d_f_idx);
         d_u_phys_bdry_op->setHomogeneousBc(true);
+        startTelemetryPhase("spread_force");
         d_ib_method_ops->spreadForce(
             d_f_idx, d_u_phys_bdry_op, getProlongRefineSchedules(d_object_name + "::f"), half_time);
+        stopTelemetryPhase("spread_force");
         d_u_phys_bdry_op->setHomogeneousBc(false);
         break;
     case TRAPEZOIDAL_RULE:
@@ -226,14 +234,18 @@ IBExplicitHierarchyIntegrator::integrateHierarchy(const double current_time, con
         {
             // NOTE: We do not re-compute the force unless it could have changed.
             if (d_enable_logging) plog << d_object_name << "::integrateHierarchy(): computing Lagrangian force\n";
+            startTelemetryPhase("compute_lagrangian_force");
             d_ib_method_ops->computeLagrangianForce(new_time);
+            stopTelemetryPhase("compute_lagrangian_force");
             if (d_enable_logging)
                 plog << d_object_name << "::integrateHierarchy(): spreading Lagrangian force to the Eulerian grid\n";
             d_hier_velocity_data_ops->setToScalar(d_f_idx, 0.0);
             d_u_phys_bdry_op->setPatchDataIndex(d_f_idx);
             d_u_phys_bdry_op->setHomogeneousBc(true);
+            startTelemetryPhase("spread_force");
             d_ib_method_ops->spreadForce(
                 d_f_idx, d_u_phys_bdry_op, getProlongRefineSchedules(d_object_name + "::f"), new_time);
+            stopTelemetryPhase("spread_force");
             d_u_phys_bdry_op->setHomogeneousBc(false);
             d_hier_velocity_data_ops->linearSum(d_f_idx, 0.5, d_f_current_idx, 0.5, d_f_idx);
         }
@@ -260,8 +272,10 @@ IBExplicitHierarchyIntegrator::integrateHierarchy(const double current_time, con
         d_hier_pressure_data_ops->setToScalar(d_q_idx, 0.0);
         // NOTE: This does not correctly treat the case in which the structure
         // is close to the physical boundary.
+        startTelemetryPhase("spread_fluid_source");
         d_ib_method_ops->spreadFluidSource(
             d_q_idx, nullptr, getProlongRefineSchedules(d_object_name + "::q"), half_time);
+        stopTelemetryPhase("spread_fluid_source");
     }
 
     // Solve the incompressible Navier-Stokes equations.
@@ -297,10 +311,12 @@ IBExplicitHierarchyIntegrator::integrateHierarchy(const double current_time, con
                     "the Lagrangian mesh\n";
         d_u_phys_bdry_op->setPatchDataIndex(d_u_idx);
         d_u_phys_bdry_op->setHomogeneousBc(false);
+        startTelemetryPhase("interpolate_velocity");
         d_ib_method_ops->interpolateVelocity(d_u_idx,
                                              getCoarsenSchedules(d_object_name + "::u::CONSERVATIVE_COARSEN"),
                                              getGhostfillRefineSchedules(d_object_name + "::u"),
                                              new_time);
+        stopTelemetryPhase("interpolate_velocity");
         break;
     case MIDPOINT_RULE:
         d_hier_velocity_data_ops->linearSum(d_u_idx, 0.5, u_current_idx, 0.5, u_new_idx);
@@ -310,10 +326,12 @@ IBExplicitHierarchyIntegrator::integrateHierarchy(const double current_time, con
                     "the Lagrangian mesh\n";
         d_u_phys_bdry_op->setPatchDataIndex(d_u_idx);
         d_u_phys_bdry_op->setHomogeneousBc(false);
+        startTelemetryPhase("interpolate_velocity");
         d_ib_method_ops->interpolateVelocity(d_u_idx,
                                              getCoarsenSchedules(d_object_name + "::u::CONSERVATIVE_COARSEN"),
                                              getGhostfillRefineSchedules(d_object_name + "::u"),
                                              half_time);
+        stopTelemetryPhase("interpolate_velocity");
         break;
     case TRAPEZOIDAL_RULE:
         d_hier_velocity_data_ops->copyData(d_u_idx, u_new_idx);
@@ -323,10 +341,12 @@ IBExplicitHierarchyIntegrator::integrateHierarchy(const double current_time, con
                     "the Lagrangian mesh\n";
         d_u_phys_bdry_op->setPatchDataIndex(d_u_idx);
         d_u_phys_bdry_op->setHomogeneousBc(false);
+        startTelemetryPhase("interpolate_velocity");
         d_ib_method_ops->interpolateVelocity(d_u_idx,
                                              getCoarsenSchedules(d_object_name + "::u::CONSERVATIVE_COARSEN"),
                                              getGhostfillRefineSchedules(d_object_name + "::u"),
                                              new_time);
+        stopTelemetryPhase("interpolate_velocity");
         break;
     default:
         TBOX_ERROR(
@@ -417,10 +437,12 @@ IBExplicitHierarchyIntegrator::postprocessIntegrateHierarchy(const double curren
                 "velocity to the Lagrangian mesh\n";
     d_u_phys_bdry_op->setPatchDataIndex(d_u_idx);
     d_u_phys_bdry_op->setHomogeneousBc(false);
+    startTelemetryPhase("interpolate_velocity");
     d_ib_method_ops->interpolateVelocity(d_u_idx,
                                          getCoarsenSchedules(d_object_name + "::u::CONSERVATIVE_COARSEN"),
                                          getGhostfillRefineSchedules(d_object_name + "::u"),
                                          new_time);
+    stopTelemetryPhase("interpolate_velocity");
 
     // Synchronize new state data.
     if (!skip_synchronize_new_state_data)
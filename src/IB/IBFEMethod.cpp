@@ -35,8 +35,12 @@
 #include "BasePatchLevel.h"
 #include "BergerRigoutsos.h"
 #include "Box.h"
+#include "BoxGeometry.h"
+#include "BoxList.h"
+#include "BoxOverlap.h"
 #include "CartesianPatchGeometry.h"
 #include "CellIndex.h"
+#include "CellOverlap.h"
 #include "GriddingAlgorithm.h"
 #include "HierarchyDataOpsManager.h"
 #include "HierarchyDataOpsReal.h"
@@ -49,10 +53,13 @@
 #include "PatchLevel.h"
 #include "RefineOperator.h"
 #include "SideData.h"
+#include "SideGeometry.h"
 #include "SideIndex.h"
+#include "SideOverlap.h"
 #include "StandardTagAndInitialize.h"
 #include "Variable.h"
 #include "VariableDatabase.h"
+#include "VariableFillPattern.h"
 #include "tbox/Array.h"
 #include "tbox/Database.h"
 #include "tbox/MathUtilities.h"
@@ -107,6 +114,7 @@ IBTK_ENABLE_EXTRA_WARNINGS
 #include <cmath>
 #include <limits>
 #include <memory>
+#include <numeric>
 #include <ostream>
 #include <set>
 #include <string>
@@ -304,6 +312,87 @@ libmesh_restart_file_name(const std::string& restart_dump_dirname,
                      << std::setfill('0') << std::right << time_step_number << "." << extension;
     return file_name_prefix.str();
 }
+
+/*!
+ * Fill pattern which restricts the data copied between two patch levels to
+ * a list of boxes. This is used to transfer data between the primary and
+ * scratch hierarchies only in the vicinity of the structure. Only cell- and
+ * side-centered data are restricted: the full overlap is used for all other
+ * data centerings.
+ */
+class RestrictedBoxesFillPattern : public VariableFillPattern<NDIM>
+{
+public:
+    RestrictedBoxesFillPattern(const BoxList<NDIM>& boxes) : d_boxes(boxes)
+    {
+        // intentionally blank
+    }
+
+    Pointer<BoxOverlap<NDIM> > calculateOverlap(const BoxGeometry<NDIM>& dst_geometry,
+                                                const BoxGeometry<NDIM>& src_geometry,
+                                                const Box<NDIM>& /*dst_patch_box*/,
+                                                const Box<NDIM>& src_mask,
+                                                const bool overwrite_interior,
+                                                const IntVector<NDIM>& src_offset) const override
+    {
+        Pointer<BoxOverlap<NDIM> > box_geom_overlap =
+            dst_geometry.calculateOverlap(src_geometry, src_mask, overwrite_interior, src_offset);
+        TBOX_ASSERT(box_geom_overlap);
+        if (box_geom_overlap->isOverlapEmpty()) return box_geom_overlap;
+
+        Pointer<CellOverlap<NDIM> > cc_overlap = box_geom_overlap;
+        if (cc_overlap)
+        {
+            return new CellOverlap<NDIM>(restrictBoxes(cc_overlap->getDestinationBoxList(), -1), src_offset);
+        }
+        Pointer<SideOverlap<NDIM> > sc_overlap = box_geom_overlap;
+        if (sc_overlap)
+        {
+            BoxList<NDIM> dst_boxes[NDIM];
+            for (int axis = 0; axis < NDIM; ++axis)
+            {
+                dst_boxes[axis] = restrictBoxes(sc_overlap->getDestinationBoxList(axis), axis);
+            }
+            return new SideOverlap<NDIM>(dst_boxes, src_offset);
+        }
+        return box_geom_overlap;
+    }
+
+    IntVector<NDIM>& getStencilWidth() override
+    {
+        return d_stencil_width;
+    }
+
+    const std::string& getPatternName() const override
+    {
+        return d_pattern_name;
+    }
+
+private:
+    /*!
+     * Intersect the given overlap boxes with the restriction boxes. Here
+     * <code>axis</code> is -1 for cell-centered data and the direction of the
+     * side-centered data otherwise.
+     */
+    BoxList<NDIM> restrictBoxes(const BoxList<NDIM>& overlap_boxes, const int axis) const
+    {
+        BoxList<NDIM> dst_boxes;
+        for (BoxList<NDIM>::Iterator it1(overlap_boxes); it1; it1++)
+        {
+            for (BoxList<NDIM>::Iterator it2(d_boxes); it2; it2++)
+            {
+                const Box<NDIM> box = axis < 0 ? it2() : SideGeometry<NDIM>::toSideBox(it2(), axis);
+                const Box<NDIM> overlap_box = box * it1();
+                if (!overlap_box.empty()) dst_boxes.appendItem(overlap_box);
+            }
+        }
+        return dst_boxes;
+    }
+
+    const BoxList<NDIM> d_boxes;
+    IntVector<NDIM> d_stencil_width = IntVector<NDIM>(0);
+    const std::string d_pattern_name = "RESTRICTED_BOXES_FILL_PATTERN";
+};
 } // namespace
 
 const std::string IBFEMethod::COORDS_SYSTEM_NAME = "IB coordinates system";
@@ -647,6 +736,10 @@ IBFEMethod::preprocessIntegrateData(double current_time, double new_time, int nu
         }
     }
 
+    // Make sure that the structure stays inside of the regions in which data
+    // are transferred between the primary and scratch hierarchies.
+    updateScratchTransferBoxes(current_time, new_time);
+
     // Update the mask data.
     getVelocityHierarchyDataOps()->copyData(mask_new_idx, mask_current_idx);
     return;
@@ -737,14 +830,6 @@ IBFEMethod::interpolateVelocity(const int u_data_idx,
         if (u_ghost_fill_sched) u_ghost_fill_sched->fillData(data_time);
     }
 
-    if (d_use_scratch_hierarchy)
-    {
-        assertStructureOnFinestLevel();
-        getPrimaryToScratchSchedule(
-            d_hierarchy->getFinestLevelNumber(), u_data_idx, d_ib_solver->getVelocityPhysBdryOp())
-            .fillData(data_time);
-    }
-
     std::vector<PetscVector<double>*> U_vecs(d_num_parts), X_vecs(d_num_parts);
     for (unsigned int part = 0; part < d_num_parts; ++part)
     {
@@ -771,6 +856,15 @@ IBFEMethod::interpolateVelocity(const int u_data_idx,
     batch_vec_copy(X_vecs, d_X_IB_ghost_vecs);
     batch_vec_ghost_update(d_X_IB_ghost_vecs, INSERT_VALUES, SCATTER_FORWARD);
 
+    if (d_use_scratch_hierarchy)
+    {
+        assertStructureOnFinestLevel();
+        assertScratchTransferBoxesContainStructure(d_hierarchy->getFinestLevelNumber());
+        getPrimaryToScratchSchedule(
+            d_hierarchy->getFinestLevelNumber(), u_data_idx, d_ib_solver->getVelocityPhysBdryOp())
+            .fillData(data_time);
+    }
+
     // Build the right-hand-sides to compute the interpolated data.
     for (unsigned int part = 0; part < d_num_parts; ++part)
     {
@@ -932,6 +1026,7 @@ IBFEMethod::spreadForce(const int f_data_idx,
     if (d_use_scratch_hierarchy)
     {
         assertStructureOnFinestLevel();
+        assertScratchTransferBoxesContainStructure(d_hierarchy->getFinestLevelNumber());
         // TODO: we don't need a RefinePatchStrategy here, right?
         getPrimaryToScratchSchedule(d_hierarchy->getFinestLevelNumber(), f_data_idx).fillData(data_time);
     }
@@ -1094,6 +1189,7 @@ IBFEMethod::spreadFluidSource(const int q_data_idx,
     if (d_use_scratch_hierarchy)
     {
         assertStructureOnFinestLevel();
+        assertScratchTransferBoxesContainStructure(d_hierarchy->getFinestLevelNumber());
         getPrimaryToScratchSchedule(d_hierarchy->getFinestLevelNumber(), q_data_idx).fillData(data_time);
     }
 
@@ -1201,6 +1297,15 @@ IBFEMethod::initializeFEEquationSystems()
         }
 
         d_active_fe_data_managers[part]->setLoggingEnabled(d_do_log);
+        d_primary_fe_data_managers[part]->setUseMatrixFreeL2Projection(d_use_matrix_free_L2_projection);
+        d_primary_fe_data_managers[part]->setElementMappingDisplacementFraction(
+            d_elem_mapping_displacement_fraction);
+        if (d_use_scratch_hierarchy)
+        {
+            d_scratch_fe_data_managers[part]->setUseMatrixFreeL2Projection(d_use_matrix_free_L2_projection);
+            d_scratch_fe_data_managers[part]->setElementMappingDisplacementFraction(
+                d_elem_mapping_displacement_fraction);
+        }
         d_ghosts = IntVector<NDIM>::max(d_ghosts, d_active_fe_data_managers[part]->getGhostCellWidth());
 
         // Create FE equation systems objects and corresponding variables.
@@ -1751,14 +1856,18 @@ void IBFEMethod::endDataRedistribution(Pointer<PatchHierarchy<NDIM> > /*hierarch
         // patches (usually by taking into account the number of IB points on
         // each patch). Here is the other half: we inform libMesh of the
         // updated partitioning so that libMesh Elems and Nodes are on the
-        // same processor as the relevant SAMRAI patch.
+        // same processor as the relevant SAMRAI patch. If we use a scratch
+        // hierarchy then all Lagrangian-Eulerian interaction is done on its
+        // patches, so partition based on those instead.
         if (d_libmesh_partitioner_type == SAMRAI_BOX || (d_libmesh_partitioner_type == AUTOMATIC && workload_is_setup))
         {
+            const PatchHierarchy<NDIM>& partitioning_hierarchy =
+                d_use_scratch_hierarchy ? *d_scratch_hierarchy : *d_hierarchy;
             for (unsigned int part = 0; part < d_num_parts; ++part)
             {
                 EquationSystems& equation_systems = *d_active_fe_data_managers[part]->getEquationSystems();
                 MeshBase& mesh = equation_systems.get_mesh();
-                BoxPartitioner partitioner(*d_hierarchy, equation_systems.get_system(COORDS_SYSTEM_NAME));
+                BoxPartitioner partitioner(partitioning_hierarchy, equation_systems.get_system(COORDS_SYSTEM_NAME));
                 partitioner.repartition(mesh);
             }
         }
@@ -1776,6 +1885,7 @@ void IBFEMethod::endDataRedistribution(Pointer<PatchHierarchy<NDIM> > /*hierarch
             // clear existing data but do not allocate yet.
             d_scratch_transfer_forward_schedules.clear();
             d_scratch_transfer_backward_schedules.clear();
+            d_scratch_transfer_boxes_valid = false;
 
             for (unsigned int part = 0; part < d_num_parts; ++part)
             {
@@ -1809,6 +1919,16 @@ void IBFEMethod::endDataRedistribution(Pointer<PatchHierarchy<NDIM> > /*hierarch
             addWorkloadEstimate(d_scratch_hierarchy, d_lagrangian_workload_current_idx);
             if (d_do_log) plog << "IBFEMethod:: end scratch hierarchy workload" << std::endl;
         }
+
+        // All workload estimates for this regrid have been computed, so
+        // discount the costs measured since the previous one: otherwise costs
+        // measured when the structure was somewhere else would dominate the
+        // estimate. The primary and scratch data managers share the measured
+        // costs, so only decay them once.
+        for (unsigned int part = 0; part < d_num_parts; ++part)
+        {
+            d_primary_fe_data_managers[part]->decayMeasuredCosts();
+        }
     }
     return;
 } // endDataRedistribution
@@ -3370,10 +3490,29 @@ IBFEMethod::getPrimaryToScratchSchedule(const int level_number,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_number);
         Pointer<PatchLevel<NDIM> > scratch_level = d_scratch_hierarchy->getPatchLevel(level_number);
-        if (!scratch_level->checkAllocated(data_idx)) scratch_level->allocatePatchData(data_idx, 0.0);
+        if (!scratch_level->checkAllocated(data_idx))
+        {
+            scratch_level->allocatePatchData(data_idx, 0.0);
+            if (d_use_sparse_scratch_transfer)
+            {
+                // Data outside of the transfer boxes are never copied, so
+                // make sure that they are initialized.
+                Pointer<hier::Variable<NDIM> > var;
+                VariableDatabase<NDIM>::getDatabase()->mapIndexToVariable(data_idx, var);
+                Pointer<HierarchyDataOpsReal<NDIM, double> > data_ops =
+                    HierarchyDataOpsManager<NDIM>::getManager()->getOperationsDouble(var, d_scratch_hierarchy, true);
+                data_ops->resetLevels(level_number, level_number);
+                data_ops->setToScalar(data_idx, 0.0, /*interior_only*/ false);
+            }
+        }
         Pointer<RefineAlgorithm<NDIM> > refine_algorithm = new RefineAlgorithm<NDIM>();
         Pointer<RefineOperator<NDIM> > refine_op_f = nullptr;
-        refine_algorithm->registerRefine(data_idx, data_idx, data_idx, refine_op_f);
+        Pointer<VariableFillPattern<NDIM> > fill_pattern = nullptr;
+        if (d_use_sparse_scratch_transfer)
+        {
+            fill_pattern = new RestrictedBoxesFillPattern(getScratchTransferBoxes(level_number));
+        }
+        refine_algorithm->registerRefine(data_idx, data_idx, data_idx, refine_op_f, fill_pattern);
         d_scratch_transfer_forward_schedules[key] =
             refine_algorithm->createSchedule("DEFAULT_FILL", scratch_level, level, patch_strategy, false, nullptr);
     }
@@ -3393,13 +3532,227 @@ IBFEMethod::getScratchToPrimarySchedule(const int level_number,
         Pointer<PatchLevel<NDIM> > scratch_level = d_scratch_hierarchy->getPatchLevel(level_number);
         Pointer<RefineAlgorithm<NDIM> > refine_algorithm = new RefineAlgorithm<NDIM>();
         Pointer<RefineOperator<NDIM> > refine_op_b = nullptr;
-        refine_algorithm->registerRefine(data_idx, data_idx, data_idx, refine_op_b);
+        Pointer<VariableFillPattern<NDIM> > fill_pattern = nullptr;
+        if (d_use_sparse_scratch_transfer)
+        {
+            fill_pattern = new RestrictedBoxesFillPattern(getScratchTransferBoxes(level_number));
+        }
+        refine_algorithm->registerRefine(data_idx, data_idx, data_idx, refine_op_b, fill_pattern);
         d_scratch_transfer_backward_schedules[key] =
             refine_algorithm->createSchedule("DEFAULT_FILL", level, scratch_level, patch_strategy, false, nullptr);
     }
     return *d_scratch_transfer_backward_schedules[key];
 } // getScratchToPrimarySchedule
 
+const BoxList<NDIM>&
+IBFEMethod::getScratchTransferBoxes(const int level_number)
+{
+    TBOX_ASSERT(d_scratch_hierarchy);
+    if (d_scratch_transfer_boxes_valid) return d_scratch_transfer_boxes;
+
+    // The boxes around the nodes of each patch are grown by the ghost cell
+    // width (the extent of the regularized delta function kernel) and the
+    // distance the structure may move before the next regrid or, if it is
+    // larger, the distance it is predicted to move during the current time
+    // step.
+    std::vector<NumericVector<double>*> X_ghost_vecs(d_num_parts);
+    for (unsigned int part = 0; part < d_num_parts; ++part)
+    {
+        X_ghost_vecs[part] = d_scratch_fe_data_managers[part]->buildGhostedCoordsVector(/*localize_data*/ true);
+    }
+    const IntVector<NDIM> buffer = IntVector<NDIM>::max(IntVector<NDIM>(d_sparse_scratch_transfer_buffer),
+                                                        d_scratch_transfer_predicted_displacement);
+    d_scratch_transfer_patch_boxes = computeScratchTransferPatchBoxes(level_number, d_ghosts + buffer, X_ghost_vecs);
+    std::vector<int> local_box_data;
+    for (const Box<NDIM>& box : d_scratch_transfer_patch_boxes)
+    {
+        if (box.empty()) continue;
+        for (unsigned int d = 0; d < NDIM; ++d) local_box_data.push_back(box.lower()(d));
+        for (unsigned int d = 0; d < NDIM; ++d) local_box_data.push_back(box.upper()(d));
+    }
+
+    // Make the boxes available on all processors.
+    const int n_processes = SAMRAI_MPI::getNodes();
+    std::vector<int> box_data_sizes(n_processes), box_data_offsets(n_processes + 1, 0);
+    const int local_box_data_size = static_cast<int>(local_box_data.size());
+    int ierr =
+        MPI_Allgather(&local_box_data_size, 1, MPI_INT, box_data_sizes.data(), 1, MPI_INT, SAMRAI_MPI::commWorld);
+    TBOX_ASSERT(ierr == 0);
+    std::partial_sum(box_data_sizes.begin(), box_data_sizes.end(), box_data_offsets.begin() + 1);
+    std::vector<int> box_data(box_data_offsets.back());
+    ierr = MPI_Allgatherv(local_box_data.data(),
+                          local_box_data_size,
+                          MPI_INT,
+                          box_data.data(),
+                          box_data_sizes.data(),
+                          box_data_offsets.data(),
+                          MPI_INT,
+                          SAMRAI_MPI::commWorld);
+    TBOX_ASSERT(ierr == 0);
+
+    // Remove overlaps so that no data are transferred more than once.
+    d_scratch_transfer_boxes.clearItems();
+    for (std::size_t k = 0; k < box_data.size(); k += 2 * NDIM)
+    {
+        hier::Index<NDIM> lower, upper;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            lower(d) = box_data[k + d];
+            upper(d) = box_data[k + NDIM + d];
+        }
+        d_scratch_transfer_boxes.appendItem(Box<NDIM>(lower, upper));
+    }
+    d_scratch_transfer_boxes.simplifyBoxes();
+    d_scratch_transfer_boxes_valid = true;
+
+    if (d_do_log)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_scratch_hierarchy->getPatchLevel(level_number);
+        const BoxList<NDIM> level_boxes(level->getBoxes());
+        plog << d_object_name << "::getScratchTransferBoxes(): transferring data on "
+             << d_scratch_transfer_boxes.getTotalSizeOfBoxes() << " of " << level_boxes.getTotalSizeOfBoxes()
+             << " cells of level " << level_number << "\n";
+    }
+    return d_scratch_transfer_boxes;
+} // getScratchTransferBoxes
+
+std::vector<Box<NDIM> >
+IBFEMethod::computeScratchTransferPatchBoxes(const int level_number,
+                                             const IntVector<NDIM>& buffer,
+                                             const std::vector<NumericVector<double>*>& X_ghost_vecs)
+{
+    // Compute, for each local patch, the bounding box of the nodes of the
+    // elements associated with that patch.
+    Pointer<PatchLevel<NDIM> > level = d_scratch_hierarchy->getPatchLevel(level_number);
+    const Pointer<CartesianGridGeometry<NDIM> > grid_geom = level->getGridGeometry();
+    const IntVector<NDIM>& ratio = level->getRatio();
+    std::vector<Box<NDIM> > patch_boxes(level->getProcessorMapping().getNumberOfLocalIndices());
+    for (unsigned int part = 0; part < d_num_parts; ++part)
+    {
+        FEDataManager* const fe_data_manager = d_scratch_fe_data_managers[part];
+        const std::vector<std::vector<Node*> >& active_patch_node_map = fe_data_manager->getActivePatchNodeMap();
+        const unsigned int X_sys_num = fe_data_manager->getEquationSystems()->get_system(COORDS_SYSTEM_NAME).number();
+        const NumericVector<double>& X_ghost_vec = *X_ghost_vecs[part];
+        int local_patch_num = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
+        {
+            Box<NDIM>& box = patch_boxes[local_patch_num];
+            for (const Node* const node : active_patch_node_map[local_patch_num])
+            {
+                libMesh::Point X;
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    X(d) = X_ghost_vec(node->dof_number(X_sys_num, d, 0));
+                }
+                const hier::Index<NDIM> i = IndexUtilities::getCellIndex(X, grid_geom, ratio);
+                box = box.empty() ? Box<NDIM>(i, i) : box + Box<NDIM>(i, i);
+            }
+        }
+    }
+
+    // Grow the boxes by the buffer but do not extend them beyond the ghost
+    // regions of the patches, since no data outside of those regions are
+    // used.
+    int local_patch_num = 0;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
+    {
+        Box<NDIM>& box = patch_boxes[local_patch_num];
+        if (box.empty()) continue;
+        box.grow(buffer);
+        box = box * Box<NDIM>::grow(level->getPatch(p())->getBox(), d_ghosts);
+    }
+    return patch_boxes;
+} // computeScratchTransferPatchBoxes
+
+bool
+IBFEMethod::scratchTransferBoxesContainStructure(const int level_number,
+                                                 const IntVector<NDIM>& buffer,
+                                                 const std::vector<NumericVector<double>*>& X_ghost_vecs)
+{
+    TBOX_ASSERT(d_scratch_transfer_boxes_valid);
+    const std::vector<Box<NDIM> > patch_boxes =
+        computeScratchTransferPatchBoxes(level_number, d_ghosts + buffer, X_ghost_vecs);
+    TBOX_ASSERT(patch_boxes.size() == d_scratch_transfer_patch_boxes.size());
+    for (unsigned int k = 0; k < patch_boxes.size(); ++k)
+    {
+        const Box<NDIM>& box = patch_boxes[k];
+        const Box<NDIM>& transfer_box = d_scratch_transfer_patch_boxes[k];
+        if (box.empty()) continue;
+        if (!transfer_box.contains(box.lower()) || !transfer_box.contains(box.upper())) return false;
+    }
+    return true;
+} // scratchTransferBoxesContainStructure
+
+void
+IBFEMethod::updateScratchTransferBoxes(const double current_time, const double new_time)
+{
+    if (!d_use_scratch_hierarchy || !d_use_sparse_scratch_transfer) return;
+    const int level_number = d_hierarchy->getFinestLevelNumber();
+
+    // Predict the displacement of the structure during the time step from the
+    // largest component of the current velocity. One cell is added to allow
+    // for the velocity to change during the time step.
+    double U_max = 0.0;
+    for (unsigned int part = 0; part < d_num_parts; ++part)
+    {
+        const PetscVector<double>& U_vec = *d_U_current_vecs[part];
+        for (auto i = U_vec.first_local_index(); i < U_vec.last_local_index(); ++i)
+        {
+            U_max = std::max(U_max, std::abs(U_vec(i)));
+        }
+    }
+    U_max = SAMRAI_MPI::maxReduction(U_max);
+    Pointer<PatchLevel<NDIM> > level = d_scratch_hierarchy->getPatchLevel(level_number);
+    const Pointer<CartesianGridGeometry<NDIM> > grid_geom = level->getGridGeometry();
+    const double* const dx_coarsest = grid_geom->getDx();
+    const IntVector<NDIM>& ratio = level->getRatio();
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        const double dx = dx_coarsest[d] / static_cast<double>(ratio(d));
+        d_scratch_transfer_predicted_displacement(d) =
+            static_cast<int>(std::ceil((new_time - current_time) * U_max / dx)) + 1;
+    }
+
+    // Check the boxes, if they have already been computed, against the
+    // current positions of the nodes.
+    if (!d_scratch_transfer_boxes_valid) return;
+    batch_vec_copy(d_X_current_vecs, d_X_IB_ghost_vecs);
+    batch_vec_ghost_update(d_X_IB_ghost_vecs, INSERT_VALUES, SCATTER_FORWARD);
+    const std::vector<NumericVector<double>*> X_ghost_vecs(d_X_IB_ghost_vecs.begin(), d_X_IB_ghost_vecs.end());
+    const bool contained =
+        scratchTransferBoxesContainStructure(level_number, d_scratch_transfer_predicted_displacement, X_ghost_vecs);
+    if (SAMRAI_MPI::minReduction(contained ? 1 : 0) == 0)
+    {
+        // The structure may move further than anticipated when the transfer
+        // boxes were computed: recompute them along with all schedules that
+        // use them.
+        if (d_do_log)
+        {
+            plog << d_object_name << "::updateScratchTransferBoxes(): structure may move outside of the "
+                 << "scratch transfer boxes during the time step: recomputing them\n";
+        }
+        d_scratch_transfer_forward_schedules.clear();
+        d_scratch_transfer_backward_schedules.clear();
+        d_scratch_transfer_boxes_valid = false;
+    }
+    return;
+} // updateScratchTransferBoxes
+
+void
+IBFEMethod::assertScratchTransferBoxesContainStructure(const int level_number)
+{
+    if (!d_use_sparse_scratch_transfer) return;
+    getScratchTransferBoxes(level_number);
+    const std::vector<NumericVector<double>*> X_ghost_vecs(d_X_IB_ghost_vecs.begin(), d_X_IB_ghost_vecs.end());
+    if (!scratchTransferBoxesContainStructure(level_number, IntVector<NDIM>(0), X_ghost_vecs))
+    {
+        TBOX_ERROR(d_object_name << "::assertScratchTransferBoxesContainStructure():\n"
+                                 << "  the structure left the scratch transfer boxes during the time step.\n"
+                                 << "  increase sparse_scratch_transfer_buffer.\n");
+    }
+    return;
+} // assertScratchTransferBoxesContainStructure
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 void
@@ -3623,6 +3976,8 @@ IBFEMethod::getFromInput(Pointer<Database> db, bool /*is_from_restart*/)
     if (db->isBool("use_jump_conditions")) d_use_jump_conditions = db->getBool("use_jump_conditions");
     if (db->isBool("use_consistent_mass_matrix"))
         d_use_consistent_mass_matrix = db->getBool("use_consistent_mass_matrix");
+    if (db->isBool("use_matrix_free_L2_projection"))
+        d_use_matrix_free_L2_projection = db->getBool("use_matrix_free_L2_projection");
 
     // Restart settings.
     if (db->isString("libmesh_restart_file_extension"))
@@ -3661,8 +4016,22 @@ IBFEMethod::getFromInput(Pointer<Database> db, bool /*is_from_restart*/)
     {
         d_default_workload_spec.q_point_weight = db->getDouble("workload_quad_point_weight");
     }
+    if (db->keyExists("workload_use_measured_costs"))
+    {
+        d_default_workload_spec.use_measured_costs = db->getBool("workload_use_measured_costs");
+    }
+    if (db->keyExists("workload_measured_cost_retention"))
+    {
+        d_default_workload_spec.measured_cost_retention = db->getDouble("workload_measured_cost_retention");
+    }
+    if (db->keyExists("element_mapping_displacement_fraction"))
+    {
+        d_elem_mapping_displacement_fraction = db->getDouble("element_mapping_displacement_fraction");
+    }
 
     d_use_scratch_hierarchy = db->getBoolWithDefault("use_scratch_hierarchy", false);
+    d_use_sparse_scratch_transfer = db->getBoolWithDefault("use_sparse_scratch_transfer", false);
+    d_sparse_scratch_transfer_buffer = db->getIntegerWithDefault("sparse_scratch_transfer_buffer", 1);
     if (d_use_scratch_hierarchy)
     {
         if (!db->isDatabase("GriddingAlgorithm") || !db->isDatabase("LoadBalancer"))
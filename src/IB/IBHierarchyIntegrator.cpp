@@ -61,6 +61,7 @@
 #include "tbox/Utilities.h"
 
 #include <algorithm>
+#include <cmath>
 #include <ostream>
 #include <string>
 
@@ -362,6 +363,17 @@ IBHierarchyIntegrator::initializeHierarchyIntegrator(Pointer<PatchHierarchy<NDIM
         d_tag_buffer[i] = d_tag_buffer[i - 1];
     }
     d_ib_method_ops->setupTagBuffer(d_tag_buffer, d_gridding_alg);
+    if (d_regrid_structure_cfl_interval > 0.0)
+    {
+        // Ensure that the structure remains within the refined region until
+        // the next regrid.
+        const int min_tag_buffer = d_ib_method_ops->getMinimumGhostCellWidth().max() +
+                                   static_cast<int>(std::ceil(d_regrid_structure_cfl_interval));
+        for (int i = 0; i < d_tag_buffer.size(); ++i)
+        {
+            d_tag_buffer[i] = std::max(d_tag_buffer[i], min_tag_buffer);
+        }
+    }
 
     // Indicate that the integrator has been initialized.
     d_integrator_is_initialized = true;
@@ -510,6 +522,20 @@ IBHierarchyIntegrator::atRegridPointSpecialized() const
 {
     const bool initial_time = MathUtilities<double>::equalEps(d_integrator_time, d_start_time);
     if (initial_time) return true;
+    if (d_regrid_structure_cfl_interval > 0.0)
+    {
+        const double max_displacement = d_ib_method_ops->getMaxPointDisplacement();
+        if (max_displacement >= 0.0)
+        {
+            if (d_enable_logging)
+            {
+                plog << d_object_name << "::atRegridPoint(): maximum Lagrangian point displacement since last regrid = "
+                     << max_displacement << " meshwidths\n";
+            }
+            return (max_displacement >= d_regrid_structure_cfl_interval) ||
+                   (d_regrid_cfl_interval > 0.0 && d_regrid_cfl_estimate >= d_regrid_cfl_interval);
+        }
+    }
     if (d_regrid_cfl_interval > 0.0)
     {
         return (d_regrid_cfl_estimate >= d_regrid_cfl_interval);
@@ -637,6 +663,8 @@ void
 IBHierarchyIntegrator::getFromInput(Pointer<Database> db, bool /*is_from_restart*/)
 {
     if (db->keyExists("regrid_cfl_interval")) d_regrid_cfl_interval = db->getDouble("regrid_cfl_interval");
+    if (db->keyExists("regrid_structure_cfl_interval"))
+        d_regrid_structure_cfl_interval = db->getDouble("regrid_structure_cfl_interval");
     if (db->keyExists("error_on_dt_change"))
         d_error_on_dt_change = db->getBool("error_on_dt_change");
     else if (db->keyExists("error_on_timestep_change"))
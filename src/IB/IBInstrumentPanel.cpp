@@ -32,6 +32,7 @@
 #include "BasePatchLevel.h"
 #include "Box.h"
 #include "BoxArray.h"
+#include "BoxTree.h"
 #include "CartesianGridGeometry.h"
 #include "CartesianPatchGeometry.h"
 #include "CellData.h"
@@ -41,8 +42,10 @@
 #include "Patch.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
+#include "ProcessorMapping.h"
 #include "SideData.h"
 #include "SideIndex.h"
+#include "tbox/Array.h"
 #include "tbox/Database.h"
 #include "tbox/MathUtilities.h"
 #include "tbox/PIO.h"
@@ -305,6 +308,31 @@ build_meter_web(DBfile* dbfile,
 } // build_meter_web
 #endif
 
+// Return the number of the patch in the level that contains the cell index i,
+// or -1 if no patch in the level contains i.
+int
+find_patch_num(const Pointer<PatchLevel<NDIM> >& level, const hier::Index<NDIM>& i)
+{
+    Array<int> patch_num_arr;
+    level->getBoxTree()->findOverlapIndices(patch_num_arr, Box<NDIM>(i, i));
+    return patch_num_arr.size() > 0 ? patch_num_arr[0] : -1;
+} // find_patch_num
+
+inline Point
+cell_center(const hier::Index<NDIM>& i,
+            const hier::Index<NDIM>& patch_lower,
+            const double* const x_lower,
+            const double* const dx)
+{
+    return Point(x_lower[0] + dx[0] * (static_cast<double>(i(0) - patch_lower(0)) + 0.5),
+                 x_lower[1] + dx[1] * (static_cast<double>(i(1) - patch_lower(1)) + 0.5)
+#if (NDIM == 3)
+                     ,
+                 x_lower[2] + dx[2] * (static_cast<double>(i(2) - patch_lower(2)) + 0.5)
+#endif
+    );
+} // cell_center
+
 double
 linear_interp(const Point& X,
               const hier::Index<NDIM>& i_cell,
@@ -824,7 +852,7 @@ IBInstrumentPanel::initializeHierarchyDependentData(const Pointer<PatchHierarchy
         init_meter_elements(d_X_web[m], d_dA_web[m], d_X_perimeter[m], d_X_centroid[m]);
     }
 
-    // Setup the mappings from cell indices to the web patch and web centroid
+    // Setup the mappings from local patches to the web patch and web centroid
     // data.
     //
     // NOTE: Each meter web patch/centroid is assigned to precisely one
@@ -833,7 +861,8 @@ IBInstrumentPanel::initializeHierarchyDependentData(const Pointer<PatchHierarchy
     // the region of physical space in which the centroid of the web patch is
     // located.  Similarly, each web centroid is assigned to which ever grid
     // cell is the finest cell that contains the region of physical space in
-    // which the web centroid is located.
+    // which the web centroid is located.  The web patches and web centroids
+    // are then binned by the local patches that contain their cells.
     d_web_patch_map.clear();
     d_web_patch_map.resize(finest_ln + 1);
     d_web_centroid_map.clear();
@@ -863,6 +892,10 @@ IBInstrumentPanel::initializeHierarchyDependentData(const Pointer<PatchHierarchy
             finer_dx[d] = dx_coarsest[d] / static_cast<double>(finer_ratio(d));
         }
 
+        // The patches of each level are located with the box trees of the
+        // levels, so that the cost of binning the web patches and web centroids
+        // does not depend on the number of patches.
+        const ProcessorMapping& proc_mapping = level->getProcessorMapping();
         for (unsigned int l = 0; l < d_num_meters; ++l)
         {
             // Setup the web patch mapping.
@@ -879,14 +912,16 @@ IBInstrumentPanel::initializeHierarchyDependentData(const Pointer<PatchHierarchy
                                                                                    finer_dx.data(),
                                                                                    finer_domain_box_level_lower,
                                                                                    finer_domain_box_level_upper);
-                    if (level->getBoxes().contains(i) &&
-                        (ln == finest_ln || !finer_level->getBoxes().contains(finer_i)))
+                    const int patch_num = find_patch_num(level, i);
+                    if (patch_num >= 0 && proc_mapping.isMappingLocal(patch_num) &&
+                        (ln == finest_ln || find_patch_num(finer_level, finer_i) < 0))
                     {
                         WebPatch p;
                         p.meter_num = l;
                         p.X = &d_X_web[l][m][n];
                         p.dA = &d_dA_web[l][m][n];
-                        d_web_patch_map[ln].insert(std::make_pair(i, p));
+                        p.cell_idx = i;
+                        d_web_patch_map[ln][patch_num].push_back(p);
                     }
                 }
             }
@@ -901,12 +936,15 @@ IBInstrumentPanel::initializeHierarchyDependentData(const Pointer<PatchHierarchy
                                                                            finer_dx.data(),
                                                                            finer_domain_box_level_lower,
                                                                            finer_domain_box_level_upper);
-            if (level->getBoxes().contains(i) && (ln == finest_ln || !finer_level->getBoxes().contains(finer_i)))
+            const int patch_num = find_patch_num(level, i);
+            if (patch_num >= 0 && proc_mapping.isMappingLocal(patch_num) &&
+                (ln == finest_ln || find_patch_num(finer_level, finer_i) < 0))
             {
                 WebCentroid c;
                 c.meter_num = l;
                 c.X = &d_X_centroid[l];
-                d_web_centroid_map[ln].insert(std::make_pair(i, c));
+                c.cell_idx = i;
+                d_web_centroid_map[ln][patch_num].push_back(c);
             }
         }
     }
@@ -960,6 +998,12 @@ IBInstrumentPanel::readInstrumentData(const int U_data_idx,
         Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
+            const auto web_patch_it = d_web_patch_map[ln].find(p());
+            const auto web_centroid_it = d_web_centroid_map[ln].find(p());
+            const bool has_web_patches = web_patch_it != d_web_patch_map[ln].end();
+            const bool has_web_centroids = web_centroid_it != d_web_centroid_map[ln].end();
+            if (!has_web_patches && !has_web_centroids) continue;
+
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
             const Box<NDIM>& patch_box = patch->getBox();
             const hier::Index<NDIM>& patch_lower = patch_box.lower();
@@ -974,91 +1018,67 @@ IBInstrumentPanel::readInstrumentData(const int U_data_idx,
             Pointer<SideData<NDIM, double> > U_sc_data = patch->getPatchData(U_data_idx);
             Pointer<CellData<NDIM, double> > P_cc_data = patch->getPatchData(P_data_idx);
 
-            for (Box<NDIM>::Iterator b(patch_box); b; b++)
+            if (has_web_patches)
             {
-                const hier::Index<NDIM>& i = b();
-                std::pair<WebPatchMap::const_iterator, WebPatchMap::const_iterator> patch_range =
-                    d_web_patch_map[ln].equal_range(i);
-                if (patch_range.first != patch_range.second)
+                for (const auto& web_patch : web_patch_it->second)
                 {
-                    const Point X_cell(x_lower[0] + dx[0] * (static_cast<double>(i(0) - patch_lower(0)) + 0.5),
-                                       x_lower[1] + dx[1] * (static_cast<double>(i(1) - patch_lower(1)) + 0.5)
-#if (NDIM == 3)
-                                           ,
-                                       x_lower[2] + dx[2] * (static_cast<double>(i(2) - patch_lower(2)) + 0.5)
-#endif
-                    );
+                    const int& meter_num = web_patch.meter_num;
+                    const Point& X = *web_patch.X;
+                    const Vector& dA = *web_patch.dA;
+                    const hier::Index<NDIM>& i = web_patch.cell_idx;
+                    const Point X_cell = cell_center(i, patch_lower, x_lower, dx);
                     if (U_cc_data)
                     {
-                        for (auto it = patch_range.first; it != patch_range.second; ++it)
-                        {
-                            const int& meter_num = it->second.meter_num;
-                            const Point& X = *(it->second.X);
-                            const Vector& dA = *(it->second.dA);
-                            const Vector U = linear_interp<NDIM>(
-                                X, i, X_cell, *U_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
-                            d_flow_values[meter_num] += U.dot(dA);
-                        }
+                        const Vector U = linear_interp<NDIM>(
+                            X, i, X_cell, *U_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
+                        d_flow_values[meter_num] += U.dot(dA);
                     }
                     if (U_sc_data)
                     {
-                        for (auto it = patch_range.first; it != patch_range.second; ++it)
-                        {
-                            const int& meter_num = it->second.meter_num;
-                            const Point& X = *(it->second.X);
-                            const Vector& dA = *(it->second.dA);
-                            const Vector U =
-                                linear_interp(X, i, X_cell, *U_sc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
-                            d_flow_values[meter_num] += U.dot(dA);
-                        }
+                        const Vector U =
+                            linear_interp(X, i, X_cell, *U_sc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
+                        d_flow_values[meter_num] += U.dot(dA);
                     }
                     if (P_cc_data)
                     {
-                        for (auto it = patch_range.first; it != patch_range.second; ++it)
-                        {
-                            const int& meter_num = it->second.meter_num;
-                            const Point& X = *(it->second.X);
-                            const Vector& dA = *(it->second.dA);
-                            double P =
-                                linear_interp(X, i, X_cell, *P_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
-                            d_mean_pres_values[meter_num] += P * dA.norm();
-                            A[meter_num] += dA.norm();
-                        }
+                        const double P =
+                            linear_interp(X, i, X_cell, *P_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
+                        d_mean_pres_values[meter_num] += P * dA.norm();
+                        A[meter_num] += dA.norm();
                     }
                 }
+            }
 
-                std::pair<WebCentroidMap::const_iterator, WebCentroidMap::const_iterator> centroid_range =
-                    d_web_centroid_map[ln].equal_range(i);
-                if (centroid_range.first != centroid_range.second)
+            if (has_web_centroids && P_cc_data)
+            {
+                for (const auto& web_centroid : web_centroid_it->second)
                 {
-                    const Point X_cell(x_lower[0] + dx[0] * (static_cast<double>(i(0) - patch_lower(0)) + 0.5),
-                                       x_lower[1] + dx[1] * (static_cast<double>(i(1) - patch_lower(1)) + 0.5)
-#if (NDIM == 3)
-                                           ,
-                                       x_lower[2] + dx[2] * (static_cast<double>(i(2) - patch_lower(2)) + 0.5)
-#endif
-                    );
-                    if (P_cc_data)
-                    {
-                        for (auto it = centroid_range.first; it != centroid_range.second; ++it)
-                        {
-                            const int& meter_num = it->second.meter_num;
-                            const Point& X = *(it->second.X);
-                            const double P =
-                                linear_interp(X, i, X_cell, *P_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
-                            d_point_pres_values[meter_num] = P;
-                        }
-                    }
+                    const int& meter_num = web_centroid.meter_num;
+                    const Point& X = *web_centroid.X;
+                    const hier::Index<NDIM>& i = web_centroid.cell_idx;
+                    const Point X_cell = cell_center(i, patch_lower, x_lower, dx);
+                    const double P =
+                        linear_interp(X, i, X_cell, *P_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
+                    d_point_pres_values[meter_num] = P;
                 }
             }
         }
     }
 
     // Synchronize the values across all processes.
-    SAMRAI_MPI::sumReduction(&d_flow_values[0], d_num_meters);
-    SAMRAI_MPI::sumReduction(&d_mean_pres_values[0], d_num_meters);
-    SAMRAI_MPI::sumReduction(&d_point_pres_values[0], d_num_meters);
-    SAMRAI_MPI::sumReduction(&A[0], d_num_meters);
+    std::vector<double> meter_values;
+    meter_values.reserve(4 * d_num_meters);
+    meter_values.insert(meter_values.end(), d_flow_values.begin(), d_flow_values.end());
+    meter_values.insert(meter_values.end(), d_mean_pres_values.begin(), d_mean_pres_values.end());
+    meter_values.insert(meter_values.end(), d_point_pres_values.begin(), d_point_pres_values.end());
+    meter_values.insert(meter_values.end(), A.begin(), A.end());
+    SAMRAI_MPI::sumReduction(&meter_values[0], static_cast<int>(meter_values.size()));
+    const auto meter_values_begin = meter_values.cbegin();
+    std::copy(meter_values_begin, meter_values_begin + d_num_meters, d_flow_values.begin());
+    std::copy(meter_values_begin + d_num_meters, meter_values_begin + 2 * d_num_meters, d_mean_pres_values.begin());
+    std::copy(
+        meter_values_begin + 2 * d_num_meters, meter_values_begin + 3 * d_num_meters, d_point_pres_values.begin());
+    std::copy(meter_values_begin + 3 * d_num_meters, meter_values.cend(), A.begin());
 
     // Normalize the mean pressure.
     for (unsigned int m = 0; m < d_num_meters; ++m)
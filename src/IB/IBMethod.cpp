@@ -408,9 +408,11 @@ IBMethod::postprocessIntegrateData(double current_time, double new_time, int /*n
     }
 
     // Reset time-dependent Lagrangian data.
+    unsigned int num_local_nodes = 0;
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
+        num_local_nodes += d_l_data_manager->getNumberOfLocalNodes(ln);
         ierr = VecSwap(d_X_current_data[ln]->getVec(), d_X_new_data[ln]->getVec());
         IBTK_CHKERRQ(ierr);
         ierr = VecSwap(d_U_current_data[ln]->getVec(), d_U_new_data[ln]->getVec());
@@ -428,6 +430,7 @@ IBMethod::postprocessIntegrateData(double current_time, double new_time, int /*n
     }
     d_X_current_needs_ghost_fill = true;
     d_F_current_needs_ghost_fill = true;
+    d_ib_solver->recordTelemetryValue("num_local_lagrangian_nodes", num_local_nodes);
 
     // Deallocate Lagrangian scratch data.
     d_X_current_data.clear();
@@ -1511,12 +1514,62 @@ IBMethod::endDataRedistribution(Pointer<PatchHierarchy<NDIM> > hierarchy,
         X_data[ln]->restoreArrays();
     }
 
+    // Keep a copy of the positions, which are used to determine how far the IB
+    // points have moved since the hierarchy was regridded.
+    d_X_regrid_data.resize(hierarchy->getFinestLevelNumber() + 1);
+    for (int ln = 0; ln <= hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        d_X_regrid_data[ln].setNull();
+        if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
+        d_X_regrid_data[ln] = d_l_data_manager->createLData("X_regrid", ln, NDIM);
+        int ierr = VecCopy(X_data[ln]->getVec(), d_X_regrid_data[ln]->getVec());
+        IBTK_CHKERRQ(ierr);
+    }
+
     // Indicate that the force and source strategies need to be re-initialized.
     d_ib_force_fcn_needs_init = true;
     d_ib_source_fcn_needs_init = true;
     return;
 } // endDataRedistribution
 
+double
+IBMethod::getMaxPointDisplacement() const
+{
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
+    const double* const dx_coarsest = grid_geom->getDx();
+    double max_displacement = 0.0;
+    for (int ln = 0; ln <= d_hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
+        if (ln >= static_cast<int>(d_X_regrid_data.size()) || !d_X_regrid_data[ln])
+        {
+            // The positions at the last regrid are not available (e.g., after
+            // restarting), so force the hierarchy to be regridded.
+            max_displacement = std::numeric_limits<double>::max();
+            continue;
+        }
+        const IntVector<NDIM>& ratio = d_hierarchy->getPatchLevel(ln)->getRatio();
+        double dx_min = std::numeric_limits<double>::max();
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            dx_min = std::min(dx_min, dx_coarsest[d] / static_cast<double>(ratio(d)));
+        }
+        Pointer<LData> X_data = d_l_data_manager->getLData(LDataManager::POSN_DATA_NAME, ln);
+        const double* const X = X_data->getLocalFormVecArray()->data();
+        const double* const X_regrid = d_X_regrid_data[ln]->getLocalFormVecArray()->data();
+        const unsigned int num_local_values = NDIM * X_data->getLocalNodeCount();
+        double max_level_displacement = 0.0;
+        for (unsigned int k = 0; k < num_local_values; ++k)
+        {
+            max_level_displacement = std::max(max_level_displacement, std::abs(X[k] - X_regrid[k]));
+        }
+        X_data->restoreArrays();
+        d_X_regrid_data[ln]->restoreArrays();
+        max_displacement = std::max(max_displacement, max_level_displacement / dx_min);
+    }
+    return SAMRAI_MPI::maxReduction(max_displacement);
+} // getMaxPointDisplacement
+
 void
 IBMethod::initializeLevelData(Pointer<BasePatchHierarchy<NDIM> > hierarchy,
                               int level_number,
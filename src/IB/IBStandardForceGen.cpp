@@ -48,6 +48,7 @@ IBTK_ENABLE_EXTRA_WARNINGS
 #include <iterator>
 #include <limits>
 #include <map>
+#include <numeric>
 #include <ostream>
 #include <set>
 #include <utility>
@@ -108,6 +109,19 @@ resetLocalOrNonlocalPETScIndices(std::vector<int>& inds,
     }
     return;
 } // resetLocalOrNonlocalPETScIndices
+
+template <class T>
+void
+permuteValues(std::vector<T>& values, const std::vector<int>& perm)
+{
+    std::vector<T> permuted_values(values.size());
+    for (unsigned int k = 0; k < perm.size(); ++k)
+    {
+        permuted_values[k] = values[perm[k]];
+    }
+    values.swap(permuted_values);
+    return;
+} // permuteValues
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -190,6 +204,43 @@ IBStandardForceGen::initializeLevelData(const Pointer<PatchHierarchy<NDIM> > hie
     resetLocalOrNonlocalPETScIndices(
         d_beam_data[level_number].petsc_prev_node_idxs, global_node_offset, num_local_nodes, nonlocal_petsc_idxs);
 
+    // Reorder the springs and beams so that those that involve only local
+    // nodes come first.  The relative order of the springs and beams is
+    // otherwise preserved.
+    SpringData& spring_data = d_spring_data[level_number];
+    std::vector<int> spring_perm(spring_data.petsc_slave_node_idxs.size());
+    std::iota(spring_perm.begin(), spring_perm.end(), 0);
+    const auto interior_springs_end = std::stable_partition(spring_perm.begin(), spring_perm.end(), [&](const int k) {
+        return spring_data.petsc_slave_node_idxs[k] < num_local_nodes;
+    });
+    spring_data.num_interior_springs = static_cast<int>(std::distance(spring_perm.begin(), interior_springs_end));
+    permuteValues(spring_data.lag_mastr_node_idxs, spring_perm);
+    permuteValues(spring_data.lag_slave_node_idxs, spring_perm);
+    permuteValues(spring_data.petsc_mastr_node_idxs, spring_perm);
+    permuteValues(spring_data.petsc_slave_node_idxs, spring_perm);
+    permuteValues(spring_data.petsc_global_mastr_node_idxs, spring_perm);
+    permuteValues(spring_data.petsc_global_slave_node_idxs, spring_perm);
+    permuteValues(spring_data.force_fcns, spring_perm);
+    permuteValues(spring_data.force_deriv_fcns, spring_perm);
+    permuteValues(spring_data.parameters, spring_perm);
+
+    BeamData& beam_data = d_beam_data[level_number];
+    std::vector<int> beam_perm(beam_data.petsc_mastr_node_idxs.size());
+    std::iota(beam_perm.begin(), beam_perm.end(), 0);
+    const auto interior_beams_end = std::stable_partition(beam_perm.begin(), beam_perm.end(), [&](const int k) {
+        return beam_data.petsc_next_node_idxs[k] < num_local_nodes &&
+               beam_data.petsc_prev_node_idxs[k] < num_local_nodes;
+    });
+    beam_data.num_interior_beams = static_cast<int>(std::distance(beam_perm.begin(), interior_beams_end));
+    permuteValues(beam_data.petsc_mastr_node_idxs, beam_perm);
+    permuteValues(beam_data.petsc_next_node_idxs, beam_perm);
+    permuteValues(beam_data.petsc_prev_node_idxs, beam_perm);
+    permuteValues(beam_data.petsc_global_mastr_node_idxs, beam_perm);
+    permuteValues(beam_data.petsc_global_next_node_idxs, beam_perm);
+    permuteValues(beam_data.petsc_global_prev_node_idxs, beam_perm);
+    permuteValues(beam_data.rigidities, beam_perm);
+    permuteValues(beam_data.curvatures, beam_perm);
+
     const std::string level_number_str = std::to_string(level_number);
 
     d_X_ghost_data[level_number] =
@@ -302,15 +353,35 @@ IBStandardForceGen::computeLagrangianForce(Pointer<LData> F_data,
     IBTK_CHKERRQ(ierr);
     ierr = VecGhostUpdateBegin(X_ghost_data->getVec(), INSERT_VALUES, SCATTER_FORWARD);
     IBTK_CHKERRQ(ierr);
-    ierr = VecGhostUpdateEnd(X_ghost_data->getVec(), INSERT_VALUES, SCATTER_FORWARD);
-    IBTK_CHKERRQ(ierr);
 
-    // Compute the forces.
-    computeLagrangianSpringForce(F_ghost_data, X_ghost_data, hierarchy, level_number, data_time, l_data_manager);
-    computeLagrangianBeamForce(F_ghost_data, X_ghost_data, hierarchy, level_number, data_time, l_data_manager);
+    // Compute the forces that involve only local nodes while the positions of
+    // the ghost nodes are being communicated.
+    const int num_springs = static_cast<int>(d_spring_data[level_number].petsc_mastr_node_idxs.size());
+    const int num_interior_springs = d_spring_data[level_number].num_interior_springs;
+    const int num_beams = static_cast<int>(d_beam_data[level_number].petsc_mastr_node_idxs.size());
+    const int num_interior_beams = d_beam_data[level_number].num_interior_beams;
+    computeLagrangianSpringForce(
+        F_ghost_data, X_ghost_data, hierarchy, level_number, data_time, l_data_manager, 0, num_interior_springs);
+    computeLagrangianBeamForce(
+        F_ghost_data, X_ghost_data, hierarchy, level_number, data_time, l_data_manager, 0, num_interior_beams);
     computeLagrangianTargetPointForce(
         F_ghost_data, X_ghost_data, U_data, hierarchy, level_number, data_time, l_data_manager);
 
+    // Compute the remaining forces, which require the positions of the ghost
+    // nodes.
+    ierr = VecGhostUpdateEnd(X_ghost_data->getVec(), INSERT_VALUES, SCATTER_FORWARD);
+    IBTK_CHKERRQ(ierr);
+    computeLagrangianSpringForce(F_ghost_data,
+                                 X_ghost_data,
+                                 hierarchy,
+                                 level_number,
+                                 data_time,
+                                 l_data_manager,
+                                 num_interior_springs,
+                                 num_springs);
+    computeLagrangianBeamForce(
+        F_ghost_data, X_ghost_data, hierarchy, level_number, data_time, l_data_manager, num_interior_beams, num_beams);
+
     // Add the locally computed forces to the Lagrangian force vector.
     //
     // WARNING: The following operations may yield nondeterministic results in
@@ -838,20 +909,29 @@ IBStandardForceGen::computeLagrangianSpringForce(Pointer<LData> F_data,
                                                  const Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
                                                  const int level_number,
                                                  const double /*data_time*/,
-                                                 LDataManager* const /*l_data_manager*/)
+                                                 LDataManager* const /*l_data_manager*/,
+                                                 const int spring_begin,
+                                                 const int spring_end)
 {
-    const int num_springs = static_cast<int>(d_spring_data[level_number].lag_mastr_node_idxs.size());
-    const bool uses_springs = (num_springs > 0);
-    const int* const lag_mastr_node_idxs = uses_springs ? &d_spring_data[level_number].lag_mastr_node_idxs[0] : nullptr;
-    const int* const lag_slave_node_idxs = uses_springs ? &d_spring_data[level_number].lag_slave_node_idxs[0] : nullptr;
-    const int* const petsc_mastr_node_idxs =
-        uses_springs ? &d_spring_data[level_number].petsc_mastr_node_idxs[0] : nullptr;
-    const int* const petsc_slave_node_idxs =
-        uses_springs ? &d_spring_data[level_number].petsc_slave_node_idxs[0] : nullptr;
-    const SpringForceFcnPtr* const force_fcns = uses_springs ? &d_spring_data[level_number].force_fcns[0] : nullptr;
-    const double** const parameters = uses_springs ? &d_spring_data[level_number].parameters[0] : nullptr;
+    const int num_springs = spring_end - spring_begin;
+    if (num_springs <= 0) return;
+    const int* const lag_mastr_node_idxs = &d_spring_data[level_number].lag_mastr_node_idxs[spring_begin];
+    const int* const lag_slave_node_idxs = &d_spring_data[level_number].lag_slave_node_idxs[spring_begin];
+    const int* const petsc_mastr_node_idxs = &d_spring_data[level_number].petsc_mastr_node_idxs[spring_begin];
+    const int* const petsc_slave_node_idxs = &d_spring_data[level_number].petsc_slave_node_idxs[spring_begin];
+    const SpringForceFcnPtr* const force_fcns = &d_spring_data[level_number].force_fcns[spring_begin];
+    const double** const parameters = &d_spring_data[level_number].parameters[spring_begin];
     double* const F_node = F_data->getLocalFormVecArray()->data();
-    const double* const X_node = X_data->getGhostedLocalFormVecArray()->data();
+
+    // NOTE: The positions are accessed in read-only mode because a ghost update
+    // of X_data may be in progress.
+    int ierr;
+    Vec X_local_form_vec;
+    ierr = VecGhostGetLocalForm(X_data->getVec(), &X_local_form_vec);
+    IBTK_CHKERRQ(ierr);
+    const double* X_node;
+    ierr = VecGetArrayRead(X_local_form_vec, &X_node);
+    IBTK_CHKERRQ(ierr);
 
     static const int BLOCKSIZE = 16; // this parameter needs to be tuned
     int k, kblock, kunroll, mastr_idx, slave_idx;
@@ -947,7 +1027,10 @@ IBStandardForceGen::computeLagrangianSpringForce(Pointer<LData> F_data,
     }
 
     F_data->restoreArrays();
-    X_data->restoreArrays();
+    ierr = VecRestoreArrayRead(X_local_form_vec, &X_node);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecGhostRestoreLocalForm(X_data->getVec(), &X_local_form_vec);
+    IBTK_CHKERRQ(ierr);
     return;
 } // computeLagrangianSpringForce
 
@@ -1062,17 +1145,28 @@ IBStandardForceGen::computeLagrangianBeamForce(Pointer<LData> F_data,
                                                const Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
                                                const int level_number,
                                                const double /*data_time*/,
-                                               LDataManager* const /*l_data_manager*/)
+                                               LDataManager* const /*l_data_manager*/,
+                                               const int beam_begin,
+                                               const int beam_end)
 {
-    const int num_beams = static_cast<int>(d_beam_data[level_number].petsc_mastr_node_idxs.size());
-    const bool uses_beams = (num_beams > 0);
-    const int* const petsc_mastr_node_idxs = uses_beams ? &d_beam_data[level_number].petsc_mastr_node_idxs[0] : nullptr;
-    const int* const petsc_next_node_idxs = uses_beams ? &d_beam_data[level_number].petsc_next_node_idxs[0] : nullptr;
-    const int* const petsc_prev_node_idxs = uses_beams ? &d_beam_data[level_number].petsc_prev_node_idxs[0] : nullptr;
-    const double** const rigidities = uses_beams ? &d_beam_data[level_number].rigidities[0] : nullptr;
-    const Vector** const curvatures = uses_beams ? &d_beam_data[level_number].curvatures[0] : nullptr;
+    const int num_beams = beam_end - beam_begin;
+    if (num_beams <= 0) return;
+    const int* const petsc_mastr_node_idxs = &d_beam_data[level_number].petsc_mastr_node_idxs[beam_begin];
+    const int* const petsc_next_node_idxs = &d_beam_data[level_number].petsc_next_node_idxs[beam_begin];
+    const int* const petsc_prev_node_idxs = &d_beam_data[level_number].petsc_prev_node_idxs[beam_begin];
+    const double** const rigidities = &d_beam_data[level_number].rigidities[beam_begin];
+    const Vector** const curvatures = &d_beam_data[level_number].curvatures[beam_begin];
     double* const F_node = F_data->getLocalFormVecArray()->data();
-    const double* const X_node = X_data->getGhostedLocalFormVecArray()->data();
+
+    // NOTE: The positions are accessed in read-only mode because a ghost update
+    // of X_data may be in progress.
+    int ierr;
+    Vec X_local_form_vec;
+    ierr = VecGhostGetLocalForm(X_data->getVec(), &X_local_form_vec);
+    IBTK_CHKERRQ(ierr);
+    const double* X_node;
+    ierr = VecGetArrayRead(X_local_form_vec, &X_node);
+    IBTK_CHKERRQ(ierr);
 
     static const int BLOCKSIZE = 16; // This parameter needs to be tuned.
     int k, kblock, kunroll, mastr_idx, next_idx, prev_idx;
@@ -1164,7 +1258,10 @@ IBStandardForceGen::computeLagrangianBeamForce(Pointer<LData> F_data,
     }
 
     F_data->restoreArrays();
-    X_data->restoreArrays();
+    ierr = VecRestoreArrayRead(X_local_form_vec, &X_node);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecGhostRestoreLocalForm(X_data->getVec(), &X_local_form_vec);
+    IBTK_CHKERRQ(ierr);
     return;
 } // computeLagrangianBeamForce
 
@@ -1239,9 +1336,18 @@ IBStandardForceGen::computeLagrangianTargetPointForce(Pointer<LData> F_data,
     const double** const eta = uses_target_points ? &d_target_point_data[level_number].eta[0] : nullptr;
     const Point** const X0 = uses_target_points ? &d_target_point_data[level_number].X0[0] : nullptr;
     double* const F_node = F_data->getLocalFormVecArray()->data();
-    const double* const X_node = X_data->getLocalFormVecArray()->data();
     const double* const U_node = U_data->getLocalFormVecArray()->data();
 
+    // NOTE: The positions are accessed in read-only mode because a ghost update
+    // of X_data may be in progress.
+    int ierr;
+    Vec X_local_form_vec;
+    ierr = VecGhostGetLocalForm(X_data->getVec(), &X_local_form_vec);
+    IBTK_CHKERRQ(ierr);
+    const double* X_node;
+    ierr = VecGetArrayRead(X_local_form_vec, &X_node);
+    IBTK_CHKERRQ(ierr);
+
     static const int BLOCKSIZE = 16; // This parameter needs to be tuned.
     int k, kblock, kunroll, idx;
     double K, E, dX;
@@ -1315,8 +1421,11 @@ IBStandardForceGen::computeLagrangianTargetPointForce(Pointer<LData> F_data,
     }
 
     F_data->restoreArrays();
-    X_data->restoreArrays();
     U_data->restoreArrays();
+    ierr = VecRestoreArrayRead(X_local_form_vec, &X_node);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecGhostRestoreLocalForm(X_data->getVec(), &X_local_form_vec);
+    IBTK_CHKERRQ(ierr);
     return;
 } // computeLagrangianTargetPointForce
 
@@ -241,6 +241,12 @@ void IBStrategy::endDataRedistribution(Pointer<PatchHierarchy<NDIM> > /*hierarch
     return;
 } // endDataRedistribution
 
+double
+IBStrategy::getMaxPointDisplacement() const
+{
+    return -1.0;
+} // getMaxPointDisplacement
+
 void
 IBStrategy::initializeLevelData(Pointer<BasePatchHierarchy<NDIM> > /*hierarchy*/,
                                 int /*level_number*/,
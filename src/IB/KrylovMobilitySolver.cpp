@@ -14,6 +14,7 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include "ibamr/CIBStrategy.h"
+#include "ibamr/HierarchicalMobilityOperator.h"
 #include "ibamr/IBStrategy.h"
 #include "ibamr/INSStaggeredHierarchyIntegrator.h"
 #include "ibamr/KrylovMobilitySolver.h"
@@ -30,10 +31,15 @@
 #include "ibtk/SCPoissonSolverManager.h"
 #include "ibtk/ibtk_utilities.h"
 
+#include "CartesianGridGeometry.h"
+#include "PatchHierarchy.h"
+#include "PatchLevel.h"
 #include "petsc/private/petscimpl.h"
+#include "tbox/SAMRAI_MPI.h"
 #include "tbox/TimerManager.h"
 
 #include <limits>
+#include <numeric>
 
 namespace IBAMR
 {
@@ -76,6 +82,12 @@ KrylovMobilitySolver::KrylovMobilitySolver(std::string object_name,
     // Get values from the input database.
     if (input_db) getFromInput(input_db);
 
+    // Create the operator used to precondition the mobility problem.
+    Pointer<Database> mob_pc_db = input_db->isDatabase("HierarchicalMobilityOperator") ?
+                                      input_db->getDatabase("HierarchicalMobilityOperator") :
+                                      Pointer<Database>(nullptr);
+    d_mob_pc_op = new HierarchicalMobilityOperator(d_object_name + "::HierarchicalMobilityOperator", mob_pc_db);
+
     // Create the Stokes solver (LInv) for the linear operator.
     // Create databases for setting up LInv solver.
     std::string stokes_solver_type = StaggeredStokesSolverManager::PETSC_KRYLOV_SOLVER;
@@ -500,6 +512,10 @@ KrylovMobilitySolver::deallocateSolverState()
     d_petsc_x = nullptr;
     d_petsc_b = nullptr;
 
+    // Deallocate the mobility preconditioner.
+    d_mob_pc_op->deallocateOperatorState();
+    d_mob_pc_time = std::numeric_limits<double>::signaling_NaN();
+
     // Destroy the KSP solver.
     destroyKSP();
 
@@ -530,6 +546,8 @@ KrylovMobilitySolver::getFromInput(Pointer<Database> input_db)
     if (input_db->keyExists("normalize_pressure")) d_normalize_pressure = input_db->getBool("normalize_pressure");
     if (input_db->keyExists("normalize_velocity")) d_normalize_velocity = input_db->getBool("normalize_velocity");
     if (input_db->keyExists("enable_logging")) d_enable_logging = input_db->getBool("enable_logging");
+    if (input_db->keyExists("f_periodic_correction"))
+        d_f_periodic_corr = input_db->getDouble("f_periodic_correction");
 } // getFromInput
 
 void
@@ -864,6 +882,39 @@ KrylovMobilitySolver::resetKSPPC()
     }
 } // resetKSPPC
 
+void
+KrylovMobilitySolver::resetMobilityPreconditioner()
+{
+    const double half_time = 0.5 * (d_new_time + d_current_time);
+    if (d_mob_pc_time == half_time) return;
+
+    // Get the grid spacing on the finest level, on which the structures live.
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    const IntVector<NDIM>& ratio = d_hierarchy->getPatchLevel(finest_ln)->getRatio();
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
+    const double* const dx0 = grid_geom->getDx();
+    double dx[NDIM];
+    for (int d = 0; d < NDIM; ++d) dx[d] = dx0[d] / ratio(d);
+
+    // Build the preconditioner for all of the structures on the root processor.
+    d_mob_pc_struct_ids.resize(d_cib_strategy->getNumberOfRigidStructures());
+    std::iota(d_mob_pc_struct_ids.begin(), d_mob_pc_struct_ids.end(), 0);
+    const double mu = d_ins_integrator->getStokesSpecifications()->getMu();
+    d_cib_strategy->constructHierarchicalMobilityOperator(*d_mob_pc_op,
+                                                          d_mob_pc_struct_ids,
+                                                          dx,
+                                                          /*initial_time*/ false,
+                                                          mu,
+                                                          d_f_periodic_corr,
+                                                          /*managing_rank*/ 0);
+    if (SAMRAI_MPI::getRank() == 0 && !d_mob_pc_op->isInitialized())
+    {
+        TBOX_ERROR(d_object_name << "::resetMobilityPreconditioner():\n"
+                                 << "  the CIBStrategy object does not provide a hierarchical mobility operator\n");
+    }
+    d_mob_pc_time = half_time;
+} // resetMobilityPreconditioner
+
 PetscErrorCode
 KrylovMobilitySolver::MatVecMult_KMInv(Mat A, Vec x, Vec y)
 {
@@ -943,11 +994,33 @@ KrylovMobilitySolver::MatVecMult_KMInv(Mat A, Vec x, Vec y)
     PetscFunctionReturn(0);
 } // MatVecMult_KMInv
 
-// Routine to apply DirectMobility preconditioner
-PetscErrorCode KrylovMobilitySolver::PCApply_KMInv(PC /*pc*/, Vec /*x*/, Vec /*y*/)
+// Routine to apply the hierarchical mobility preconditioner
+PetscErrorCode
+KrylovMobilitySolver::PCApply_KMInv(PC pc, Vec x, Vec y)
 {
-    TBOX_ERROR(
-        "KrylovMobilitySolver::PCApply_KMInv(). Shell Preconditioner for KrylovMobilitySolver not implemented.\n");
+    void* ctx;
+    PCShellGetContext(pc, &ctx);
+    auto solver = static_cast<KrylovMobilitySolver*>(ctx);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(solver);
+#endif
+    solver->resetMobilityPreconditioner();
+
+    // Gather the velocities on the root processor, apply the approximate
+    // inverse of beta*gamma*M there, and scatter the forces back.
+    static const int managing_rank = 0;
+    const std::vector<unsigned>& struct_ids = solver->d_mob_pc_struct_ids;
+    std::vector<double> array;
+    if (SAMRAI_MPI::getRank() == managing_rank) array.resize(NDIM * solver->d_mob_pc_op->getNumberOfNodes());
+    solver->d_cib_strategy->copyVecToArray(x, array.data(), struct_ids, NDIM, managing_rank);
+    if (SAMRAI_MPI::getRank() == managing_rank)
+    {
+        solver->d_mob_pc_op->applyPreconditioner(array.data(), array.data());
+        const double scale = 1.0 / (solver->d_scale_interp * solver->d_scale_spread);
+        for (auto& a : array) a *= scale;
+    }
+    solver->d_cib_strategy->copyArrayToVec(y, array.data(), struct_ids, NDIM, managing_rank);
+
     PetscFunctionReturn(0);
 } // PCApply_KMInv
 
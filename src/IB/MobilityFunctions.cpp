@@ -622,70 +622,75 @@ MobilityFunctions::constructRPYMobilityMatrix(const char* IBKernelName,
                                               double* MM)
 {
     HRad = getHydroRadius(IBKernelName) * DX;
-    const double mu_tt = 1. / (6.0 * M_PI * MU * HRad);
 
-    double r_vec[NDIM];
+    double r_vec[NDIM], block[NDIM * NDIM];
     int size = N * NDIM;
     int row, col;
     for (row = 0; row < N; row++)
         for (col = 0; col <= row; col++)
         {
-            if (row == col)
+            int cdir;
+            for (cdir = 0; cdir < NDIM; cdir++)
             {
-                int idir, jdir;
-                for (idir = 0; idir < NDIM; idir++)
-                    for (jdir = 0; jdir < NDIM; jdir++)
-                    {
-                        const int index = (col * NDIM + jdir) * size + row * NDIM + idir; // column-major for LAPACK
-                        MM[index] = (mu_tt - PERIODIC_CORRECTION) * KRON(idir, jdir);
-                    }
+                r_vec[cdir] = X[row * NDIM + cdir] - X[col * NDIM + cdir]; // r(i) - r(j)
             }
-            else
-            {
-                int cdir;
-                for (cdir = 0; cdir < NDIM; cdir++)
+            getRPYMobilityBlock(r_vec, HRad, MU, PERIODIC_CORRECTION, block);
+
+            int idir, jdir;
+            for (idir = 0; idir < NDIM; idir++)
+                for (jdir = 0; jdir < NDIM; jdir++)
                 {
-                    r_vec[cdir] = X[row * NDIM + cdir] - X[col * NDIM + cdir]; // r(i) - r(j)
+                    // column-major for LAPACK
+                    MM[(col * NDIM + jdir) * size + row * NDIM + idir] = block[idir * NDIM + jdir];
+                    MM[(row * NDIM + idir) * size + col * NDIM + jdir] = block[idir * NDIM + jdir];
                 }
-
-                const double rsq = get_sqnorm(r_vec);
-                const double r = std::sqrt(rsq);
-                int idir, jdir;
-                for (idir = 0; idir < NDIM; idir++)
-                    for (jdir = 0; jdir <= idir; jdir++)
-                    {
-                        const int index = (col * NDIM + jdir) * size + row * NDIM + idir; // column-major for LAPACK
-                        if (r <= 2.0 * HRad)
-                        {
-                            MM[index] = (mu_tt * (1 - 9.0 / 32.0 * r / HRad) - PERIODIC_CORRECTION) * KRON(idir, jdir) +
-                                        mu_tt * r_vec[idir] * r_vec[jdir] / rsq * 3.0 * r / 32. / HRad;
-                            MM[(row * NDIM + idir) * size + col * NDIM + jdir] = MM[index];
-                            if (idir != jdir)
-                            {
-                                MM[(col * NDIM + idir) * size + row * NDIM + jdir] = MM[index];
-                                MM[(row * NDIM + jdir) * size + col * NDIM + idir] = MM[index];
-                            }
-                        }
-                        else
-                        {
-                            double cube = HRad * HRad * HRad / r / r / r;
-                            MM[index] =
-                                (mu_tt * (3.0 / 4.0 * HRad / r + 1.0 / 2.0 * cube) - PERIODIC_CORRECTION) *
-                                    KRON(idir, jdir) +
-                                mu_tt * r_vec[idir] * r_vec[jdir] / rsq * (3.0 / 4.0 * HRad / r - 3.0 / 2.0 * cube);
-                            MM[(row * NDIM + idir) * size + col * NDIM + jdir] = MM[index];
-                            if (idir != jdir)
-                            {
-                                MM[(col * NDIM + idir) * size + row * NDIM + jdir] = MM[index];
-                                MM[(row * NDIM + jdir) * size + col * NDIM + idir] = MM[index];
-                            }
-                        }
-                    } // jdir
-            }
         } // column loop
     return;
 } // constructRPYMobilityMatrix
 
+double
+MobilityFunctions::getHydrodynamicRadius(const char* IBKernelName, const double DX)
+{
+    return getHydroRadius(IBKernelName) * DX;
+} // getHydrodynamicRadius
+
+void
+MobilityFunctions::getRPYMobilityBlock(const double* r_vec,
+                                       const double hydro_radius,
+                                       const double MU,
+                                       const double PERIODIC_CORRECTION,
+                                       double* block)
+{
+    const double mu_tt = 1. / (6.0 * M_PI * MU * hydro_radius);
+    const double rsq = get_sqnorm(r_vec);
+    const double r = std::sqrt(rsq);
+
+    int idir, jdir;
+    for (idir = 0; idir < NDIM; idir++)
+        for (jdir = 0; jdir < NDIM; jdir++)
+        {
+            double& entry = block[idir * NDIM + jdir];
+            if (rsq == 0.0)
+            {
+                // self mobility
+                entry = (mu_tt - PERIODIC_CORRECTION) * KRON(idir, jdir);
+            }
+            else if (r <= 2.0 * hydro_radius)
+            {
+                entry = (mu_tt * (1 - 9.0 / 32.0 * r / hydro_radius) - PERIODIC_CORRECTION) * KRON(idir, jdir) +
+                        mu_tt * r_vec[idir] * r_vec[jdir] / rsq * 3.0 * r / 32. / hydro_radius;
+            }
+            else
+            {
+                double cube = hydro_radius * hydro_radius * hydro_radius / r / r / r;
+                entry = (mu_tt * (3.0 / 4.0 * hydro_radius / r + 1.0 / 2.0 * cube) - PERIODIC_CORRECTION) *
+                            KRON(idir, jdir) +
+                        mu_tt * r_vec[idir] * r_vec[jdir] / rsq * (3.0 / 4.0 * hydro_radius / r - 3.0 / 2.0 * cube);
+            }
+        }
+    return;
+} // getRPYMobilityBlock
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBAMR
@@ -26,6 +26,7 @@
 #include "ibtk/HierarchyMathOps.h"
 #include "ibtk/LaplaceOperator.h"
 #include "ibtk/PoissonSolver.h"
+#include "ibtk/TelemetryLog.h"
 
 #include "BaseGriddingAlgorithm.h"
 #include "BasePatchHierarchy.h"
@@ -575,7 +576,15 @@ AdvDiffPredictorCorrectorHierarchyIntegrator::integrateHierarchy(const double cu
         }
 
         // Solve for Q(n+1).
+        TelemetryLog* const telemetry = getTelemetryLog();
+        if (telemetry) telemetry->startPhase("helmholtz_solve::" + Q_var->getName());
         helmholtz_solver->solveSystem(*d_sol_vecs[l], *d_rhs_vecs[l]);
+        if (telemetry)
+        {
+            telemetry->stopPhase("helmholtz_solve::" + Q_var->getName());
+            telemetry->addValue("helmholtz_solver_iterations::" + Q_var->getName(),
+                                helmholtz_solver->getNumIterations());
+        }
         d_hier_cc_data_ops->copyData(Q_new_idx, Q_scratch_idx);
         if (d_enable_logging && d_enable_logging_solver_iterations)
             plog << d_object_name << "::integrateHierarchy(): linear solve number of iterations = "
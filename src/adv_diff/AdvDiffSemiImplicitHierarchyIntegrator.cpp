@@ -24,6 +24,7 @@
 #include "ibtk/CartGridFunction.h"
 #include "ibtk/LaplaceOperator.h"
 #include "ibtk/PoissonSolver.h"
+#include "ibtk/TelemetryLog.h"
 
 #include "BasePatchHierarchy.h"
 #include "CartesianGridGeometry.h"
@@ -423,6 +424,22 @@ AdvDiffSemiImplicitHierarchyIntegrator::initializeHierarchyIntegrator(Pointer<Pa
                          "CONSERVATIVE_LINEAR_REFINE");
     }
 
+    // Keep track of the Helmholtz solvers and RHS operators provided by the
+    // user before the default ones are allocated: these are never shared.
+    d_has_user_helmholtz_solver.resize(d_Q_var.size());
+    for (unsigned int l = 0; l < d_Q_var.size(); ++l)
+    {
+        d_has_user_helmholtz_solver[l] = (l < d_helmholtz_solvers.size() && d_helmholtz_solvers[l]) ||
+                                         (l < d_helmholtz_rhs_ops.size() && d_helmholtz_rhs_ops[l]);
+        if (d_share_helmholtz_solvers && d_has_user_helmholtz_solver[l])
+        {
+            TBOX_WARNING(d_object_name << "::initializeHierarchyIntegrator():\n"
+                                       << "  a Helmholtz solver or RHS operator was provided for variable "
+                                       << d_Q_var[l]->getName() << ".\n"
+                                       << "  this variable will not share its Helmholtz solver.\n");
+        }
+    }
+
     // Perform hierarchy initialization operations common to all implementations
     // of AdvDiffHierarchyIntegrator.
     AdvDiffHierarchyIntegrator::initializeHierarchyIntegrator(hierarchy, gridding_alg);
@@ -513,12 +530,33 @@ AdvDiffSemiImplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const doubl
     }
 
     // Setup the operators and solvers and compute the right-hand-side terms.
+    d_helmholtz_solver_idx.resize(d_Q_var.size());
     unsigned int l = 0;
     for (auto cit = d_Q_var.begin(); cit != d_Q_var.end(); ++cit, ++l)
     {
         Pointer<CellVariable<NDIM, double> > Q_var = *cit;
         Pointer<CellVariable<NDIM, double> > Q_rhs_var = d_Q_Q_rhs_map[Q_var];
         Pointer<SideVariable<NDIM, double> > D_var = d_Q_diffusion_coef_variable[Q_var];
+
+        // When requested, reuse the Helmholtz solver and RHS operator of a
+        // previously processed quantity that is discretized in the same way.
+        // In this case, the (possibly expensive) solver initialization is only
+        // performed once for the entire group of quantities. Solvers and
+        // operators provided by the user are never shared.
+        unsigned int k = l;
+        if (d_share_helmholtz_solvers && !d_has_user_helmholtz_solver[l])
+        {
+            for (unsigned int m = 0; m < l; ++m)
+            {
+                if (d_helmholtz_solver_idx[m] == m && !d_has_user_helmholtz_solver[m] &&
+                    haveSameHelmholtzSystem(Q_var, d_Q_var[m]))
+                {
+                    k = m;
+                    break;
+                }
+            }
+        }
+        d_helmholtz_solver_idx[l] = k;
         Pointer<SideVariable<NDIM, double> > D_rhs_var = d_diffusion_coef_rhs_map[D_var];
         TimeSteppingType diffusion_time_stepping_type = d_Q_diffusion_time_stepping_type[Q_var];
         const double lambda = d_Q_damping_coef[Q_var];
@@ -574,13 +612,13 @@ AdvDiffSemiImplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const doubl
         }
 
         // Initialize the RHS operator and compute the RHS vector.
-        Pointer<LaplaceOperator> helmholtz_rhs_op = d_helmholtz_rhs_ops[l];
+        Pointer<LaplaceOperator> helmholtz_rhs_op = d_helmholtz_rhs_ops[k];
         helmholtz_rhs_op->setPoissonSpecifications(rhs_op_spec);
         helmholtz_rhs_op->setPhysicalBcCoefs(Q_bc_coef);
         helmholtz_rhs_op->setHomogeneousBc(false);
         helmholtz_rhs_op->setSolutionTime(current_time);
         helmholtz_rhs_op->setTimeInterval(current_time, new_time);
-        if (d_helmholtz_rhs_ops_need_init[l])
+        if (d_helmholtz_rhs_ops_need_init[k])
         {
             if (d_enable_logging)
             {
@@ -588,19 +626,19 @@ AdvDiffSemiImplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const doubl
                      << "Initializing Helmholtz RHS operator for variable number " << l << "\n";
             }
             helmholtz_rhs_op->initializeOperatorState(*d_sol_vecs[l], *d_rhs_vecs[l]);
-            d_helmholtz_rhs_ops_need_init[l] = false;
+            d_helmholtz_rhs_ops_need_init[k] = false;
         }
         d_hier_cc_data_ops->copyData(Q_scratch_idx, Q_current_idx, false);
         helmholtz_rhs_op->apply(*d_sol_vecs[l], *d_rhs_vecs[l]);
 
         // Initialize the linear solver.
-        Pointer<PoissonSolver> helmholtz_solver = d_helmholtz_solvers[l];
+        Pointer<PoissonSolver> helmholtz_solver = d_helmholtz_solvers[k];
         helmholtz_solver->setPoissonSpecifications(solver_spec);
         helmholtz_solver->setPhysicalBcCoefs(Q_bc_coef);
         helmholtz_solver->setHomogeneousBc(false);
         helmholtz_solver->setSolutionTime(new_time);
         helmholtz_solver->setTimeInterval(current_time, new_time);
-        if (d_helmholtz_solvers_need_init[l])
+        if (d_helmholtz_solvers_need_init[k])
         {
             if (d_enable_logging)
             {
@@ -608,7 +646,12 @@ AdvDiffSemiImplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const doubl
                      << "Initializing Helmholtz solvers for variable number " << l << "\n";
             }
             helmholtz_solver->initializeSolverState(*d_sol_vecs[l], *d_rhs_vecs[l]);
-            d_helmholtz_solvers_need_init[l] = false;
+            d_helmholtz_solvers_need_init[k] = false;
+        }
+        else if (d_enable_logging && k != l)
+        {
+            plog << d_object_name << ": "
+                 << "Using Helmholtz solvers of variable number " << k << " for variable number " << l << "\n";
         }
 
         // Account for the convective difference term.
@@ -636,6 +679,7 @@ AdvDiffSemiImplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const doubl
                 d_Q_convective_op[Q_var]->initializeOperatorState(*d_sol_vecs[l], *d_rhs_vecs[l]);
                 d_Q_convective_op_needs_init[Q_var] = false;
             }
+            d_Q_convective_op[Q_var]->setTimeInterval(current_time, new_time);
             const int u_current_idx = var_db->mapVariableAndContextToIndex(u_var, getCurrentContext());
             d_Q_convective_op[Q_var]->setAdvectionVelocity(u_current_idx);
             const int Q_current_idx = var_db->mapVariableAndContextToIndex(Q_var, getCurrentContext());
@@ -686,6 +730,23 @@ AdvDiffSemiImplicitHierarchyIntegrator::integrateHierarchy(const double current_
         });
     }
 
+    // Update the advection velocities.  This is done once for all transported
+    // quantities, since several quantities may share the same velocity.
+    if (cycle_num > 0)
+    {
+        for (const auto& u_var : d_u_var)
+        {
+            const int u_current_idx = var_db->mapVariableAndContextToIndex(u_var, getCurrentContext());
+            const int u_scratch_idx = var_db->mapVariableAndContextToIndex(u_var, getScratchContext());
+            const int u_new_idx = var_db->mapVariableAndContextToIndex(u_var, getNewContext());
+            if (d_u_fcn[u_var])
+            {
+                d_u_fcn[u_var]->setDataOnPatchHierarchy(u_new_idx, u_var, d_hierarchy, new_time);
+            }
+            d_hier_fc_data_ops->linearSum(u_scratch_idx, 0.5, u_current_idx, 0.5, u_new_idx);
+        }
+    }
+
     // Perform a single step of fixed point iteration.
     unsigned int l = 0;
     for (auto cit = d_Q_var.begin(); cit != d_Q_var.end(); ++cit, ++l)
@@ -701,22 +762,6 @@ AdvDiffSemiImplicitHierarchyIntegrator::integrateHierarchy(const double current_
         const int F_new_idx = d_F_fcn[F_var] ? var_db->mapVariableAndContextToIndex(F_var, getNewContext()) : -1;
         const int Q_rhs_scratch_idx = var_db->mapVariableAndContextToIndex(Q_rhs_var, getScratchContext());
 
-        // Update the advection velocity.
-        if (cycle_num > 0)
-        {
-            for (const auto& u_var : d_u_var)
-            {
-                const int u_current_idx = var_db->mapVariableAndContextToIndex(u_var, getCurrentContext());
-                const int u_scratch_idx = var_db->mapVariableAndContextToIndex(u_var, getScratchContext());
-                const int u_new_idx = var_db->mapVariableAndContextToIndex(u_var, getNewContext());
-                if (d_u_fcn[u_var])
-                {
-                    d_u_fcn[u_var]->setDataOnPatchHierarchy(u_new_idx, u_var, d_hierarchy, new_time);
-                }
-                d_hier_fc_data_ops->linearSum(u_scratch_idx, 0.5, u_current_idx, 0.5, u_new_idx);
-            }
-        }
-
         // Account for the convective difference term.
         Pointer<FaceVariable<NDIM, double> > u_var = d_Q_u_map[Q_var];
         Pointer<CellVariable<NDIM, double> > N_var = d_Q_N_map[Q_var];
@@ -807,8 +852,16 @@ AdvDiffSemiImplicitHierarchyIntegrator::integrateHierarchy(const double current_
         if (isDiffusionCoefficientVariable(Q_var) || (d_Q_diffusion_coef[Q_var] != 0.0))
         {
             // Solve for Q(n+1).
-            Pointer<PoissonSolver> helmholtz_solver = d_helmholtz_solvers[l];
+            Pointer<PoissonSolver> helmholtz_solver = d_helmholtz_solvers[d_helmholtz_solver_idx[l]];
+            TelemetryLog* const telemetry = getTelemetryLog();
+            if (telemetry) telemetry->startPhase("helmholtz_solve::" + Q_var->getName());
             helmholtz_solver->solveSystem(*d_sol_vecs[l], *d_rhs_vecs[l]);
+            if (telemetry)
+            {
+                telemetry->stopPhase("helmholtz_solve::" + Q_var->getName());
+                telemetry->addValue("helmholtz_solver_iterations::" + Q_var->getName(),
+                                    helmholtz_solver->getNumIterations());
+            }
             d_hier_cc_data_ops->copyData(Q_new_idx, Q_scratch_idx);
             if (d_enable_logging && d_enable_logging_solver_iterations)
                 plog << d_object_name << "::integrateHierarchy(): diffusion solve number of iterations = "
@@ -935,6 +988,23 @@ AdvDiffSemiImplicitHierarchyIntegrator::putToDatabaseSpecialized(Pointer<Databas
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+bool
+AdvDiffSemiImplicitHierarchyIntegrator::haveSameHelmholtzSystem(Pointer<CellVariable<NDIM, double> > Q1_var,
+                                                                Pointer<CellVariable<NDIM, double> > Q2_var) const
+{
+    Pointer<CellDataFactory<NDIM, double> > Q1_factory = Q1_var->getPatchDataFactory();
+    Pointer<CellDataFactory<NDIM, double> > Q2_factory = Q2_var->getPatchDataFactory();
+    if (Q1_factory->getDefaultDepth() != Q2_factory->getDefaultDepth()) return false;
+    if (d_Q_diffusion_time_stepping_type.find(Q1_var)->second !=
+        d_Q_diffusion_time_stepping_type.find(Q2_var)->second)
+        return false;
+    if (d_Q_diffusion_coef_variable.find(Q1_var)->second != d_Q_diffusion_coef_variable.find(Q2_var)->second)
+        return false;
+    if (d_Q_diffusion_coef.find(Q1_var)->second != d_Q_diffusion_coef.find(Q2_var)->second) return false;
+    if (d_Q_damping_coef.find(Q1_var)->second != d_Q_damping_coef.find(Q2_var)->second) return false;
+    return d_Q_bc_coef.find(Q1_var)->second == d_Q_bc_coef.find(Q2_var)->second;
+} // haveSameHelmholtzSystem
+
 void
 AdvDiffSemiImplicitHierarchyIntegrator::getFromInput(Pointer<Database> db, bool is_from_restart)
 {
@@ -983,6 +1053,8 @@ AdvDiffSemiImplicitHierarchyIntegrator::getFromInput(Pointer<Database> db, bool
         else if (db->keyExists("default_convective_op_db"))
             d_default_convective_op_input_db = db->getDatabase("default_convective_op_db");
     }
+    if (db->keyExists("share_helmholtz_solvers"))
+        d_share_helmholtz_solvers = db->getBool("share_helmholtz_solvers");
     return;
 } // getFromInput
 
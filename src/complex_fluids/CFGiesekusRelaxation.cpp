@@ -25,63 +25,36 @@ CFGiesekusRelaxation::CFGiesekusRelaxation(const std::string& object_name, Point
     return;
 } // Constructor
 
-void
-CFGiesekusRelaxation::setDataOnPatch(const int data_idx,
-                                     Pointer<Variable<NDIM> > /*var*/,
-                                     Pointer<Patch<NDIM> > patch,
-                                     const double /*data_time*/,
-                                     const bool initial_time,
-                                     Pointer<PatchLevel<NDIM> > /*patch_level*/)
+MatrixNd
+CFGiesekusRelaxation::computeRelaxation(const MatrixNd& mat)
 {
-    const Box<NDIM>& patch_box = patch->getBox();
-    Pointer<CellData<NDIM, double> > ret_data = patch->getPatchData(data_idx);
-    Pointer<CellData<NDIM, double> > in_data = patch->getPatchData(d_W_cc_idx);
-    ret_data->fillAll(0.0);
-    if (initial_time) return;
     const double l_inv = 1.0 / d_lambda;
-    for (CellIterator<NDIM> i(patch_box); i; i++)
-    {
-        const CellIndex<NDIM>& idx = i();
-        MatrixNd mat;
+    MatrixNd relax;
 #if (NDIM == 2)
-        mat(0, 0) = (*in_data)(idx, 0);
-        mat(1, 1) = (*in_data)(idx, 1);
-        mat(0, 1) = mat(1, 0) = (*in_data)(idx, 2);
+    double Qxx = mat(0, 0);
+    double Qyy = mat(1, 1);
+    double Qxy = mat(0, 1);
+    relax(0, 0) =
+        l_inv * (-1.0 * (d_alpha * (Qxx * Qxx + Qxy * Qxy) + (1.0 - 2.0 * d_alpha) * Qxx + (d_alpha - 1.0)));
+    relax(1, 1) =
+        l_inv * (-1.0 * (d_alpha * (Qyy * Qyy + Qxy * Qxy) + (1.0 - 2.0 * d_alpha) * Qyy + (d_alpha - 1.0)));
+    relax(0, 1) = relax(1, 0) = l_inv * (-1.0 * (d_alpha * (Qxx * Qxy + Qxy * Qyy) + (1.0 - 2.0 * d_alpha) * Qxy));
 #endif
 #if (NDIM == 3)
-        mat(0, 0) = (*in_data)(idx, 0);
-        mat(1, 1) = (*in_data)(idx, 1);
-        mat(2, 2) = (*in_data)(idx, 2);
-        mat(1, 2) = mat(2, 1) = (*in_data)(idx, 3);
-        mat(0, 2) = mat(2, 0) = (*in_data)(idx, 4);
-        mat(0, 1) = mat(1, 0) = (*in_data)(idx, 5);
+    double Qxx = mat(0, 0);
+    double Qyy = mat(1, 1);
+    double Qzz = mat(2, 2);
+    double Qxy = mat(0, 1);
+    double Qxz = mat(0, 2);
+    double Qyz = mat(1, 2);
+    relax(0, 0) = l_inv * (1.0 - Qxx - d_alpha * ((-1.0 + Qxx) * (-1.0 + Qxx) + Qxy * Qxy + Qxz * Qxz));
+    relax(1, 1) = l_inv * (1.0 - Qyy - d_alpha * ((-1.0 + Qyy) * (-1.0 + Qyy) + Qxy * Qxy + Qyz * Qyz));
+    relax(2, 2) = l_inv * (1.0 - Qzz - d_alpha * ((-1.0 + Qzz) * (-1.0 + Qzz) + Qxz * Qxz + Qyz * Qyz));
+    relax(1, 2) = relax(2, 1) = l_inv * (-Qyz - d_alpha * (Qxy * Qxz + (-1.0 + Qyy) * Qyz + Qyz * (-1.0 + Qzz)));
+    relax(0, 2) = relax(2, 0) = l_inv * (-Qxz - d_alpha * ((-1.0 + Qxx) * Qxz + Qxz * Qyz + Qxz * (-1.0 + Qzz)));
+    relax(0, 1) = relax(1, 0) = l_inv * (-Qxy - d_alpha * ((-1.0 + Qxx) * Qxy + Qxy * (-1.0 + Qyy) + Qxz * Qyz));
 #endif
-        mat = convertToConformation(mat);
-#if (NDIM == 2)
-        double Qxx = mat(0, 0);
-        double Qyy = mat(1, 1);
-        double Qxy = mat(0, 1);
-        (*ret_data)(idx, 0) =
-            l_inv * (-1.0 * (d_alpha * (Qxx * Qxx + Qxy * Qxy) + (1.0 - 2.0 * d_alpha) * Qxx + (d_alpha - 1.0)));
-        (*ret_data)(idx, 1) =
-            l_inv * (-1.0 * (d_alpha * (Qyy * Qyy + Qxy * Qxy) + (1.0 - 2.0 * d_alpha) * Qyy + (d_alpha - 1.0)));
-        (*ret_data)(idx, 2) = l_inv * (-1.0 * (d_alpha * (Qxx * Qxy + Qxy * Qyy) + (1.0 - 2.0 * d_alpha) * Qxy));
-#endif
-#if (NDIM == 3)
-        double Qxx = mat(0, 0);
-        double Qyy = mat(1, 1);
-        double Qzz = mat(2, 2);
-        double Qxy = mat(0, 1);
-        double Qxz = mat(0, 2);
-        double Qyz = mat(1, 2);
-        (*ret_data)(idx, 0) = l_inv * (1.0 - Qxx - d_alpha * ((-1.0 + Qxx) * (-1.0 + Qxx) + Qxy * Qxy + Qxz * Qxz));
-        (*ret_data)(idx, 1) = l_inv * (1.0 - Qyy - d_alpha * ((-1.0 + Qyy) * (-1.0 + Qyy) + Qxy * Qxy + Qyz * Qyz));
-        (*ret_data)(idx, 2) = l_inv * (1.0 - Qzz - d_alpha * ((-1.0 + Qzz) * (-1.0 + Qzz) + Qxz * Qxz + Qyz * Qyz));
-        (*ret_data)(idx, 3) = l_inv * (-Qyz - d_alpha * (Qxy * Qxz + (-1.0 + Qyy) * Qyz + Qyz * (-1.0 + Qzz)));
-        (*ret_data)(idx, 4) = l_inv * (-Qxz - d_alpha * ((-1.0 + Qxx) * Qxz + Qxz * Qyz + Qxz * (-1.0 + Qzz)));
-        (*ret_data)(idx, 5) = l_inv * (-Qxy - d_alpha * ((-1.0 + Qxx) * Qxy + Qxy * (-1.0 + Qyy) + Qxz * Qyz));
-#endif
-    }
-} // setDataOnPatch
+    return relax;
+} // computeRelaxation
 
 } // namespace IBAMR
@@ -12,6 +12,9 @@
 // ---------------------------------------------------------------------
 
 #include "ibamr/CFOldroydBRelaxation.h"
+
+#include <cmath>
+
 #include "ibamr/namespaces.h"
 
 // Namespace
@@ -24,52 +27,32 @@ CFOldroydBRelaxation::CFOldroydBRelaxation(const std::string& object_name, Point
     return;
 } // Constructor
 
-void
-CFOldroydBRelaxation::setDataOnPatch(const int data_idx,
-                                     Pointer<Variable<NDIM> > /*var*/,
-                                     Pointer<Patch<NDIM> > patch,
-                                     const double /*data_time*/,
-                                     const bool initial_time,
-                                     Pointer<PatchLevel<NDIM> > /*patch_level*/)
+MatrixNd
+CFOldroydBRelaxation::computeRelaxation(const MatrixNd& mat)
 {
-    const Box<NDIM>& patch_box = patch->getBox();
-    Pointer<CellData<NDIM, double> > ret_data = patch->getPatchData(data_idx);
-    Pointer<CellData<NDIM, double> > in_data = patch->getPatchData(d_W_cc_idx);
-    ret_data->fillAll(0.0);
-    if (initial_time) return;
     const double l_inv = 1.0 / d_lambda;
-    for (CellIterator<NDIM> i(patch_box); i; i++)
-    {
-        const CellIndex<NDIM>& idx = i();
-        MatrixNd mat;
-#if (NDIM == 2)
-        mat(0, 0) = (*in_data)(idx, 0);
-        mat(1, 1) = (*in_data)(idx, 1);
-        mat(0, 1) = mat(1, 0) = (*in_data)(idx, 2);
-#endif
-#if (NDIM == 3)
-        mat(0, 0) = (*in_data)(idx, 0);
-        mat(1, 1) = (*in_data)(idx, 1);
-        mat(2, 2) = (*in_data)(idx, 2);
-        mat(1, 2) = mat(2, 1) = (*in_data)(idx, 3);
-        mat(0, 2) = mat(2, 0) = (*in_data)(idx, 4);
-        mat(0, 1) = mat(1, 0) = (*in_data)(idx, 5);
-#endif
-        mat = convertToConformation(mat);
+    MatrixNd relax;
 #if (NDIM == 2)
-        (*ret_data)(idx, 0) = l_inv * (1.0 - mat(0, 0));
-        (*ret_data)(idx, 1) = l_inv * (1.0 - mat(1, 1));
-        (*ret_data)(idx, 2) = l_inv * (-mat(1, 0));
+    relax(0, 0) = l_inv * (1.0 - mat(0, 0));
+    relax(1, 1) = l_inv * (1.0 - mat(1, 1));
+    relax(0, 1) = relax(1, 0) = l_inv * (-mat(1, 0));
 #endif
 #if (NDIM == 3)
-        (*ret_data)(idx, 0) = l_inv * (1.0 - mat(0, 0));
-        (*ret_data)(idx, 1) = l_inv * (1.0 - mat(1, 1));
-        (*ret_data)(idx, 2) = l_inv * (1.0 - mat(2, 2));
-        (*ret_data)(idx, 3) = l_inv * (-mat(1, 2));
-        (*ret_data)(idx, 4) = l_inv * (-mat(0, 2));
-        (*ret_data)(idx, 5) = l_inv * (-mat(0, 1));
+    relax(0, 0) = l_inv * (1.0 - mat(0, 0));
+    relax(1, 1) = l_inv * (1.0 - mat(1, 1));
+    relax(2, 2) = l_inv * (1.0 - mat(2, 2));
+    relax(1, 2) = relax(2, 1) = l_inv * (-mat(1, 2));
+    relax(0, 2) = relax(2, 0) = l_inv * (-mat(0, 2));
+    relax(0, 1) = relax(1, 0) = l_inv * (-mat(0, 1));
 #endif
-    }
-} // setDataOnPatch
+    return relax;
+} // computeRelaxation
+
+MatrixNd
+CFOldroydBRelaxation::relaxTensor(const MatrixNd& conform, const double dt)
+{
+    // The Oldroyd-B relaxation is linear, so we integrate it exactly.
+    return MatrixNd::Identity() + std::exp(-dt / d_lambda) * (conform - MatrixNd::Identity());
+} // relaxTensor
 
 } // namespace IBAMR
@@ -12,11 +12,76 @@
 // ---------------------------------------------------------------------
 
 #include "ibamr/CFRelaxationOperator.h"
+#include "ibamr/CFTensorUtilities.h"
+
+#include "ibtk/ibtk_macros.h"
+
+#include "CellData.h"
+#include "CellIterator.h"
+
+IBTK_DISABLE_EXTRA_WARNINGS
+#include <Eigen/LU>
+IBTK_ENABLE_EXTRA_WARNINGS
+
+#include <algorithm>
+#include <cmath>
+
 #include "ibamr/namespaces.h"
 
 // Namespace
 namespace IBAMR
 {
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Number of independent components of a symmetric tensor.
+static const int NUM_TENSOR_COMPS = NDIM * (NDIM + 1) / 2;
+using TensorVector = Eigen::Matrix<double, NUM_TENSOR_COMPS, 1>;
+using TensorJacobian = Eigen::Matrix<double, NUM_TENSOR_COMPS, NUM_TENSOR_COMPS>;
+
+// Newton iteration parameters used by the default implementation of relaxTensor().
+static const int MAX_NEWTON_ITS = 20;
+static const double NEWTON_TOL = 1.0e-12;
+
+// Convert between a symmetric tensor and the vector of its independent components, using the same ordering as the
+// cell-centered data.
+inline TensorVector
+tensor_to_vector(const MatrixNd& mat)
+{
+    TensorVector vec;
+#if (NDIM == 2)
+    vec << mat(0, 0), mat(1, 1), mat(0, 1);
+#endif
+#if (NDIM == 3)
+    vec << mat(0, 0), mat(1, 1), mat(2, 2), mat(1, 2), mat(0, 2), mat(0, 1);
+#endif
+    return vec;
+} // tensor_to_vector
+
+inline MatrixNd
+vector_to_tensor(const TensorVector& vec)
+{
+    MatrixNd mat;
+#if (NDIM == 2)
+    mat(0, 0) = vec(0);
+    mat(1, 1) = vec(1);
+    mat(0, 1) = mat(1, 0) = vec(2);
+#endif
+#if (NDIM == 3)
+    mat(0, 0) = vec(0);
+    mat(1, 1) = vec(1);
+    mat(2, 2) = vec(2);
+    mat(1, 2) = mat(2, 1) = vec(3);
+    mat(0, 2) = mat(2, 0) = vec(4);
+    mat(0, 1) = mat(1, 0) = vec(5);
+#endif
+    return mat;
+} // vector_to_tensor
+} // namespace
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
 CFRelaxationOperator::CFRelaxationOperator(const std::string& object_name, Pointer<Database> input_db)
     : CartGridFunction(object_name)
 {
@@ -40,6 +105,114 @@ CFRelaxationOperator::isTimeDependent() const
     return true;
 } // isTimeDependent
 
+void
+CFRelaxationOperator::setDataOnPatch(const int data_idx,
+                                     Pointer<Variable<NDIM> > /*var*/,
+                                     Pointer<Patch<NDIM> > patch,
+                                     const double /*data_time*/,
+                                     const bool initial_time,
+                                     Pointer<PatchLevel<NDIM> > /*patch_level*/)
+{
+    setRelaxationOnPatch(data_idx, patch, initial_time, 0.0);
+    return;
+} // setDataOnPatch
+
+void
+CFRelaxationOperator::setStepAveragedDataOnPatchHierarchy(const int data_idx,
+                                                          Pointer<Variable<NDIM> > /*var*/,
+                                                          Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                                          const double /*data_time*/,
+                                                          const double dt,
+                                                          const int coarsest_ln_in,
+                                                          const int finest_ln_in)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(hierarchy);
+#endif
+    if (!(dt > 0.0))
+    {
+        TBOX_ERROR(d_object_name << "::setStepAveragedDataOnPatchHierarchy():\n"
+                                 << "  invalid time step size: " << dt << std::endl);
+    }
+    const int coarsest_ln = (coarsest_ln_in == IBTK::invalid_level_number ? 0 : coarsest_ln_in);
+    const int finest_ln =
+        (finest_ln_in == IBTK::invalid_level_number ? hierarchy->getFinestLevelNumber() : finest_ln_in);
+    d_num_unconverged_relaxation_solves = 0;
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        const unsigned int num_unconverged_coarser_levels = d_num_unconverged_relaxation_solves;
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            setRelaxationOnPatch(data_idx, level->getPatch(p()), false, dt);
+        }
+
+        // Report unconverged solves once per level rather than once per cell.
+        const unsigned int num_unconverged = d_num_unconverged_relaxation_solves - num_unconverged_coarser_levels;
+        if (num_unconverged > 0)
+        {
+            TBOX_WARNING(d_object_name << "::setStepAveragedDataOnPatchHierarchy():\n"
+                                       << "  Newton iteration did not converge in " << MAX_NEWTON_ITS
+                                       << " iterations in " << num_unconverged << " local cells on level " << ln
+                                       << " for time step size " << dt << std::endl);
+        }
+    }
+    return;
+} // setStepAveragedDataOnPatchHierarchy
+
+unsigned int
+CFRelaxationOperator::getNumberOfUnconvergedRelaxationSolves() const
+{
+    return d_num_unconverged_relaxation_solves;
+} // getNumberOfUnconvergedRelaxationSolves
+
+MatrixNd
+CFRelaxationOperator::computeRelaxation(const MatrixNd& conform)
+{
+    TBOX_ERROR(d_object_name << "::computeRelaxation():\n"
+                             << "  not supported by this relaxation operator." << std::endl);
+    return conform;
+} // computeRelaxation
+
+MatrixNd
+CFRelaxationOperator::relaxTensor(const MatrixNd& conform, const double dt)
+{
+    // Solve R(x) = x - x_n - dt*f(x) = 0 for the independent components x of the relaxed tensor.
+    const TensorVector x_n = tensor_to_vector(conform);
+    TensorVector x = x_n;
+    bool converged = false;
+    for (int it = 0; it < MAX_NEWTON_ITS; ++it)
+    {
+        const TensorVector f = tensor_to_vector(computeRelaxation(vector_to_tensor(x)));
+        const TensorVector res = x - x_n - dt * f;
+        TensorJacobian jac;
+        for (int j = 0; j < NUM_TENSOR_COMPS; ++j)
+        {
+            TensorVector x_pert = x;
+            const double h = 1.0e-7 * std::max(1.0, std::abs(x(j)));
+            x_pert(j) += h;
+            const TensorVector f_pert = tensor_to_vector(computeRelaxation(vector_to_tensor(x_pert)));
+            jac.col(j) = -dt * (f_pert - f) / h;
+            jac(j, j) += 1.0;
+        }
+        const TensorVector dx = jac.partialPivLu().solve(-res);
+        x += dx;
+        if (dx.norm() <= NEWTON_TOL * (1.0 + x.norm()))
+        {
+            converged = true;
+            break;
+        }
+    }
+    if (!x.allFinite())
+    {
+        TBOX_ERROR(d_object_name << "::relaxTensor():\n"
+                                 << "  Newton iteration yielded a non-finite tensor for time step size " << dt
+                                 << std::endl);
+    }
+    if (!converged) ++d_num_unconverged_relaxation_solves;
+    return vector_to_tensor(x);
+} // relaxTensor
+
 MatrixNd
 CFRelaxationOperator::convertToConformation(const MatrixNd& mat)
 {
@@ -48,7 +221,7 @@ CFRelaxationOperator::convertToConformation(const MatrixNd& mat)
     case SQUARE_ROOT:
         return mat * mat;
     case LOGARITHM:
-        return mat.exp();
+        return CFTensorUtilities::exponentiate(mat);
     case STANDARD:
         return mat;
     case UNKNOWN_TENSOR_EVOLUTION_TYPE:
@@ -60,6 +233,37 @@ CFRelaxationOperator::convertToConformation(const MatrixNd& mat)
         break;
     }
     return mat;
-}
+} // convertToConformation
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+CFRelaxationOperator::setRelaxationOnPatch(const int data_idx,
+                                           Pointer<Patch<NDIM> > patch,
+                                           const bool initial_time,
+                                           const double dt)
+{
+    const Box<NDIM>& patch_box = patch->getBox();
+    Pointer<CellData<NDIM, double> > ret_data = patch->getPatchData(data_idx);
+    Pointer<CellData<NDIM, double> > in_data = patch->getPatchData(d_W_cc_idx);
+    ret_data->fillAll(0.0);
+    if (initial_time) return;
+    for (CellIterator<NDIM> i(patch_box); i; i++)
+    {
+        const CellIndex<NDIM>& idx = i();
+        const MatrixNd conform = convertToConformation(CFTensorUtilities::getTensor(*in_data, idx));
+        if (dt > 0.0)
+        {
+            CFTensorUtilities::setTensor(*ret_data, idx, (relaxTensor(conform, dt) - conform) / dt);
+        }
+        else
+        {
+            CFTensorUtilities::setTensor(*ret_data, idx, computeRelaxation(conform));
+        }
+    }
+    return;
+} // setRelaxationOnPatch
+
+//////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBAMR
@@ -12,6 +12,10 @@
 // ---------------------------------------------------------------------
 
 #include "ibamr/CFUpperConvectiveOperator.h"
+
+#include <cmath>
+#include <utility>
+
 #include "ibamr/namespaces.h"
 
 extern "C"
@@ -147,6 +151,7 @@ CFUpperConvectiveOperator::CFUpperConvectiveOperator(const std::string& object_n
         d_interp_type = input_db->getStringWithDefault("interp_type", d_interp_type);
         d_evolve_type =
             string_to_enum<TensorEvolutionType>(input_db->getStringWithDefault("evolution_type", "STANDARD"));
+        d_implicit_relaxation = input_db->getBoolWithDefault("implicit_relaxation", d_implicit_relaxation);
     }
     // Register some scratch variables
     auto var_db = VariableDatabase<NDIM>::getDatabase();
@@ -226,7 +231,25 @@ CFUpperConvectiveOperator::applyConvectiveOperator(int Q_idx, int Y_idx)
     d_convec_oper->applyConvectiveOperator(Q_idx, d_Q_convec_idx);
 
     d_s_fcn->setPatchDataIndex(Q_idx);
-    d_s_fcn->setDataOnPatchHierarchy(d_s_idx, d_Q_var, d_hierarchy, d_solution_time, false, d_coarsest_ln, d_finest_ln);
+    if (d_implicit_relaxation)
+    {
+        // Integrate the relaxation over the current time step so that the source remains bounded for stiff models.
+        const std::pair<double, double> time_interval = getTimeInterval();
+        const double dt = time_interval.second - time_interval.first;
+        if (!std::isfinite(dt) || dt <= 0.0)
+        {
+            TBOX_ERROR("CFUpperConvectiveOperator::applyConvectiveOperator():\n"
+                       << "  implicit relaxation requires a valid time interval to be set prior to call to "
+                          "applyConvectiveOperator\n");
+        }
+        d_s_fcn->setStepAveragedDataOnPatchHierarchy(
+            d_s_idx, d_Q_var, d_hierarchy, d_solution_time, dt, d_coarsest_ln, d_finest_ln);
+    }
+    else
+    {
+        d_s_fcn->setDataOnPatchHierarchy(
+            d_s_idx, d_Q_var, d_hierarchy, d_solution_time, false, d_coarsest_ln, d_finest_ln);
+    }
 
     for (int level_num = d_coarsest_ln; level_num <= d_finest_ln; ++level_num)
     {
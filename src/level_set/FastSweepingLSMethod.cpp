@@ -21,18 +21,28 @@
 #include "ibtk/HierarchyGhostCellInterpolation.h"
 #include "ibtk/HierarchyMathOps.h"
 
+#include "BoxList.h"
+#include "CellData.h"
+#include "CellIterator.h"
 #include "CellVariable.h"
 #include "HierarchyCellDataOpsReal.h"
+#include "RefineAlgorithm.h"
+#include "RefineSchedule.h"
 #include "VariableDatabase.h"
 #include "tbox/RestartManager.h"
+#include "tbox/SAMRAI_MPI.h"
+
+#include <cmath>
 
 // FORTRAN ROUTINES
 #if (NDIM == 2)
 #define FAST_SWEEP_1ST_ORDER_FC IBAMR_FC_FUNC(fastsweep1storder2d, FASTSWEEP1STORDER2D)
+#define FAST_SWEEP_2ND_ORDER_FC IBAMR_FC_FUNC(fastsweep2ndorder2d, FASTSWEEP2NDORDER2D)
 #endif
 
 #if (NDIM == 3)
 #define FAST_SWEEP_1ST_ORDER_FC IBAMR_FC_FUNC(fastsweep1storder3d, FASTSWEEP1STORDER3D)
+#define FAST_SWEEP_2ND_ORDER_FC IBAMR_FC_FUNC(fastsweep2ndorder3d, FASTSWEEP2NDORDER3D)
 #endif
 
 extern "C"
@@ -59,6 +69,28 @@ extern "C"
                                  const double* dx,
                                  const int& patch_touches_bdry,
                                  const int* touches_wall_loc_idx);
+
+    void FAST_SWEEP_2ND_ORDER_FC(double* U,
+                                 const int& U_gcw,
+                                 const int& ilower0,
+                                 const int& iupper0,
+                                 const int& ilower1,
+                                 const int& iupper1,
+#if (NDIM == 3)
+                                 const int& ilower2,
+                                 const int& iupper2,
+#endif
+                                 const int& dlower0,
+                                 const int& dupper0,
+                                 const int& dlower1,
+                                 const int& dupper1,
+#if (NDIM == 3)
+                                 const int& dlower2,
+                                 const int& dupper2,
+#endif
+                                 const double* dx,
+                                 const int& patch_touches_bdry,
+                                 const int* touches_wall_loc_idx);
 }
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
@@ -111,6 +143,10 @@ FastSweepingLSMethod::initializeLSData(int D_idx,
     {
         cell_ghosts = 1;
     }
+    else if (d_ls_order == SECOND_ORDER_LS)
+    {
+        cell_ghosts = 2;
+    }
     else
     {
         TBOX_ERROR("FastSweepLSMethod does not support " << enum_to_string(d_ls_order) << std::endl);
@@ -119,10 +155,17 @@ FastSweepingLSMethod::initializeLSData(int D_idx,
         var_db->registerVariableAndContext(D_var, var_db->getContext(d_object_name + "::SCRATCH"), cell_ghosts);
     const int D_iter_idx =
         var_db->registerVariableAndContext(D_var, var_db->getContext(d_object_name + "::ITER"), cell_ghosts);
+    int D_copy_idx = -1;
+    if (d_max_local_its > 0)
+    {
+        D_copy_idx =
+            var_db->registerVariableAndContext(D_var, var_db->getContext(d_object_name + "::COPY"), cell_ghosts);
+    }
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         hierarchy->getPatchLevel(ln)->allocatePatchData(D_scratch_idx, time);
         hierarchy->getPatchLevel(ln)->allocatePatchData(D_iter_idx, time);
+        if (D_copy_idx != -1) hierarchy->getPatchLevel(ln)->allocatePatchData(D_copy_idx, time);
     }
 
     // First, fill cells with some large positive/negative values
@@ -140,17 +183,43 @@ FastSweepingLSMethod::initializeLSData(int D_idx,
     fill_op->initializeOperatorState(D_transaction, hierarchy);
     HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(hierarchy, coarsest_ln, finest_ln);
 
+    // Same-level schedules used to exchange ghost values between neighboring
+    // patches without the coarse-fine interpolation of the full ghost fill.
+    std::vector<Pointer<RefineSchedule<NDIM> > > exchange_scheds;
+    if (d_max_local_its > 0)
+    {
+        RefineAlgorithm<NDIM> exchange_alg;
+        exchange_alg.registerRefine(D_scratch_idx, D_scratch_idx, D_scratch_idx, nullptr);
+        exchange_scheds.resize(finest_ln + 1);
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            exchange_scheds[ln] = exchange_alg.createSchedule(hierarchy->getPatchLevel(ln));
+        }
+    }
+
     // Carry out iterations
     double diff_L2_norm = 1.0e12;
     int outer_iter = 0;
     const int cc_wgt_idx = hier_math_ops->getCellWeightPatchDescriptorIndex();
 
+    // In narrow band mode, only patches that intersect the band about the
+    // interface are swept. The band grows as distance values propagate into
+    // the ghost cells of neighboring patches.
+    d_narrow_band_patches.clear();
+
     while (diff_L2_norm > d_abs_tol && outer_iter < d_max_its)
     {
         hier_cc_data_ops.copyData(D_iter_idx, D_scratch_idx);
         fill_op->fillData(time);
 
+        updateNarrowBandPatches(D_scratch_idx, hierarchy);
         fastSweep(hier_math_ops, D_scratch_idx);
+        int num_exchanges = 0;
+        if (d_max_local_its > 0)
+        {
+            num_exchanges = exchangeAndSweep(hierarchy, D_scratch_idx, D_copy_idx, exchange_scheds, time);
+        }
+        clampToNarrowBand(D_scratch_idx, hierarchy, /*narrow_band_patches_only*/ true);
 
         hier_cc_data_ops.axmy(D_iter_idx, 1.0, D_iter_idx, D_scratch_idx);
         diff_L2_norm = hier_cc_data_ops.L2Norm(D_iter_idx, cc_wgt_idx);
@@ -160,6 +229,11 @@ FastSweepingLSMethod::initializeLSData(int D_idx,
         if (d_enable_logging)
         {
             plog << d_object_name << "::initializeLSData(): After iteration # " << outer_iter << std::endl;
+            if (d_max_local_its > 0)
+            {
+                plog << d_object_name << "::initializeLSData(): Number of patch ghost exchanges = " << num_exchanges
+                     << std::endl;
+            }
             plog << d_object_name << "::initializeLSData(): L2-norm between successive iterations = " << diff_L2_norm
                  << std::endl;
         }
@@ -183,6 +257,10 @@ FastSweepingLSMethod::initializeLSData(int D_idx,
         }
     }
 
+    // Patches outside of the narrow band still hold the values set by the
+    // interface locating functions.
+    clampToNarrowBand(D_scratch_idx, hierarchy, /*narrow_band_patches_only*/ false);
+
     // Copy signed distance into supplied patch data index
     hier_cc_data_ops.copyData(D_idx, D_scratch_idx);
 
@@ -191,9 +269,11 @@ FastSweepingLSMethod::initializeLSData(int D_idx,
     {
         hierarchy->getPatchLevel(ln)->deallocatePatchData(D_scratch_idx);
         hierarchy->getPatchLevel(ln)->deallocatePatchData(D_iter_idx);
+        if (D_copy_idx != -1) hierarchy->getPatchLevel(ln)->deallocatePatchData(D_copy_idx);
     }
     var_db->removePatchDataIndex(D_scratch_idx);
     var_db->removePatchDataIndex(D_iter_idx);
+    if (D_copy_idx != -1) var_db->removePatchDataIndex(D_copy_idx);
 
     // Indicate that the LS has been initialized.
     d_reinitialize_ls = false;
@@ -220,6 +300,7 @@ FastSweepingLSMethod::fastSweep(Pointer<HierarchyMathOps> hier_math_ops, int dis
 
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
+            if (!isNarrowBandPatch(ln, p())) continue;
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
             Pointer<CellData<NDIM, double> > dist_data = patch->getPatchData(dist_idx);
             fastSweep(dist_data, patch, domain_boxes[0]);
@@ -229,6 +310,73 @@ FastSweepingLSMethod::fastSweep(Pointer<HierarchyMathOps> hier_math_ops, int dis
 
 } // fastSweep
 
+int
+FastSweepingLSMethod::exchangeAndSweep(Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                       int dist_idx,
+                                       int dist_copy_idx,
+                                       const std::vector<Pointer<RefineSchedule<NDIM> > >& exchange_scheds,
+                                       double time)
+{
+    const int coarsest_ln = 0;
+    const int finest_ln = hierarchy->getFinestLevelNumber();
+
+    int num_exchanges = 0;
+    while (num_exchanges < d_max_local_its)
+    {
+        // Exchange ghost values between patches on the same level, keeping the
+        // previous values so that we can tell which patches received new data.
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<CellData<NDIM, double> > dist_data = patch->getPatchData(dist_idx);
+                Pointer<CellData<NDIM, double> > dist_copy_data = patch->getPatchData(dist_copy_idx);
+                dist_copy_data->copy(*dist_data);
+            }
+            exchange_scheds[ln]->fillData(time, /*do_physical_boundary_fill*/ false);
+        }
+        ++num_exchanges;
+        updateNarrowBandPatches(dist_idx, hierarchy);
+
+        // Only sweep the patches whose ghost values have changed.
+        int num_swept_patches = 0;
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+            const BoxArray<NDIM>& domain_boxes = level->getPhysicalDomain();
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                if (!isNarrowBandPatch(ln, p())) continue;
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<CellData<NDIM, double> > dist_data = patch->getPatchData(dist_idx);
+                Pointer<CellData<NDIM, double> > dist_copy_data = patch->getPatchData(dist_copy_idx);
+                BoxList<NDIM> ghost_boxes(dist_data->getGhostBox());
+                ghost_boxes.removeIntersections(patch->getBox());
+                bool ghosts_changed = false;
+                for (BoxList<NDIM>::Iterator b(ghost_boxes); b && !ghosts_changed; b++)
+                {
+                    for (CellIterator<NDIM> ic(b()); ic; ic++)
+                    {
+                        if (std::abs((*dist_data)(ic()) - (*dist_copy_data)(ic())) > d_local_exchange_tol)
+                        {
+                            ghosts_changed = true;
+                            break;
+                        }
+                    }
+                }
+                if (!ghosts_changed) continue;
+                fastSweep(dist_data, patch, domain_boxes[0]);
+                ++num_swept_patches;
+            }
+        }
+        num_swept_patches = SAMRAI_MPI::sumReduction(num_swept_patches);
+        if (num_swept_patches == 0) break;
+    }
+    return num_exchanges;
+} // exchangeAndSweep
+
 void
 FastSweepingLSMethod::fastSweep(Pointer<CellData<NDIM, double> > dist_data,
                                 const Pointer<Patch<NDIM> > patch,
@@ -258,6 +406,7 @@ FastSweepingLSMethod::fastSweep(Pointer<CellData<NDIM, double> > dist_data,
 #if !defined(NDEBUG)
     TBOX_ASSERT(dist_data->getDepth() == 1);
     if (d_ls_order == FIRST_ORDER_LS) TBOX_ASSERT(D_ghosts >= 1);
+    if (d_ls_order == SECOND_ORDER_LS) TBOX_ASSERT(D_ghosts >= 2);
 #endif
 
     const Box<NDIM>& patch_box = patch->getBox();
@@ -281,6 +430,30 @@ FastSweepingLSMethod::fastSweep(Pointer<CellData<NDIM, double> > dist_data,
 #if (NDIM == 3)
                                 domain_box.lower(2),
                                 domain_box.upper(2),
+#endif
+                                dx,
+                                patch_touches_bdry,
+                                touches_wall_loc_idx);
+    }
+    else if (d_ls_order == SECOND_ORDER_LS)
+    {
+        FAST_SWEEP_2ND_ORDER_FC(D,
+                                D_ghosts,
+                                patch_box.lower(0),
+                                patch_box.upper(0),
+                                patch_box.lower(1),
+                                patch_box.upper(1),
+#if (NDIM == 3)
+                                patch_box.lower(2),
+                                patch_box.upper(2),
+#endif
+                                domain_box.lower(0),
+                                domain_box.upper(0),
+                                domain_box.lower(1),
+                                domain_box.upper(1),
+#if (NDIM == 3)
+                                domain_box.lower(2),
+                                domain_box.upper(2),
 #endif
                                 dx,
                                 patch_touches_bdry,
@@ -310,6 +483,11 @@ FastSweepingLSMethod::getFromInput(Pointer<Database> input_db)
 
     d_reinit_interval = input_db->getIntegerWithDefault("reinit_interval", d_reinit_interval);
 
+    d_narrow_band_width = input_db->getDoubleWithDefault("narrow_band_width", d_narrow_band_width);
+
+    d_max_local_its = input_db->getIntegerWithDefault("max_local_iterations", d_max_local_its);
+    d_local_exchange_tol = input_db->getDoubleWithDefault("local_exchange_tol", d_local_exchange_tol);
+
     d_consider_phys_bdry_wall = input_db->getBoolWithDefault("physical_bdry_wall", d_consider_phys_bdry_wall);
     Array<int> wall_loc_idices;
     if (input_db->keyExists("physical_bdry_wall_loc_idx"))
@@ -16,8 +16,16 @@
 #include "ibamr/LSInitStrategy.h"
 #include "ibamr/namespaces.h"
 
+#include "CartesianPatchGeometry.h"
+#include "CellData.h"
+#include "CellIterator.h"
+#include "Patch.h"
+#include "PatchHierarchy.h"
+#include "PatchLevel.h"
 #include "tbox/RestartManager.h"
 
+#include <algorithm>
+#include <cmath>
 #include <utility>
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
@@ -26,6 +34,17 @@ namespace IBAMR
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+inline double
+get_narrow_band_distance(const Patch<NDIM>& patch, const double narrow_band_width)
+{
+    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch.getPatchGeometry();
+    const double* const dx = pgeom->getDx();
+    return narrow_band_width * (*std::max_element(dx, dx + NDIM));
+} // get_narrow_band_distance
+} // namespace
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 LSInitStrategy::LSInitStrategy(std::string object_name, bool register_for_restart)
@@ -72,12 +91,87 @@ LSInitStrategy::setReinitializeLSData(bool reinit_ls_data)
     return;
 } // setReinitializeLSData
 
+void
+LSInitStrategy::setNarrowBandWidth(double narrow_band_width)
+{
+    d_narrow_band_width = narrow_band_width;
+    return;
+} // setNarrowBandWidth
+
 void LSInitStrategy::putToDatabase(Pointer<Database> /*db*/)
 {
     // intentionally blank
     return;
 } // putToDatabase
 
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+void
+LSInitStrategy::updateNarrowBandPatches(int D_idx, Pointer<PatchHierarchy<NDIM> > hierarchy)
+{
+    if (d_narrow_band_width <= 0.0) return;
+
+    const int finest_ln = hierarchy->getFinestLevelNumber();
+    d_narrow_band_patches.resize(finest_ln + 1);
+    for (int ln = 0; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        std::vector<bool>& patch_flags = d_narrow_band_patches[ln];
+        patch_flags.resize(level->getNumberOfPatches(), false);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            if (patch_flags[p()]) continue;
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > D_data = patch->getPatchData(D_idx);
+            const double band = get_narrow_band_distance(*patch, d_narrow_band_width);
+            for (CellIterator<NDIM> ic(D_data->getGhostBox()); ic; ic++)
+            {
+                if (std::abs((*D_data)(ic())) < band)
+                {
+                    patch_flags[p()] = true;
+                    break;
+                }
+            }
+        }
+    }
+    return;
+} // updateNarrowBandPatches
+
+bool
+LSInitStrategy::isNarrowBandPatch(int ln, int patch_num) const
+{
+    if (d_narrow_band_width <= 0.0) return true;
+    return ln < static_cast<int>(d_narrow_band_patches.size()) &&
+           patch_num < static_cast<int>(d_narrow_band_patches[ln].size()) && d_narrow_band_patches[ln][patch_num];
+} // isNarrowBandPatch
+
+void
+LSInitStrategy::clampToNarrowBand(int D_idx,
+                                  Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                  bool narrow_band_patches_only) const
+{
+    if (d_narrow_band_width <= 0.0) return;
+
+    const int finest_ln = hierarchy->getFinestLevelNumber();
+    for (int ln = 0; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            if (narrow_band_patches_only && !isNarrowBandPatch(ln, p())) continue;
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > D_data = patch->getPatchData(D_idx);
+            const double band = get_narrow_band_distance(*patch, d_narrow_band_width);
+            for (CellIterator<NDIM> ic(patch->getBox()); ic; ic++)
+            {
+                double& D = (*D_data)(ic());
+                if (std::abs(D) > band) D = std::copysign(band, D);
+            }
+        }
+    }
+    return;
+} // clampToNarrowBand
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBAMR
@@ -359,12 +359,19 @@ RelaxationLSMethod::initializeLSData(int D_idx,
         H_fill_op->fillData(time);
     }
 
+    // In narrow band mode, only patches that intersect the band about the
+    // interface are relaxed. Values outside of the band are held fixed at the
+    // band width so that they do not drift between iterations.
+    d_narrow_band_patches.clear();
+
     while (diff_L2_norm > d_abs_tol && outer_iter < d_max_its)
     {
         // Refill ghost data and relax
         hier_cc_data_ops.copyData(D_iter_idx, D_scratch_idx);
         D_fill_op->fillData(time);
+        updateNarrowBandPatches(D_scratch_idx, hierarchy);
         relax(hier_math_ops, D_scratch_idx, D_init_idx, outer_iter);
+        clampToNarrowBand(D_scratch_idx, hierarchy, /*narrow_band_patches_only*/ true);
         hier_cc_data_ops.linearSum(D_scratch_idx, d_alpha, D_scratch_idx, 1.0 - d_alpha, D_iter_idx);
 
         if (d_apply_volume_shift)
@@ -426,6 +433,10 @@ RelaxationLSMethod::initializeLSData(int D_idx,
         }
     }
 
+    // Patches outside of the narrow band still hold the values set by the
+    // interface locating functions.
+    clampToNarrowBand(D_scratch_idx, hierarchy, /*narrow_band_patches_only*/ false);
+
     // Copy signed distance into supplied patch data index
     hier_cc_data_ops.copyData(D_idx, D_scratch_idx);
 
@@ -516,6 +527,7 @@ RelaxationLSMethod::relax(Pointer<HierarchyMathOps> hier_math_ops,
         Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
+            if (!isNarrowBandPatch(ln, p())) continue;
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
             Pointer<CellData<NDIM, double> > dist_data = patch->getPatchData(dist_idx);
             const Pointer<CellData<NDIM, double> > dist_init_data = patch->getPatchData(dist_init_idx);
@@ -994,6 +1006,8 @@ RelaxationLSMethod::getFromInput(Pointer<Database> input_db)
 
     d_apply_volume_shift = input_db->getBoolWithDefault("apply_volume_shift", d_apply_volume_shift);
 
+    d_narrow_band_width = input_db->getDoubleWithDefault("narrow_band_width", d_narrow_band_width);
+
     return;
 } // getFromInput
 
@@ -488,6 +488,199 @@ c     Algorithm to find dbar
       return
       end
 
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Carry out second-order accurate fast sweeping algorithm
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine fastsweep2ndorder3d(
+     &     U,U_gcw,
+     &     ilower0,iupper0,
+     &     ilower1,iupper1,
+     &     ilower2,iupper2,
+     &     dlower0,dupper0,
+     &     dlower1,dupper1,
+     &     dlower2,dupper2,
+     &     dx,
+     &     patch_touches_bdry,
+     &     touches_wall_loc_idx)
+c
+      implicit none
+include(TOP_SRCDIR/src/fortran/const.i)dnl
+c
+c     Input.
+c
+      INTEGER ilower0,iupper0
+      INTEGER ilower1,iupper1
+      INTEGER ilower2,iupper2
+      INTEGER dlower0,dupper0
+      INTEGER dlower1,dupper1
+      INTEGER dlower2,dupper2
+      INTEGER U_gcw
+      INTEGER patch_touches_bdry
+
+c
+c     Input/Output.
+c
+      REAL U(CELL3d(ilower,iupper,U_gcw))
+      REAL dx(0:NDIM-1)
+      INTEGER touches_wall_loc_idx(0:2*NDIM - 1)
+c
+c     Local variables.
+c
+      INTEGER i0,i1,i2,dir
+      INTEGER start0,end0,stride0
+      INTEGER start1,end1,stride1
+      INTEGER start2,end2,stride2
+
+c     Do the eight sweeping directions.
+      do dir = 0,7
+         if (mod(dir,2) .eq. 0) then
+            start0 = ilower0
+            end0 = iupper0
+            stride0 = 1
+         else
+            start0 = iupper0
+            end0 = ilower0
+            stride0 = -1
+         endif
+         if (mod(dir/2,2) .eq. 0) then
+            start1 = ilower1
+            end1 = iupper1
+            stride1 = 1
+         else
+            start1 = iupper1
+            end1 = ilower1
+            stride1 = -1
+         endif
+         if (mod(dir/4,2) .eq. 0) then
+            start2 = ilower2
+            end2 = iupper2
+            stride2 = 1
+         else
+            start2 = iupper2
+            end2 = ilower2
+            stride2 = -1
+         endif
+         do i2 = start2,end2,stride2
+            do i1 = start1,end1,stride1
+               do i0 = start0,end0,stride0
+                  call evalsweep2ndorder3d(U,U_gcw,
+     &                                     ilower0,iupper0,
+     &                                     ilower1,iupper1,
+     &                                     ilower2,iupper2,
+     &                                     i0,i1,i2,
+     &                                     dlower0,dupper0,
+     &                                     dlower1,dupper1,
+     &                                     dlower2,dupper2,
+     &                                     dx,
+     &                                     patch_touches_bdry,
+     &                                     touches_wall_loc_idx)
+               enddo
+            enddo
+         enddo
+      enddo
+
+      return
+      end
+
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Compute second-order fast sweep solution at a given grid cell
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine evalsweep2ndorder3d(
+     &     U,U_gcw,
+     &     ilower0,iupper0,
+     &     ilower1,iupper1,
+     &     ilower2,iupper2,
+     &     i0,i1,i2,
+     &     dlower0,dupper0,
+     &     dlower1,dupper1,
+     &     dlower2,dupper2,
+     &     dx,
+     &     patch_touches_bdry,
+     &     touches_wall_loc_idx)
+c
+      implicit none
+include(TOP_SRCDIR/src/fortran/const.i)dnl
+c
+c     Input.
+c
+      INTEGER ilower0,iupper0
+      INTEGER ilower1,iupper1
+      INTEGER ilower2,iupper2
+      INTEGER dlower0,dupper0
+      INTEGER dlower1,dupper1
+      INTEGER dlower2,dupper2
+      INTEGER U_gcw
+      INTEGER patch_touches_bdry
+
+c
+c     Input/Output.
+c
+      REAL U(CELL3d(ilower,iupper,U_gcw))
+      REAL dx(0:NDIM-1)
+      INTEGER touches_wall_loc_idx(0:2*NDIM - 1)
+c
+c     Local variables.
+c
+      INTEGER i0,i1,i2
+      INTEGER lower_is_wall,upper_is_wall
+      REAL    sgn
+      REAL    dbar
+      REAL    b(0:NDIM-1),w(0:NDIM-1)
+
+      if (U(i0,i1,i2) .eq. zero) return
+      sgn = sign(one,U(i0,i1,i2))
+
+c     Upwind approximation in the x direction.
+      lower_is_wall = 0
+      upper_is_wall = 0
+      if (patch_touches_bdry .eq. 1) then
+         lower_is_wall = touches_wall_loc_idx(0)
+         upper_is_wall = touches_wall_loc_idx(1)
+      endif
+      call upwindeikonal2ndorder(sgn,
+     &     U(i0-2,i1,i2),U(i0-1,i1,i2),
+     &     U(i0+1,i1,i2),U(i0+2,i1,i2),
+     &     dx(0),i0,dlower0,dupper0,
+     &     lower_is_wall,upper_is_wall,b(0),w(0))
+
+c     Upwind approximation in the y direction.
+      lower_is_wall = 0
+      upper_is_wall = 0
+      if (patch_touches_bdry .eq. 1) then
+         lower_is_wall = touches_wall_loc_idx(2)
+         upper_is_wall = touches_wall_loc_idx(3)
+      endif
+      call upwindeikonal2ndorder(sgn,
+     &     U(i0,i1-2,i2),U(i0,i1-1,i2),
+     &     U(i0,i1+1,i2),U(i0,i1+2,i2),
+     &     dx(1),i1,dlower1,dupper1,
+     &     lower_is_wall,upper_is_wall,b(1),w(1))
+
+c     Upwind approximation in the z direction.
+      lower_is_wall = 0
+      upper_is_wall = 0
+      if (patch_touches_bdry .eq. 1) then
+         lower_is_wall = touches_wall_loc_idx(4)
+         upper_is_wall = touches_wall_loc_idx(5)
+      endif
+      call upwindeikonal2ndorder(sgn,
+     &     U(i0,i1,i2-2),U(i0,i1,i2-1),
+     &     U(i0,i1,i2+1),U(i0,i1,i2+2),
+     &     dx(2),i2,dlower2,dupper2,
+     &     lower_is_wall,upper_is_wall,b(2),w(2))
+
+      call solveeikonal2ndorder(sgn,NDIM,b,w,dbar)
+      U(i0,i1,i2) = sgn*dmin1(sgn*U(i0,i1,i2),sgn*dbar)
+
+      return
+      end
+
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
 c     Carry out first order relaxation scheme using Gauss Seidel updates
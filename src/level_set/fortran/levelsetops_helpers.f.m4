@@ -0,0 +1,176 @@
+c ---------------------------------------------------------------------
+c
+c Copyright (c) 2019 - 2019 by the IBAMR developers
+c All rights reserved.
+c
+c This file is part of IBAMR.
+c
+c IBAMR is free software and is distributed under the 3-clause BSD
+c license. The full text of the license can be found in the file
+c COPYRIGHT at the top level directory of IBAMR.
+c
+c ---------------------------------------------------------------------
+
+dnl Process this file with m4 to produce FORTRAN source code
+define(REAL,`double precision')dnl
+define(INTEGER,`integer')dnl
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Compute the upwind approximation along one direction for the
+c     second-order fast sweeping algorithm. The approximation satisfies
+c     dD/dx ~ w*(D - b). A second-order one-sided difference is used
+c     when the two upwind values are monotone; otherwise this falls back
+c     to a first-order difference. Here i is the index of the cell along
+c     this direction and dlower and dupper are the extents of the
+c     physical domain. If lower_is_wall (upper_is_wall) is 1 then cells
+c     adjacent to the lower (upper) domain boundary use a zero distance
+c     at the wall, which is half a grid cell away.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine upwindeikonal2ndorder(
+     &     sgn,
+     &     um2,um1,up1,up2,
+     &     h,
+     &     i,dlower,dupper,
+     &     lower_is_wall,upper_is_wall,
+     &     b,w)
+c
+      implicit none
+include(TOP_SRCDIR/src/fortran/const.i)dnl
+c
+c     Input.
+c
+      REAL sgn
+      REAL um2,um1,up1,up2
+      REAL h
+      INTEGER i,dlower,dupper
+      INTEGER lower_is_wall,upper_is_wall
+c
+c     Output.
+c
+      REAL b,w
+c
+c     Local variables.
+c
+      INTEGER lwall,uwall
+
+c     Determine the distance (in cells) to a wall, if it is close enough
+c     to affect the stencil.
+      lwall = 0
+      uwall = 0
+      if (lower_is_wall .eq. 1) then
+         if (i .eq. dlower) lwall = 1
+         if (i .eq. dlower+1) lwall = 2
+      endif
+      if (upper_is_wall .eq. 1) then
+         if (i .eq. dupper) uwall = 1
+         if (i .eq. dupper-1) uwall = 2
+      endif
+
+      if (lwall .eq. 1 .or. uwall .eq. 1) then
+         b = zero
+         w = two/h
+         return
+      endif
+
+      if (sgn*um1 .le. sgn*up1) then
+         if (lwall .eq. 0 .and. sgn*um2 .le. sgn*um1) then
+            b = (four*um1 - um2)/three
+            w = onept5/h
+         else
+            b = um1
+            w = one/h
+         endif
+      else
+         if (uwall .eq. 0 .and. sgn*up2 .le. sgn*up1) then
+            b = (four*up1 - up2)/three
+            w = onept5/h
+         else
+            b = up1
+            w = one/h
+         endif
+      endif
+
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Combine the upwind approximations dD/dx_d ~ w_d*(D - b_d) in the n
+c     coordinate directions into the solution dbar of the discretized
+c     Eikonal equation sum_d w_d^2 (dbar - b_d)^2 = 1.  The arrays b and
+c     w are reordered.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine solveeikonal2ndorder(
+     &     sgn,n,
+     &     b,w,
+     &     dbar)
+c
+      implicit none
+include(TOP_SRCDIR/src/fortran/const.i)dnl
+c
+c     Input.
+c
+      REAL sgn
+      INTEGER n
+c
+c     Input/Output.
+c
+      REAL b(0:n-1),w(0:n-1)
+c
+c     Output.
+c
+      REAL dbar
+c
+c     Local variables.
+c
+      INTEGER d,k,m
+      REAL    tmp
+      REAL    Q,R,S,disc
+      LOGICAL done
+
+c     Sort the upwind approximations so that the closest one comes first.
+      do k = 0,n-2
+         do m = 0,n-2-k
+            if (sgn*b(m) .gt. sgn*b(m+1)) then
+               tmp = b(m)
+               b(m) = b(m+1)
+               b(m+1) = tmp
+               tmp = w(m)
+               w(m) = w(m+1)
+               w(m+1) = tmp
+            endif
+         enddo
+      enddo
+
+c     Add one direction at a time for as long as the solution is downwind
+c     of that direction.
+      dbar = b(0) + sgn/w(0)
+      Q = w(0)*w(0)
+      R = -two*w(0)*w(0)*b(0)
+      S = w(0)*w(0)*b(0)*b(0) - one
+      done = .false.
+      do d = 1,n-1
+         if (.not. done) then
+            if (sgn*dbar .le. sgn*b(d)) then
+               done = .true.
+            else
+               Q = Q + w(d)*w(d)
+               R = R - two*w(d)*w(d)*b(d)
+               S = S + w(d)*w(d)*b(d)*b(d)
+               disc = R*R - four*Q*S
+               if (disc .lt. zero) then
+                  done = .true.
+               else
+                  dbar = (-R + sgn*sqrt(disc))/(two*Q)
+               endif
+            endif
+         endif
+      enddo
+
+      return
+      end
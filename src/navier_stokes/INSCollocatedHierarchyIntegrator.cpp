@@ -1246,7 +1246,10 @@ INSCollocatedHierarchyIntegrator::integrateHierarchy(const double current_time,
 
     // Solve for U(*) and compute u_ADV(*).
     d_hier_cc_data_ops->copyData(d_U_scratch_idx, d_U_new_idx);
+    startTelemetryPhase("velocity_solve");
     d_velocity_solver->solveSystem(*d_U_scratch_vec, *d_U_rhs_vec);
+    stopTelemetryPhase("velocity_solve");
+    recordTelemetryValue("velocity_solver_iterations", d_velocity_solver->getNumIterations());
     if (d_enable_logging && d_enable_logging_solver_iterations)
         plog << d_object_name << "::integrateHierarchy(): velocity solve number of iterations = "
              << d_velocity_solver->getNumIterations() << "\n";
@@ -1291,7 +1294,10 @@ INSCollocatedHierarchyIntegrator::integrateHierarchy(const double current_time,
     {
         d_hier_cc_data_ops->setToScalar(d_Phi_idx, 0.0);
     }
+    startTelemetryPhase("pressure_solve");
     d_pressure_solver->solveSystem(*d_Phi_vec, *d_Phi_rhs_vec);
+    stopTelemetryPhase("pressure_solve");
+    recordTelemetryValue("pressure_solver_iterations", d_pressure_solver->getNumIterations());
     if (d_enable_logging && d_enable_logging_solver_iterations)
         plog << d_object_name << "::integrateHierarchy(): pressure solve number of iterations = "
              << d_pressure_solver->getNumIterations() << "\n";
@@ -22,6 +22,7 @@
 #include "ibamr/ibamr_enums.h"
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 
+#include "ibtk/CachedCartGridFunction.h"
 #include "ibtk/CartGridFunction.h"
 #include "ibtk/CartGridFunctionSet.h"
 #include "ibtk/HierarchyGhostCellInterpolation.h"
@@ -176,6 +177,13 @@ INSHierarchyIntegrator::registerBodyForceFunction(Pointer<CartGridFunction> F_fc
 #if !defined(NDEBUG)
     TBOX_ASSERT(!d_integrator_is_initialized);
 #endif
+    // Body forces that do not depend on time are evaluated once on each patch
+    // and subsequently copied from the cache.
+    if (!F_fcn->isTimeDependent())
+    {
+        F_fcn = new CachedCartGridFunction(
+            d_object_name + "::body_force_function_cache_" + std::to_string(d_num_cached_F_fcns++), F_fcn);
+    }
     if (d_F_fcn)
     {
         Pointer<CartGridFunctionSet> p_F_fcn = d_F_fcn;
@@ -48,6 +48,7 @@
 
 #include <stddef.h>
 
+#include <algorithm>
 #include <array>
 #include <ostream>
 #include <string>
@@ -525,6 +526,11 @@ INSStaggeredCUIConvectiveOperator::INSStaggeredCUIConvectiveOperator(std::string
     if (input_db)
     {
         if (input_db->keyExists("bdry_extrap_type")) d_bdry_extrap_type = input_db->getString("bdry_extrap_type");
+        if (input_db->keyExists("reuse_scratch_data"))
+        {
+            const bool reuse_scratch_data = input_db->getBool("reuse_scratch_data");
+            d_face_scratch_data_pool.setReuseData(reuse_scratch_data);
+        }
     }
 
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
@@ -579,11 +585,13 @@ INSStaggeredCUIConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
     TBOX_ASSERT(U_idx == d_u_idx);
 #endif
 
-    // Allocate scratch data.
+    // Scratch data are allocated in initializeOperatorState(), but the scratch
+    // index may be shared with another instance of this class that has since
+    // deallocated it.
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->allocatePatchData(d_U_scratch_idx);
+        if (!level->checkAllocated(d_U_scratch_idx)) level->allocatePatchData(d_U_scratch_idx);
     }
 
     // Fill ghost cell values for all components.
@@ -631,8 +639,8 @@ INSStaggeredCUIConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
             for (unsigned int axis = 0; axis < NDIM; ++axis)
             {
                 side_boxes[axis] = SideGeometry<NDIM>::toSideBox(patch_box, axis);
-                U_adv_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
-                U_half_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
+                U_adv_data[axis] = d_face_scratch_data_pool.getScratchData(side_boxes[axis], 1, ghosts, axis);
+                U_half_data[axis] = d_face_scratch_data_pool.getScratchData(side_boxes[axis], 1, ghosts, NDIM + axis);
             }
 #if (NDIM == 2)
             NAVIER_STOKES_INTERP_COMPS_FC(patch_lower(0),
@@ -1036,13 +1044,6 @@ INSStaggeredCUIConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
         }
     }
 
-    // Deallocate scratch data.
-    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
-    {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->deallocatePatchData(d_U_scratch_idx);
-    }
-
     IBAMR_TIMER_STOP(t_apply_convective_operator);
     return;
 } // applyConvectiveOperator
@@ -1087,6 +1088,14 @@ INSStaggeredCUIConvectiveOperator::initializeOperatorState(const SAMRAIVectorRea
     d_bc_helper = new StaggeredStokesPhysicalBoundaryHelper();
     d_bc_helper->cacheBcCoefData(d_bc_coefs, d_solution_time, d_hierarchy);
 
+    // Allocate scratch data.
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        if (!level->checkAllocated(d_U_scratch_idx)) level->allocatePatchData(d_U_scratch_idx);
+    }
+    d_face_scratch_data_pool.clear();
+
     d_is_initialized = true;
 
     IBAMR_TIMER_STOP(t_initialize_operator_state);
@@ -1104,6 +1113,15 @@ INSStaggeredCUIConvectiveOperator::deallocateOperatorState()
     d_hier_bdry_fill.setNull();
     d_bc_helper.setNull();
 
+    // Deallocate scratch data.
+    const int finest_ln = std::min(d_finest_ln, d_hierarchy->getFinestLevelNumber());
+    for (int ln = d_coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        if (level->checkAllocated(d_U_scratch_idx)) level->deallocatePatchData(d_U_scratch_idx);
+    }
+    d_face_scratch_data_pool.clear();
+
     d_is_initialized = false;
 
     IBAMR_TIMER_STOP(t_deallocate_operator_state);
@@ -1418,7 +1418,10 @@ INSStaggeredHierarchyIntegrator::integrateHierarchy(const double current_time,
     setupSolverVectors(d_sol_vec, d_rhs_vec, current_time, new_time, cycle_num);
 
     // Solve for u(n+1), p(n+1/2).
+    startTelemetryPhase("stokes_solve");
     d_stokes_solver->solveSystem(*d_sol_vec, *d_rhs_vec);
+    stopTelemetryPhase("stokes_solve");
+    recordTelemetryValue("stokes_solver_iterations", d_stokes_solver->getNumIterations());
     if (d_enable_logging && d_enable_logging_solver_iterations)
         plog << d_object_name
              << "::integrateHierarchy(): stokes solve number of iterations = " << d_stokes_solver->getNumIterations()
@@ -2188,46 +2191,76 @@ INSStaggeredHierarchyIntegrator::resetHierarchyConfigurationSpecialized(
     d_hier_sc_data_ops->setPatchHierarchy(hierarchy);
     d_hier_sc_data_ops->resetLevels(0, finest_hier_level);
 
-    // Setup the patch boundary filling objects.
+    // Setup the patch boundary filling objects.  Objects that already exist are
+    // reinitialized, so that communication schedules are only rebuilt for levels
+    // that have been changed by regridding.
     using InterpolationTransactionComponent = HierarchyGhostCellInterpolation::InterpolationTransactionComponent;
-    InterpolationTransactionComponent U_bc_component(d_U_scratch_idx,
-                                                     DATA_REFINE_TYPE,
-                                                     USE_CF_INTERPOLATION,
-                                                     DATA_COARSEN_TYPE,
-                                                     d_bdry_extrap_type, // TODO: update variable name
-                                                     CONSISTENT_TYPE_2_BDRY,
-                                                     d_U_bc_coefs);
-    d_U_bdry_bc_fill_op = new HierarchyGhostCellInterpolation();
-    d_U_bdry_bc_fill_op->initializeOperatorState(U_bc_component, d_hierarchy);
-
-    InterpolationTransactionComponent P_bc_component(d_P_scratch_idx,
-                                                     DATA_REFINE_TYPE,
-                                                     USE_CF_INTERPOLATION,
-                                                     DATA_COARSEN_TYPE,
-                                                     d_bdry_extrap_type, // TODO: update variable name
-                                                     CONSISTENT_TYPE_2_BDRY,
-                                                     d_P_bc_coef);
-    d_P_bdry_bc_fill_op = new HierarchyGhostCellInterpolation();
-    d_P_bdry_bc_fill_op->initializeOperatorState(P_bc_component, d_hierarchy);
+    if (d_U_bdry_bc_fill_op)
+    {
+        d_U_bdry_bc_fill_op->reinitializeOperatorState(d_hierarchy);
+    }
+    else
+    {
+        InterpolationTransactionComponent U_bc_component(d_U_scratch_idx,
+                                                         DATA_REFINE_TYPE,
+                                                         USE_CF_INTERPOLATION,
+                                                         DATA_COARSEN_TYPE,
+                                                         d_bdry_extrap_type, // TODO: update variable name
+                                                         CONSISTENT_TYPE_2_BDRY,
+                                                         d_U_bc_coefs);
+        d_U_bdry_bc_fill_op = new HierarchyGhostCellInterpolation();
+        d_U_bdry_bc_fill_op->initializeOperatorState(U_bc_component, d_hierarchy);
+    }
 
-    if (d_Q_fcn)
+    if (d_P_bdry_bc_fill_op)
+    {
+        d_P_bdry_bc_fill_op->reinitializeOperatorState(d_hierarchy);
+    }
+    else
     {
-        InterpolationTransactionComponent Q_bc_component(d_Q_scratch_idx,
+        InterpolationTransactionComponent P_bc_component(d_P_scratch_idx,
                                                          DATA_REFINE_TYPE,
                                                          USE_CF_INTERPOLATION,
                                                          DATA_COARSEN_TYPE,
                                                          d_bdry_extrap_type, // TODO: update variable name
-                                                         CONSISTENT_TYPE_2_BDRY);
-        d_Q_bdry_bc_fill_op = new HierarchyGhostCellInterpolation();
-        d_Q_bdry_bc_fill_op->initializeOperatorState(Q_bc_component, d_hierarchy);
+                                                         CONSISTENT_TYPE_2_BDRY,
+                                                         d_P_bc_coef);
+        d_P_bdry_bc_fill_op = new HierarchyGhostCellInterpolation();
+        d_P_bdry_bc_fill_op->initializeOperatorState(P_bc_component, d_hierarchy);
+    }
+
+    if (d_Q_fcn)
+    {
+        if (d_Q_bdry_bc_fill_op)
+        {
+            d_Q_bdry_bc_fill_op->reinitializeOperatorState(d_hierarchy);
+        }
+        else
+        {
+            InterpolationTransactionComponent Q_bc_component(d_Q_scratch_idx,
+                                                             DATA_REFINE_TYPE,
+                                                             USE_CF_INTERPOLATION,
+                                                             DATA_COARSEN_TYPE,
+                                                             d_bdry_extrap_type, // TODO: update variable name
+                                                             CONSISTENT_TYPE_2_BDRY);
+            d_Q_bdry_bc_fill_op = new HierarchyGhostCellInterpolation();
+            d_Q_bdry_bc_fill_op->initializeOperatorState(Q_bc_component, d_hierarchy);
+        }
     }
 
     // Setup the patch boundary synchronization objects.
     using SynchronizationTransactionComponent = SideDataSynchronization::SynchronizationTransactionComponent;
-    SynchronizationTransactionComponent synch_transaction =
-        SynchronizationTransactionComponent(d_U_scratch_idx, d_U_coarsen_type);
-    d_side_synch_op = new SideDataSynchronization();
-    d_side_synch_op->initializeOperatorState(synch_transaction, d_hierarchy);
+    if (d_side_synch_op)
+    {
+        d_side_synch_op->reinitializeOperatorState(d_hierarchy);
+    }
+    else
+    {
+        SynchronizationTransactionComponent synch_transaction =
+            SynchronizationTransactionComponent(d_U_scratch_idx, d_U_coarsen_type);
+        d_side_synch_op = new SideDataSynchronization();
+        d_side_synch_op->initializeOperatorState(synch_transaction, d_hierarchy);
+    }
 
     // Indicate that vectors and solvers need to be re-initialized.
     d_coarsest_reset_ln = coarsest_level;
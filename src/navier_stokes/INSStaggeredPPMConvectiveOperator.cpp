@@ -24,6 +24,7 @@
 
 #include "ibtk/HierarchyGhostCellInterpolation.h"
 
+#include "ArrayData.h"
 #include "Box.h"
 #include "CartesianPatchGeometry.h"
 #include "FaceData.h"
@@ -46,6 +47,7 @@
 #include "tbox/TimerManager.h"
 #include "tbox/Utilities.h"
 
+#include <algorithm>
 #include <array>
 #include <ostream>
 #include <string>
@@ -470,6 +472,13 @@ INSStaggeredPPMConvectiveOperator::INSStaggeredPPMConvectiveOperator(std::string
     if (input_db)
     {
         if (input_db->keyExists("bdry_extrap_type")) d_bdry_extrap_type = input_db->getString("bdry_extrap_type");
+        if (input_db->keyExists("tile_size")) d_tile_size = input_db->getInteger("tile_size");
+        if (input_db->keyExists("reuse_scratch_data"))
+        {
+            const bool reuse_scratch_data = input_db->getBool("reuse_scratch_data");
+            d_face_scratch_data_pool.setReuseData(reuse_scratch_data);
+            d_side_scratch_data_pool.setReuseData(reuse_scratch_data);
+        }
     }
 
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
@@ -524,11 +533,13 @@ INSStaggeredPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
     TBOX_ASSERT(U_idx == d_u_idx);
 #endif
 
-    // Allocate scratch data.
+    // Scratch data are allocated in initializeOperatorState(), but the scratch
+    // index may be shared with another instance of this class that has since
+    // deallocated it.
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->allocatePatchData(d_U_scratch_idx);
+        if (!level->checkAllocated(d_U_scratch_idx)) level->allocatePatchData(d_U_scratch_idx);
     }
 
     // Fill ghost cell values for all components.
@@ -562,402 +573,63 @@ INSStaggeredPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
             const double* const dx = patch_geom->getDx();
 
             const Box<NDIM>& patch_box = patch->getBox();
-            const IntVector<NDIM>& patch_lower = patch_box.lower();
-            const IntVector<NDIM>& patch_upper = patch_box.upper();
 
             Pointer<SideData<NDIM, double> > N_data = patch->getPatchData(N_idx);
             Pointer<SideData<NDIM, double> > U_data = patch->getPatchData(d_U_scratch_idx);
 
-            const IntVector<NDIM> ghosts = IntVector<NDIM>(1);
-            std::array<Box<NDIM>, NDIM> side_boxes;
-            std::array<Pointer<FaceData<NDIM, double> >, NDIM> U_adv_data;
-            std::array<Pointer<FaceData<NDIM, double> >, NDIM> U_half_data;
-            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            bool use_tiles = d_tile_size > 0;
+            for (unsigned int d = 0; d < NDIM; ++d)
             {
-                side_boxes[axis] = SideGeometry<NDIM>::toSideBox(patch_box, axis);
-                U_adv_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
-                U_half_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
+                use_tiles = use_tiles && patch_box.numberCells(d) > d_tile_size;
             }
-#if (NDIM == 2)
-            NAVIER_STOKES_INTERP_COMPS_FC(patch_lower(0),
-                                          patch_upper(0),
-                                          patch_lower(1),
-                                          patch_upper(1),
-                                          U_data->getGhostCellWidth()(0),
-                                          U_data->getGhostCellWidth()(1),
-                                          U_data->getPointer(0),
-                                          U_data->getPointer(1),
-                                          side_boxes[0].lower(0),
-                                          side_boxes[0].upper(0),
-                                          side_boxes[0].lower(1),
-                                          side_boxes[0].upper(1),
-                                          U_adv_data[0]->getGhostCellWidth()(0),
-                                          U_adv_data[0]->getGhostCellWidth()(1),
-                                          U_adv_data[0]->getPointer(0),
-                                          U_adv_data[0]->getPointer(1),
-                                          side_boxes[1].lower(0),
-                                          side_boxes[1].upper(0),
-                                          side_boxes[1].lower(1),
-                                          side_boxes[1].upper(1),
-                                          U_adv_data[1]->getGhostCellWidth()(0),
-                                          U_adv_data[1]->getGhostCellWidth()(1),
-                                          U_adv_data[1]->getPointer(0),
-                                          U_adv_data[1]->getPointer(1));
-#endif
-#if (NDIM == 3)
-            NAVIER_STOKES_INTERP_COMPS_FC(patch_lower(0),
-                                          patch_upper(0),
-                                          patch_lower(1),
-                                          patch_upper(1),
-                                          patch_lower(2),
-                                          patch_upper(2),
-                                          U_data->getGhostCellWidth()(0),
-                                          U_data->getGhostCellWidth()(1),
-                                          U_data->getGhostCellWidth()(2),
-                                          U_data->getPointer(0),
-                                          U_data->getPointer(1),
-                                          U_data->getPointer(2),
-                                          side_boxes[0].lower(0),
-                                          side_boxes[0].upper(0),
-                                          side_boxes[0].lower(1),
-                                          side_boxes[0].upper(1),
-                                          side_boxes[0].lower(2),
-                                          side_boxes[0].upper(2),
-                                          U_adv_data[0]->getGhostCellWidth()(0),
-                                          U_adv_data[0]->getGhostCellWidth()(1),
-                                          U_adv_data[0]->getGhostCellWidth()(2),
-                                          U_adv_data[0]->getPointer(0),
-                                          U_adv_data[0]->getPointer(1),
-                                          U_adv_data[0]->getPointer(2),
-                                          side_boxes[1].lower(0),
-                                          side_boxes[1].upper(0),
-                                          side_boxes[1].lower(1),
-                                          side_boxes[1].upper(1),
-                                          side_boxes[1].lower(2),
-                                          side_boxes[1].upper(2),
-                                          U_adv_data[1]->getGhostCellWidth()(0),
-                                          U_adv_data[1]->getGhostCellWidth()(1),
-                                          U_adv_data[1]->getGhostCellWidth()(2),
-                                          U_adv_data[1]->getPointer(0),
-                                          U_adv_data[1]->getPointer(1),
-                                          U_adv_data[1]->getPointer(2),
-                                          side_boxes[2].lower(0),
-                                          side_boxes[2].upper(0),
-                                          side_boxes[2].lower(1),
-                                          side_boxes[2].upper(1),
-                                          side_boxes[2].lower(2),
-                                          side_boxes[2].upper(2),
-                                          U_adv_data[2]->getGhostCellWidth()(0),
-                                          U_adv_data[2]->getGhostCellWidth()(1),
-                                          U_adv_data[2]->getGhostCellWidth()(2),
-                                          U_adv_data[2]->getPointer(0),
-                                          U_adv_data[2]->getPointer(1),
-                                          U_adv_data[2]->getPointer(2));
-#endif
-            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            if (!use_tiles)
             {
-                Pointer<SideData<NDIM, double> > dU_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-                Pointer<SideData<NDIM, double> > U_L_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-                Pointer<SideData<NDIM, double> > U_R_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-                Pointer<SideData<NDIM, double> > U_scratch1_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-#if (NDIM == 3)
-                Pointer<SideData<NDIM, double> > U_scratch2_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-#endif
-#if (NDIM == 2)
-                GODUNOV_EXTRAPOLATE_FC(side_boxes[axis].lower(0),
-                                       side_boxes[axis].upper(0),
-                                       side_boxes[axis].lower(1),
-                                       side_boxes[axis].upper(1),
-                                       U_data->getGhostCellWidth()(0),
-                                       U_data->getGhostCellWidth()(1),
-                                       U_data->getPointer(axis),
-                                       U_scratch1_data->getPointer(axis),
-                                       dU_data->getPointer(axis),
-                                       U_L_data->getPointer(axis),
-                                       U_R_data->getPointer(axis),
-                                       U_adv_data[axis]->getGhostCellWidth()(0),
-                                       U_adv_data[axis]->getGhostCellWidth()(1),
-                                       U_half_data[axis]->getGhostCellWidth()(0),
-                                       U_half_data[axis]->getGhostCellWidth()(1),
-                                       U_adv_data[axis]->getPointer(0),
-                                       U_adv_data[axis]->getPointer(1),
-                                       U_half_data[axis]->getPointer(0),
-                                       U_half_data[axis]->getPointer(1));
-#endif
-#if (NDIM == 3)
-                GODUNOV_EXTRAPOLATE_FC(side_boxes[axis].lower(0),
-                                       side_boxes[axis].upper(0),
-                                       side_boxes[axis].lower(1),
-                                       side_boxes[axis].upper(1),
-                                       side_boxes[axis].lower(2),
-                                       side_boxes[axis].upper(2),
-                                       U_data->getGhostCellWidth()(0),
-                                       U_data->getGhostCellWidth()(1),
-                                       U_data->getGhostCellWidth()(2),
-                                       U_data->getPointer(axis),
-                                       U_scratch1_data->getPointer(axis),
-                                       U_scratch2_data->getPointer(axis),
-                                       dU_data->getPointer(axis),
-                                       U_L_data->getPointer(axis),
-                                       U_R_data->getPointer(axis),
-                                       U_adv_data[axis]->getGhostCellWidth()(0),
-                                       U_adv_data[axis]->getGhostCellWidth()(1),
-                                       U_adv_data[axis]->getGhostCellWidth()(2),
-                                       U_half_data[axis]->getGhostCellWidth()(0),
-                                       U_half_data[axis]->getGhostCellWidth()(1),
-                                       U_half_data[axis]->getGhostCellWidth()(2),
-                                       U_adv_data[axis]->getPointer(0),
-                                       U_adv_data[axis]->getPointer(1),
-                                       U_adv_data[axis]->getPointer(2),
-                                       U_half_data[axis]->getPointer(0),
-                                       U_half_data[axis]->getPointer(1),
-                                       U_half_data[axis]->getPointer(2));
-#endif
+                computeConvectiveDerivative(patch_box, dx, U_data, N_data);
+                continue;
             }
-#if (NDIM == 2)
-            NAVIER_STOKES_RESET_ADV_VELOCITY_FC(side_boxes[0].lower(0),
-                                                side_boxes[0].upper(0),
-                                                side_boxes[0].lower(1),
-                                                side_boxes[0].upper(1),
-                                                U_adv_data[0]->getGhostCellWidth()(0),
-                                                U_adv_data[0]->getGhostCellWidth()(1),
-                                                U_adv_data[0]->getPointer(0),
-                                                U_adv_data[0]->getPointer(1),
-                                                U_half_data[0]->getGhostCellWidth()(0),
-                                                U_half_data[0]->getGhostCellWidth()(1),
-                                                U_half_data[0]->getPointer(0),
-                                                U_half_data[0]->getPointer(1),
-                                                side_boxes[1].lower(0),
-                                                side_boxes[1].upper(0),
-                                                side_boxes[1].lower(1),
-                                                side_boxes[1].upper(1),
-                                                U_adv_data[1]->getGhostCellWidth()(0),
-                                                U_adv_data[1]->getGhostCellWidth()(1),
-                                                U_adv_data[1]->getPointer(0),
-                                                U_adv_data[1]->getPointer(1),
-                                                U_half_data[1]->getGhostCellWidth()(0),
-                                                U_half_data[1]->getGhostCellWidth()(1),
-                                                U_half_data[1]->getPointer(0),
-                                                U_half_data[1]->getPointer(1));
-#endif
-#if (NDIM == 3)
-            NAVIER_STOKES_RESET_ADV_VELOCITY_FC(side_boxes[0].lower(0),
-                                                side_boxes[0].upper(0),
-                                                side_boxes[0].lower(1),
-                                                side_boxes[0].upper(1),
-                                                side_boxes[0].lower(2),
-                                                side_boxes[0].upper(2),
-                                                U_adv_data[0]->getGhostCellWidth()(0),
-                                                U_adv_data[0]->getGhostCellWidth()(1),
-                                                U_adv_data[0]->getGhostCellWidth()(2),
-                                                U_adv_data[0]->getPointer(0),
-                                                U_adv_data[0]->getPointer(1),
-                                                U_adv_data[0]->getPointer(2),
-                                                U_half_data[0]->getGhostCellWidth()(0),
-                                                U_half_data[0]->getGhostCellWidth()(1),
-                                                U_half_data[0]->getGhostCellWidth()(2),
-                                                U_half_data[0]->getPointer(0),
-                                                U_half_data[0]->getPointer(1),
-                                                U_half_data[0]->getPointer(2),
-                                                side_boxes[1].lower(0),
-                                                side_boxes[1].upper(0),
-                                                side_boxes[1].lower(1),
-                                                side_boxes[1].upper(1),
-                                                side_boxes[1].lower(2),
-                                                side_boxes[1].upper(2),
-                                                U_adv_data[1]->getGhostCellWidth()(0),
-                                                U_adv_data[1]->getGhostCellWidth()(1),
-                                                U_adv_data[1]->getGhostCellWidth()(2),
-                                                U_adv_data[1]->getPointer(0),
-                                                U_adv_data[1]->getPointer(1),
-                                                U_adv_data[1]->getPointer(2),
-                                                U_half_data[1]->getGhostCellWidth()(0),
-                                                U_half_data[1]->getGhostCellWidth()(1),
-                                                U_half_data[1]->getGhostCellWidth()(2),
-                                                U_half_data[1]->getPointer(0),
-                                                U_half_data[1]->getPointer(1),
-                                                U_half_data[1]->getPointer(2),
-                                                side_boxes[2].lower(0),
-                                                side_boxes[2].upper(0),
-                                                side_boxes[2].lower(1),
-                                                side_boxes[2].upper(1),
-                                                side_boxes[2].lower(2),
-                                                side_boxes[2].upper(2),
-                                                U_adv_data[2]->getGhostCellWidth()(0),
-                                                U_adv_data[2]->getGhostCellWidth()(1),
-                                                U_adv_data[2]->getGhostCellWidth()(2),
-                                                U_adv_data[2]->getPointer(0),
-                                                U_adv_data[2]->getPointer(1),
-                                                U_adv_data[2]->getPointer(2),
-                                                U_half_data[2]->getGhostCellWidth()(0),
-                                                U_half_data[2]->getGhostCellWidth()(1),
-                                                U_half_data[2]->getGhostCellWidth()(2),
-                                                U_half_data[2]->getPointer(0),
-                                                U_half_data[2]->getPointer(1),
-                                                U_half_data[2]->getPointer(2));
-#endif
-            for (unsigned int axis = 0; axis < NDIM; ++axis)
+
+            // Process the patch one tile at a time.  The velocity (including
+            // the ghost cells required by the PPM stencils) is copied into
+            // tile-sized scratch data, so that all of the intermediate face-
+            // and side-centered data used by the Godunov predictor remain
+            // small enough to stay in cache.  Because the stencils see the
+            // same input values, the result is identical to processing the
+            // whole patch at once.
+            hier::Index<NDIM> last_tile;
+            for (unsigned int d = 0; d < NDIM; ++d)
             {
-                switch (d_difference_form)
+                last_tile(d) = (patch_box.numberCells(d) + d_tile_size - 1) / d_tile_size - 1;
+            }
+            const Box<NDIM> tile_index_box(hier::Index<NDIM>(0), last_tile);
+            for (Box<NDIM>::Iterator t(tile_index_box); t; t++)
+            {
+                hier::Index<NDIM> tile_lower, tile_upper;
+                for (unsigned int d = 0; d < NDIM; ++d)
                 {
-                case CONSERVATIVE:
-#if (NDIM == 2)
-                    CONVECT_DERIVATIVE_FC(dx,
-                                          side_boxes[axis].lower(0),
-                                          side_boxes[axis].upper(0),
-                                          side_boxes[axis].lower(1),
-                                          side_boxes[axis].upper(1),
-                                          U_adv_data[axis]->getGhostCellWidth()(0),
-                                          U_adv_data[axis]->getGhostCellWidth()(1),
-                                          U_half_data[axis]->getGhostCellWidth()(0),
-                                          U_half_data[axis]->getGhostCellWidth()(1),
-                                          U_adv_data[axis]->getPointer(0),
-                                          U_adv_data[axis]->getPointer(1),
-                                          U_half_data[axis]->getPointer(0),
-                                          U_half_data[axis]->getPointer(1),
-                                          N_data->getGhostCellWidth()(0),
-                                          N_data->getGhostCellWidth()(1),
-                                          N_data->getPointer(axis));
-#endif
-#if (NDIM == 3)
-                    CONVECT_DERIVATIVE_FC(dx,
-                                          side_boxes[axis].lower(0),
-                                          side_boxes[axis].upper(0),
-                                          side_boxes[axis].lower(1),
-                                          side_boxes[axis].upper(1),
-                                          side_boxes[axis].lower(2),
-                                          side_boxes[axis].upper(2),
-                                          U_adv_data[axis]->getGhostCellWidth()(0),
-                                          U_adv_data[axis]->getGhostCellWidth()(1),
-                                          U_adv_data[axis]->getGhostCellWidth()(2),
-                                          U_half_data[axis]->getGhostCellWidth()(0),
-                                          U_half_data[axis]->getGhostCellWidth()(1),
-                                          U_half_data[axis]->getGhostCellWidth()(2),
-                                          U_adv_data[axis]->getPointer(0),
-                                          U_adv_data[axis]->getPointer(1),
-                                          U_adv_data[axis]->getPointer(2),
-                                          U_half_data[axis]->getPointer(0),
-                                          U_half_data[axis]->getPointer(1),
-                                          U_half_data[axis]->getPointer(2),
-                                          N_data->getGhostCellWidth()(0),
-                                          N_data->getGhostCellWidth()(1),
-                                          N_data->getGhostCellWidth()(2),
-                                          N_data->getPointer(axis));
-#endif
-                    break;
-                case ADVECTIVE:
-#if (NDIM == 2)
-                    ADVECT_DERIVATIVE_FC(dx,
-                                         side_boxes[axis].lower(0),
-                                         side_boxes[axis].upper(0),
-                                         side_boxes[axis].lower(1),
-                                         side_boxes[axis].upper(1),
-                                         U_adv_data[axis]->getGhostCellWidth()(0),
-                                         U_adv_data[axis]->getGhostCellWidth()(1),
-                                         U_half_data[axis]->getGhostCellWidth()(0),
-                                         U_half_data[axis]->getGhostCellWidth()(1),
-                                         U_adv_data[axis]->getPointer(0),
-                                         U_adv_data[axis]->getPointer(1),
-                                         U_half_data[axis]->getPointer(0),
-                                         U_half_data[axis]->getPointer(1),
-                                         N_data->getGhostCellWidth()(0),
-                                         N_data->getGhostCellWidth()(1),
-                                         N_data->getPointer(axis));
-#endif
-#if (NDIM == 3)
-                    ADVECT_DERIVATIVE_FC(dx,
-                                         side_boxes[axis].lower(0),
-                                         side_boxes[axis].upper(0),
-                                         side_boxes[axis].lower(1),
-                                         side_boxes[axis].upper(1),
-                                         side_boxes[axis].lower(2),
-                                         side_boxes[axis].upper(2),
-                                         U_adv_data[axis]->getGhostCellWidth()(0),
-                                         U_adv_data[axis]->getGhostCellWidth()(1),
-                                         U_adv_data[axis]->getGhostCellWidth()(2),
-                                         U_half_data[axis]->getGhostCellWidth()(0),
-                                         U_half_data[axis]->getGhostCellWidth()(1),
-                                         U_half_data[axis]->getGhostCellWidth()(2),
-                                         U_adv_data[axis]->getPointer(0),
-                                         U_adv_data[axis]->getPointer(1),
-                                         U_adv_data[axis]->getPointer(2),
-                                         U_half_data[axis]->getPointer(0),
-                                         U_half_data[axis]->getPointer(1),
-                                         U_half_data[axis]->getPointer(2),
-                                         N_data->getGhostCellWidth()(0),
-                                         N_data->getGhostCellWidth()(1),
-                                         N_data->getGhostCellWidth()(2),
-                                         N_data->getPointer(axis));
-#endif
-                    break;
-                case SKEW_SYMMETRIC:
-#if (NDIM == 2)
-                    SKEW_SYM_DERIVATIVE_FC(dx,
-                                           side_boxes[axis].lower(0),
-                                           side_boxes[axis].upper(0),
-                                           side_boxes[axis].lower(1),
-                                           side_boxes[axis].upper(1),
-                                           U_adv_data[axis]->getGhostCellWidth()(0),
-                                           U_adv_data[axis]->getGhostCellWidth()(1),
-                                           U_half_data[axis]->getGhostCellWidth()(0),
-                                           U_half_data[axis]->getGhostCellWidth()(1),
-                                           U_adv_data[axis]->getPointer(0),
-                                           U_adv_data[axis]->getPointer(1),
-                                           U_half_data[axis]->getPointer(0),
-                                           U_half_data[axis]->getPointer(1),
-                                           N_data->getGhostCellWidth()(0),
-                                           N_data->getGhostCellWidth()(1),
-                                           N_data->getPointer(axis));
-#endif
-#if (NDIM == 3)
-                    SKEW_SYM_DERIVATIVE_FC(dx,
-                                           side_boxes[axis].lower(0),
-                                           side_boxes[axis].upper(0),
-                                           side_boxes[axis].lower(1),
-                                           side_boxes[axis].upper(1),
-                                           side_boxes[axis].lower(2),
-                                           side_boxes[axis].upper(2),
-                                           U_adv_data[axis]->getGhostCellWidth()(0),
-                                           U_adv_data[axis]->getGhostCellWidth()(1),
-                                           U_adv_data[axis]->getGhostCellWidth()(2),
-                                           U_half_data[axis]->getGhostCellWidth()(0),
-                                           U_half_data[axis]->getGhostCellWidth()(1),
-                                           U_half_data[axis]->getGhostCellWidth()(2),
-                                           U_adv_data[axis]->getPointer(0),
-                                           U_adv_data[axis]->getPointer(1),
-                                           U_adv_data[axis]->getPointer(2),
-                                           U_half_data[axis]->getPointer(0),
-                                           U_half_data[axis]->getPointer(1),
-                                           U_half_data[axis]->getPointer(2),
-                                           N_data->getGhostCellWidth()(0),
-                                           N_data->getGhostCellWidth()(1),
-                                           N_data->getGhostCellWidth()(2),
-                                           N_data->getPointer(axis));
-#endif
-                    break;
-                default:
-                    TBOX_ERROR("INSStaggeredPPMConvectiveOperator::applyConvectiveOperator():\n"
-                               << "  unsupported differencing form: "
-                               << enum_to_string<ConvectiveDifferencingType>(d_difference_form) << " \n"
-                               << "  valid choices are: ADVECTIVE, CONSERVATIVE, "
-                                  "SKEW_SYMMETRIC\n");
+                    tile_lower(d) = patch_box.lower(d) + t()(d) * d_tile_size;
+                    tile_upper(d) = std::min(tile_lower(d) + d_tile_size - 1, patch_box.upper(d));
+                }
+                const Box<NDIM> tile_box(tile_lower, tile_upper);
+                Pointer<SideData<NDIM, double> > U_tile_data = d_side_scratch_data_pool.getScratchData(
+                    tile_box, U_data->getDepth(), U_data->getGhostCellWidth(), 6);
+                Pointer<SideData<NDIM, double> > N_tile_data = d_side_scratch_data_pool.getScratchData(
+                    tile_box, N_data->getDepth(), N_data->getGhostCellWidth(), 7);
+                for (unsigned int axis = 0; axis < NDIM; ++axis)
+                {
+                    ArrayData<NDIM, double>& U_tile_array_data = U_tile_data->getArrayData(axis);
+                    U_tile_array_data.copy(
+                        U_data->getArrayData(axis), U_tile_array_data.getBox(), -IntVector<NDIM>(tile_lower));
+                }
+                computeConvectiveDerivative(U_tile_data->getBox(), dx, U_tile_data, N_tile_data);
+                for (unsigned int axis = 0; axis < NDIM; ++axis)
+                {
+                    N_data->getArrayData(axis).copy(
+                        N_tile_data->getArrayData(axis), SideGeometry<NDIM>::toSideBox(tile_box, axis), tile_lower);
                 }
             }
         }
     }
 
-    // Deallocate scratch data.
-    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
-    {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->deallocatePatchData(d_U_scratch_idx);
-    }
-
     IBAMR_TIMER_STOP(t_apply_convective_operator);
     return;
 } // applyConvectiveOperator
@@ -1002,6 +674,15 @@ INSStaggeredPPMConvectiveOperator::initializeOperatorState(const SAMRAIVectorRea
     d_bc_helper = new StaggeredStokesPhysicalBoundaryHelper();
     d_bc_helper->cacheBcCoefData(d_bc_coefs, d_solution_time, d_hierarchy);
 
+    // Allocate scratch data.
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        if (!level->checkAllocated(d_U_scratch_idx)) level->allocatePatchData(d_U_scratch_idx);
+    }
+    d_face_scratch_data_pool.clear();
+    d_side_scratch_data_pool.clear();
+
     d_is_initialized = true;
 
     IBAMR_TIMER_STOP(t_initialize_operator_state);
@@ -1019,6 +700,16 @@ INSStaggeredPPMConvectiveOperator::deallocateOperatorState()
     d_hier_bdry_fill.setNull();
     d_bc_helper.setNull();
 
+    // Deallocate scratch data.
+    const int finest_ln = std::min(d_finest_ln, d_hierarchy->getFinestLevelNumber());
+    for (int ln = d_coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        if (level->checkAllocated(d_U_scratch_idx)) level->deallocatePatchData(d_U_scratch_idx);
+    }
+    d_face_scratch_data_pool.clear();
+    d_side_scratch_data_pool.clear();
+
     d_is_initialized = false;
 
     IBAMR_TIMER_STOP(t_deallocate_operator_state);
@@ -1029,6 +720,398 @@ INSStaggeredPPMConvectiveOperator::deallocateOperatorState()
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+INSStaggeredPPMConvectiveOperator::computeConvectiveDerivative(const Box<NDIM>& box,
+                                                               const double* const dx,
+                                                               Pointer<SideData<NDIM, double> > U_data,
+                                                               Pointer<SideData<NDIM, double> > N_data)
+{
+    const IntVector<NDIM>& box_lower = box.lower();
+    const IntVector<NDIM>& box_upper = box.upper();
+
+    const IntVector<NDIM> ghosts = IntVector<NDIM>(1);
+    std::array<Box<NDIM>, NDIM> side_boxes;
+    std::array<Pointer<FaceData<NDIM, double> >, NDIM> U_adv_data;
+    std::array<Pointer<FaceData<NDIM, double> >, NDIM> U_half_data;
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        side_boxes[axis] = SideGeometry<NDIM>::toSideBox(box, axis);
+        U_adv_data[axis] = d_face_scratch_data_pool.getScratchData(side_boxes[axis], 1, ghosts, axis);
+        U_half_data[axis] = d_face_scratch_data_pool.getScratchData(side_boxes[axis], 1, ghosts, NDIM + axis);
+    }
+#if (NDIM == 2)
+    NAVIER_STOKES_INTERP_COMPS_FC(box_lower(0),
+                                  box_upper(0),
+                                  box_lower(1),
+                                  box_upper(1),
+                                  U_data->getGhostCellWidth()(0),
+                                  U_data->getGhostCellWidth()(1),
+                                  U_data->getPointer(0),
+                                  U_data->getPointer(1),
+                                  side_boxes[0].lower(0),
+                                  side_boxes[0].upper(0),
+                                  side_boxes[0].lower(1),
+                                  side_boxes[0].upper(1),
+                                  U_adv_data[0]->getGhostCellWidth()(0),
+                                  U_adv_data[0]->getGhostCellWidth()(1),
+                                  U_adv_data[0]->getPointer(0),
+                                  U_adv_data[0]->getPointer(1),
+                                  side_boxes[1].lower(0),
+                                  side_boxes[1].upper(0),
+                                  side_boxes[1].lower(1),
+                                  side_boxes[1].upper(1),
+                                  U_adv_data[1]->getGhostCellWidth()(0),
+                                  U_adv_data[1]->getGhostCellWidth()(1),
+                                  U_adv_data[1]->getPointer(0),
+                                  U_adv_data[1]->getPointer(1));
+#endif
+#if (NDIM == 3)
+    NAVIER_STOKES_INTERP_COMPS_FC(box_lower(0),
+                                  box_upper(0),
+                                  box_lower(1),
+                                  box_upper(1),
+                                  box_lower(2),
+                                  box_upper(2),
+                                  U_data->getGhostCellWidth()(0),
+                                  U_data->getGhostCellWidth()(1),
+                                  U_data->getGhostCellWidth()(2),
+                                  U_data->getPointer(0),
+                                  U_data->getPointer(1),
+                                  U_data->getPointer(2),
+                                  side_boxes[0].lower(0),
+                                  side_boxes[0].upper(0),
+                                  side_boxes[0].lower(1),
+                                  side_boxes[0].upper(1),
+                                  side_boxes[0].lower(2),
+                                  side_boxes[0].upper(2),
+                                  U_adv_data[0]->getGhostCellWidth()(0),
+                                  U_adv_data[0]->getGhostCellWidth()(1),
+                                  U_adv_data[0]->getGhostCellWidth()(2),
+                                  U_adv_data[0]->getPointer(0),
+                                  U_adv_data[0]->getPointer(1),
+                                  U_adv_data[0]->getPointer(2),
+                                  side_boxes[1].lower(0),
+                                  side_boxes[1].upper(0),
+                                  side_boxes[1].lower(1),
+                                  side_boxes[1].upper(1),
+                                  side_boxes[1].lower(2),
+                                  side_boxes[1].upper(2),
+                                  U_adv_data[1]->getGhostCellWidth()(0),
+                                  U_adv_data[1]->getGhostCellWidth()(1),
+                                  U_adv_data[1]->getGhostCellWidth()(2),
+                                  U_adv_data[1]->getPointer(0),
+                                  U_adv_data[1]->getPointer(1),
+                                  U_adv_data[1]->getPointer(2),
+                                  side_boxes[2].lower(0),
+                                  side_boxes[2].upper(0),
+                                  side_boxes[2].lower(1),
+                                  side_boxes[2].upper(1),
+                                  side_boxes[2].lower(2),
+                                  side_boxes[2].upper(2),
+                                  U_adv_data[2]->getGhostCellWidth()(0),
+                                  U_adv_data[2]->getGhostCellWidth()(1),
+                                  U_adv_data[2]->getGhostCellWidth()(2),
+                                  U_adv_data[2]->getPointer(0),
+                                  U_adv_data[2]->getPointer(1),
+                                  U_adv_data[2]->getPointer(2));
+#endif
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        Pointer<SideData<NDIM, double> > dU_data = d_side_scratch_data_pool.getScratchData(
+            U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth(), 0);
+        Pointer<SideData<NDIM, double> > U_L_data = d_side_scratch_data_pool.getScratchData(
+            U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth(), 1);
+        Pointer<SideData<NDIM, double> > U_R_data = d_side_scratch_data_pool.getScratchData(
+            U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth(), 2);
+        Pointer<SideData<NDIM, double> > U_scratch1_data = d_side_scratch_data_pool.getScratchData(
+            U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth(), 3);
+#if (NDIM == 3)
+        Pointer<SideData<NDIM, double> > U_scratch2_data = d_side_scratch_data_pool.getScratchData(
+            U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth(), 4);
+#endif
+#if (NDIM == 2)
+        GODUNOV_EXTRAPOLATE_FC(side_boxes[axis].lower(0),
+                               side_boxes[axis].upper(0),
+                               side_boxes[axis].lower(1),
+                               side_boxes[axis].upper(1),
+                               U_data->getGhostCellWidth()(0),
+                               U_data->getGhostCellWidth()(1),
+                               U_data->getPointer(axis),
+                               U_scratch1_data->getPointer(axis),
+                               dU_data->getPointer(axis),
+                               U_L_data->getPointer(axis),
+                               U_R_data->getPointer(axis),
+                               U_adv_data[axis]->getGhostCellWidth()(0),
+                               U_adv_data[axis]->getGhostCellWidth()(1),
+                               U_half_data[axis]->getGhostCellWidth()(0),
+                               U_half_data[axis]->getGhostCellWidth()(1),
+                               U_adv_data[axis]->getPointer(0),
+                               U_adv_data[axis]->getPointer(1),
+                               U_half_data[axis]->getPointer(0),
+                               U_half_data[axis]->getPointer(1));
+#endif
+#if (NDIM == 3)
+        GODUNOV_EXTRAPOLATE_FC(side_boxes[axis].lower(0),
+                               side_boxes[axis].upper(0),
+                               side_boxes[axis].lower(1),
+                               side_boxes[axis].upper(1),
+                               side_boxes[axis].lower(2),
+                               side_boxes[axis].upper(2),
+                               U_data->getGhostCellWidth()(0),
+                               U_data->getGhostCellWidth()(1),
+                               U_data->getGhostCellWidth()(2),
+                               U_data->getPointer(axis),
+                               U_scratch1_data->getPointer(axis),
+                               U_scratch2_data->getPointer(axis),
+                               dU_data->getPointer(axis),
+                               U_L_data->getPointer(axis),
+                               U_R_data->getPointer(axis),
+                               U_adv_data[axis]->getGhostCellWidth()(0),
+                               U_adv_data[axis]->getGhostCellWidth()(1),
+                               U_adv_data[axis]->getGhostCellWidth()(2),
+                               U_half_data[axis]->getGhostCellWidth()(0),
+                               U_half_data[axis]->getGhostCellWidth()(1),
+                               U_half_data[axis]->getGhostCellWidth()(2),
+                               U_adv_data[axis]->getPointer(0),
+                               U_adv_data[axis]->getPointer(1),
+                               U_adv_data[axis]->getPointer(2),
+                               U_half_data[axis]->getPointer(0),
+                               U_half_data[axis]->getPointer(1),
+                               U_half_data[axis]->getPointer(2));
+#endif
+    }
+#if (NDIM == 2)
+    NAVIER_STOKES_RESET_ADV_VELOCITY_FC(side_boxes[0].lower(0),
+                                        side_boxes[0].upper(0),
+                                        side_boxes[0].lower(1),
+                                        side_boxes[0].upper(1),
+                                        U_adv_data[0]->getGhostCellWidth()(0),
+                                        U_adv_data[0]->getGhostCellWidth()(1),
+                                        U_adv_data[0]->getPointer(0),
+                                        U_adv_data[0]->getPointer(1),
+                                        U_half_data[0]->getGhostCellWidth()(0),
+                                        U_half_data[0]->getGhostCellWidth()(1),
+                                        U_half_data[0]->getPointer(0),
+                                        U_half_data[0]->getPointer(1),
+                                        side_boxes[1].lower(0),
+                                        side_boxes[1].upper(0),
+                                        side_boxes[1].lower(1),
+                                        side_boxes[1].upper(1),
+                                        U_adv_data[1]->getGhostCellWidth()(0),
+                                        U_adv_data[1]->getGhostCellWidth()(1),
+                                        U_adv_data[1]->getPointer(0),
+                                        U_adv_data[1]->getPointer(1),
+                                        U_half_data[1]->getGhostCellWidth()(0),
+                                        U_half_data[1]->getGhostCellWidth()(1),
+                                        U_half_data[1]->getPointer(0),
+                                        U_half_data[1]->getPointer(1));
+#endif
+#if (NDIM == 3)
+    NAVIER_STOKES_RESET_ADV_VELOCITY_FC(side_boxes[0].lower(0),
+                                        side_boxes[0].upper(0),
+                                        side_boxes[0].lower(1),
+                                        side_boxes[0].upper(1),
+                                        side_boxes[0].lower(2),
+                                        side_boxes[0].upper(2),
+                                        U_adv_data[0]->getGhostCellWidth()(0),
+                                        U_adv_data[0]->getGhostCellWidth()(1),
+                                        U_adv_data[0]->getGhostCellWidth()(2),
+                                        U_adv_data[0]->getPointer(0),
+                                        U_adv_data[0]->getPointer(1),
+                                        U_adv_data[0]->getPointer(2),
+                                        U_half_data[0]->getGhostCellWidth()(0),
+                                        U_half_data[0]->getGhostCellWidth()(1),
+                                        U_half_data[0]->getGhostCellWidth()(2),
+                                        U_half_data[0]->getPointer(0),
+                                        U_half_data[0]->getPointer(1),
+                                        U_half_data[0]->getPointer(2),
+                                        side_boxes[1].lower(0),
+                                        side_boxes[1].upper(0),
+                                        side_boxes[1].lower(1),
+                                        side_boxes[1].upper(1),
+                                        side_boxes[1].lower(2),
+                                        side_boxes[1].upper(2),
+                                        U_adv_data[1]->getGhostCellWidth()(0),
+                                        U_adv_data[1]->getGhostCellWidth()(1),
+                                        U_adv_data[1]->getGhostCellWidth()(2),
+                                        U_adv_data[1]->getPointer(0),
+                                        U_adv_data[1]->getPointer(1),
+                                        U_adv_data[1]->getPointer(2),
+                                        U_half_data[1]->getGhostCellWidth()(0),
+                                        U_half_data[1]->getGhostCellWidth()(1),
+                                        U_half_data[1]->getGhostCellWidth()(2),
+                                        U_half_data[1]->getPointer(0),
+                                        U_half_data[1]->getPointer(1),
+                                        U_half_data[1]->getPointer(2),
+                                        side_boxes[2].lower(0),
+                                        side_boxes[2].upper(0),
+                                        side_boxes[2].lower(1),
+                                        side_boxes[2].upper(1),
+                                        side_boxes[2].lower(2),
+                                        side_boxes[2].upper(2),
+                                        U_adv_data[2]->getGhostCellWidth()(0),
+                                        U_adv_data[2]->getGhostCellWidth()(1),
+                                        U_adv_data[2]->getGhostCellWidth()(2),
+                                        U_adv_data[2]->getPointer(0),
+                                        U_adv_data[2]->getPointer(1),
+                                        U_adv_data[2]->getPointer(2),
+                                        U_half_data[2]->getGhostCellWidth()(0),
+                                        U_half_data[2]->getGhostCellWidth()(1),
+                                        U_half_data[2]->getGhostCellWidth()(2),
+                                        U_half_data[2]->getPointer(0),
+                                        U_half_data[2]->getPointer(1),
+                                        U_half_data[2]->getPointer(2));
+#endif
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        switch (d_difference_form)
+        {
+        case CONSERVATIVE:
+#if (NDIM == 2)
+            CONVECT_DERIVATIVE_FC(dx,
+                                  side_boxes[axis].lower(0),
+                                  side_boxes[axis].upper(0),
+                                  side_boxes[axis].lower(1),
+                                  side_boxes[axis].upper(1),
+                                  U_adv_data[axis]->getGhostCellWidth()(0),
+                                  U_adv_data[axis]->getGhostCellWidth()(1),
+                                  U_half_data[axis]->getGhostCellWidth()(0),
+                                  U_half_data[axis]->getGhostCellWidth()(1),
+                                  U_adv_data[axis]->getPointer(0),
+                                  U_adv_data[axis]->getPointer(1),
+                                  U_half_data[axis]->getPointer(0),
+                                  U_half_data[axis]->getPointer(1),
+                                  N_data->getGhostCellWidth()(0),
+                                  N_data->getGhostCellWidth()(1),
+                                  N_data->getPointer(axis));
+#endif
+#if (NDIM == 3)
+            CONVECT_DERIVATIVE_FC(dx,
+                                  side_boxes[axis].lower(0),
+                                  side_boxes[axis].upper(0),
+                                  side_boxes[axis].lower(1),
+                                  side_boxes[axis].upper(1),
+                                  side_boxes[axis].lower(2),
+                                  side_boxes[axis].upper(2),
+                                  U_adv_data[axis]->getGhostCellWidth()(0),
+                                  U_adv_data[axis]->getGhostCellWidth()(1),
+                                  U_adv_data[axis]->getGhostCellWidth()(2),
+                                  U_half_data[axis]->getGhostCellWidth()(0),
+                                  U_half_data[axis]->getGhostCellWidth()(1),
+                                  U_half_data[axis]->getGhostCellWidth()(2),
+                                  U_adv_data[axis]->getPointer(0),
+                                  U_adv_data[axis]->getPointer(1),
+                                  U_adv_data[axis]->getPointer(2),
+                                  U_half_data[axis]->getPointer(0),
+                                  U_half_data[axis]->getPointer(1),
+                                  U_half_data[axis]->getPointer(2),
+                                  N_data->getGhostCellWidth()(0),
+                                  N_data->getGhostCellWidth()(1),
+                                  N_data->getGhostCellWidth()(2),
+                                  N_data->getPointer(axis));
+#endif
+            break;
+        case ADVECTIVE:
+#if (NDIM == 2)
+            ADVECT_DERIVATIVE_FC(dx,
+                                 side_boxes[axis].lower(0),
+                                 side_boxes[axis].upper(0),
+                                 side_boxes[axis].lower(1),
+                                 side_boxes[axis].upper(1),
+                                 U_adv_data[axis]->getGhostCellWidth()(0),
+                                 U_adv_data[axis]->getGhostCellWidth()(1),
+                                 U_half_data[axis]->getGhostCellWidth()(0),
+                                 U_half_data[axis]->getGhostCellWidth()(1),
+                                 U_adv_data[axis]->getPointer(0),
+                                 U_adv_data[axis]->getPointer(1),
+                                 U_half_data[axis]->getPointer(0),
+                                 U_half_data[axis]->getPointer(1),
+                                 N_data->getGhostCellWidth()(0),
+                                 N_data->getGhostCellWidth()(1),
+                                 N_data->getPointer(axis));
+#endif
+#if (NDIM == 3)
+            ADVECT_DERIVATIVE_FC(dx,
+                                 side_boxes[axis].lower(0),
+                                 side_boxes[axis].upper(0),
+                                 side_boxes[axis].lower(1),
+                                 side_boxes[axis].upper(1),
+                                 side_boxes[axis].lower(2),
+                                 side_boxes[axis].upper(2),
+                                 U_adv_data[axis]->getGhostCellWidth()(0),
+                                 U_adv_data[axis]->getGhostCellWidth()(1),
+                                 U_adv_data[axis]->getGhostCellWidth()(2),
+                                 U_half_data[axis]->getGhostCellWidth()(0),
+                                 U_half_data[axis]->getGhostCellWidth()(1),
+                                 U_half_data[axis]->getGhostCellWidth()(2),
+                                 U_adv_data[axis]->getPointer(0),
+                                 U_adv_data[axis]->getPointer(1),
+                                 U_adv_data[axis]->getPointer(2),
+                                 U_half_data[axis]->getPointer(0),
+                                 U_half_data[axis]->getPointer(1),
+                                 U_half_data[axis]->getPointer(2),
+                                 N_data->getGhostCellWidth()(0),
+                                 N_data->getGhostCellWidth()(1),
+                                 N_data->getGhostCellWidth()(2),
+                                 N_data->getPointer(axis));
+#endif
+            break;
+        case SKEW_SYMMETRIC:
+#if (NDIM == 2)
+            SKEW_SYM_DERIVATIVE_FC(dx,
+                                   side_boxes[axis].lower(0),
+                                   side_boxes[axis].upper(0),
+                                   side_boxes[axis].lower(1),
+                                   side_boxes[axis].upper(1),
+                                   U_adv_data[axis]->getGhostCellWidth()(0),
+                                   U_adv_data[axis]->getGhostCellWidth()(1),
+                                   U_half_data[axis]->getGhostCellWidth()(0),
+                                   U_half_data[axis]->getGhostCellWidth()(1),
+                                   U_adv_data[axis]->getPointer(0),
+                                   U_adv_data[axis]->getPointer(1),
+                                   U_half_data[axis]->getPointer(0),
+                                   U_half_data[axis]->getPointer(1),
+                                   N_data->getGhostCellWidth()(0),
+                                   N_data->getGhostCellWidth()(1),
+                                   N_data->getPointer(axis));
+#endif
+#if (NDIM == 3)
+            SKEW_SYM_DERIVATIVE_FC(dx,
+                                   side_boxes[axis].lower(0),
+                                   side_boxes[axis].upper(0),
+                                   side_boxes[axis].lower(1),
+                                   side_boxes[axis].upper(1),
+                                   side_boxes[axis].lower(2),
+                                   side_boxes[axis].upper(2),
+                                   U_adv_data[axis]->getGhostCellWidth()(0),
+                                   U_adv_data[axis]->getGhostCellWidth()(1),
+                                   U_adv_data[axis]->getGhostCellWidth()(2),
+                                   U_half_data[axis]->getGhostCellWidth()(0),
+                                   U_half_data[axis]->getGhostCellWidth()(1),
+                                   U_half_data[axis]->getGhostCellWidth()(2),
+                                   U_adv_data[axis]->getPointer(0),
+                                   U_adv_data[axis]->getPointer(1),
+                                   U_adv_data[axis]->getPointer(2),
+                                   U_half_data[axis]->getPointer(0),
+                                   U_half_data[axis]->getPointer(1),
+                                   U_half_data[axis]->getPointer(2),
+                                   N_data->getGhostCellWidth()(0),
+                                   N_data->getGhostCellWidth()(1),
+                                   N_data->getGhostCellWidth()(2),
+                                   N_data->getPointer(axis));
+#endif
+            break;
+        default:
+            TBOX_ERROR("INSStaggeredPPMConvectiveOperator::applyConvectiveOperator():\n"
+                       << "  unsupported differencing form: "
+                       << enum_to_string<ConvectiveDifferencingType>(d_difference_form) << " \n"
+                       << "  valid choices are: ADVECTIVE, CONSERVATIVE, "
+                          "SKEW_SYMMETRIC\n");
+        }
+    }
+    return;
+} // computeConvectiveDerivative
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBAMR
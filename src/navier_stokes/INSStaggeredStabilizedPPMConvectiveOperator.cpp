@@ -53,6 +53,7 @@
 #include "tbox/TimerManager.h"
 #include "tbox/Utilities.h"
 
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <ostream>
@@ -506,6 +507,12 @@ INSStaggeredStabilizedPPMConvectiveOperator::INSStaggeredStabilizedPPMConvective
             }
             if (d_width[location_index] > 0.0) d_open_bdry[location_index] = true;
         }
+        if (input_db->keyExists("reuse_scratch_data"))
+        {
+            const bool reuse_scratch_data = input_db->getBool("reuse_scratch_data");
+            d_face_scratch_data_pool.setReuseData(reuse_scratch_data);
+            d_side_scratch_data_pool.setReuseData(reuse_scratch_data);
+        }
     }
 
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
@@ -563,11 +570,13 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
     TBOX_ASSERT(U_idx == d_u_idx);
 #endif
 
-    // Allocate scratch data.
+    // Scratch data are allocated in initializeOperatorState(), but the scratch
+    // index may be shared with another instance of this class that has since
+    // deallocated it.
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->allocatePatchData(d_U_scratch_idx);
+        if (!level->checkAllocated(d_U_scratch_idx)) level->allocatePatchData(d_U_scratch_idx);
     }
 
     // Fill ghost cell values for all components.
@@ -610,8 +619,8 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
             const IntVector<NDIM>& patch_upper = patch_box.upper();
 
             Pointer<SideData<NDIM, double> > N_data = patch->getPatchData(N_idx);
-            Pointer<SideData<NDIM, double> > N_upwind_data =
-                new SideData<NDIM, double>(N_data->getBox(), N_data->getDepth(), N_data->getGhostCellWidth());
+            Pointer<SideData<NDIM, double> > N_upwind_data = d_side_scratch_data_pool.getScratchData(
+                N_data->getBox(), N_data->getDepth(), N_data->getGhostCellWidth(), /*slot*/ 5);
             Pointer<SideData<NDIM, double> > U_data = patch->getPatchData(d_U_scratch_idx);
 
             const IntVector<NDIM> ghosts = IntVector<NDIM>(1);
@@ -622,9 +631,10 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
             for (unsigned int axis = 0; axis < NDIM; ++axis)
             {
                 side_boxes[axis] = SideGeometry<NDIM>::toSideBox(patch_box, axis);
-                U_adv_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
-                U_half_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
-                U_half_upwind_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
+                U_adv_data[axis] = d_face_scratch_data_pool.getScratchData(side_boxes[axis], 1, ghosts, axis);
+                U_half_data[axis] = d_face_scratch_data_pool.getScratchData(side_boxes[axis], 1, ghosts, NDIM + axis);
+                U_half_upwind_data[axis] =
+                    d_face_scratch_data_pool.getScratchData(side_boxes[axis], 1, ghosts, 2 * NDIM + axis);
             }
 
 // Interpolate the staggered-grid velocity field onto the faces of
@@ -714,12 +724,14 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
                     const ArrayData<NDIM, double>& U_array_data = U_data->getArrayData(axis);
                     for (unsigned int d = 0; d < NDIM; ++d)
                     {
-                        for (FaceIterator<NDIM> ic(side_boxes[axis], d); ic; ic++)
+                        // NOTE: The pooled scratch data are defined on boxes that are
+                        // shifted so that their lower corners are at the origin.
+                        for (FaceIterator<NDIM> ic(U_adv_data[axis]->getBox(), d); ic; ic++)
                         {
                             const FaceIndex<NDIM>& i = ic();
                             const double u_ADV = (*U_adv_data[axis])(i);
-                            const double U_lower = U_array_data(i.toCell(0), 0);
-                            const double U_upper = U_array_data(i.toCell(1), 0);
+                            const double U_lower = U_array_data(i.toCell(0) + side_boxes[axis].lower(), 0);
+                            const double U_upper = U_array_data(i.toCell(1) + side_boxes[axis].lower(), 0);
                             (*U_half_upwind_data[axis])(i) =
                                 (u_ADV > 1.0e-8) ? U_lower : (u_ADV < 1.0e-8) ? U_upper : 0.5 * (U_lower + U_upper);
                         }
@@ -879,17 +891,17 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
             // Compute the xsPPM7 discretization.
             for (unsigned int axis = 0; axis < NDIM; ++axis)
             {
-                Pointer<SideData<NDIM, double> > dU_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-                Pointer<SideData<NDIM, double> > U_L_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-                Pointer<SideData<NDIM, double> > U_R_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-                Pointer<SideData<NDIM, double> > U_scratch1_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
+                Pointer<SideData<NDIM, double> > dU_data = d_side_scratch_data_pool.getScratchData(
+                    U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth(), 0);
+                Pointer<SideData<NDIM, double> > U_L_data = d_side_scratch_data_pool.getScratchData(
+                    U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth(), 1);
+                Pointer<SideData<NDIM, double> > U_R_data = d_side_scratch_data_pool.getScratchData(
+                    U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth(), 2);
+                Pointer<SideData<NDIM, double> > U_scratch1_data = d_side_scratch_data_pool.getScratchData(
+                    U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth(), 3);
 #if (NDIM == 3)
-                Pointer<SideData<NDIM, double> > U_scratch2_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
+                Pointer<SideData<NDIM, double> > U_scratch2_data = d_side_scratch_data_pool.getScratchData(
+                    U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth(), 4);
 #endif
 #if (NDIM == 2)
                 GODUNOV_EXTRAPOLATE_FC(side_boxes[axis].lower(0),
@@ -1196,9 +1208,23 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
             }
             if (patch_geom->getTouchesRegularBoundary())
             {
-                Pointer<SideData<NDIM, double> > N_PPM_data =
-                    new SideData<NDIM, double>(N_data->getBox(), N_data->getDepth(), N_data->getGhostCellWidth());
-                N_PPM_data->copy(*N_data);
+                // The pooled data are indexed relative to the lower corner of
+                // the patch, so copy the values one at a time.
+                Pointer<SideData<NDIM, double> > N_PPM_data = d_side_scratch_data_pool.getScratchData(
+                    N_data->getBox(), N_data->getDepth(), N_data->getGhostCellWidth(), /*slot*/ 6);
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(patch_box, d)); b; b++)
+                    {
+                        const hier::Index<NDIM>& i = b();
+                        const SideIndex<NDIM> i_s(i, d, SideIndex<NDIM>::Lower);
+                        const SideIndex<NDIM> i_s_scratch(i - patch_box.lower(), d, SideIndex<NDIM>::Lower);
+                        for (int depth = 0; depth < N_data->getDepth(); ++depth)
+                        {
+                            (*N_PPM_data)(i_s_scratch, depth) = (*N_data)(i_s, depth);
+                        }
+                    }
+                }
                 for (unsigned int location_index = 0; location_index < 2 * NDIM; ++location_index)
                 {
                     const unsigned int axis = location_index / 2;
@@ -1223,12 +1249,14 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
                             {
                                 const hier::Index<NDIM>& i = b();
                                 const SideIndex<NDIM> i_s(i, d, SideIndex<NDIM>::Lower);
+                                const SideIndex<NDIM> i_s_scratch(i - patch_box.lower(), d, SideIndex<NDIM>::Lower);
                                 const double x =
                                     x_lower[axis] + dx[axis] * static_cast<double>(i(axis) - patch_box.lower(axis));
                                 const double x_bdry = (is_lower ? x_lower[axis] : x_upper[axis]);
                                 const double fac = smooth_kernel((x - x_bdry) / width);
-                                (*N_data)(i_s) = fac * (use_upwind_differencing_at_bdry ? (*N_upwind_data)(i_s) : 0.0) +
-                                                 (1.0 - fac) * (*N_PPM_data)(i_s);
+                                const double N_upwind =
+                                    use_upwind_differencing_at_bdry ? (*N_upwind_data)(i_s_scratch) : 0.0;
+                                (*N_data)(i_s) = fac * N_upwind + (1.0 - fac) * (*N_PPM_data)(i_s_scratch);
                             }
                         }
                     }
@@ -1237,13 +1265,6 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
         }
     }
 
-    // Deallocate scratch data.
-    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
-    {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->deallocatePatchData(d_U_scratch_idx);
-    }
-
     IBAMR_TIMER_STOP(t_apply_convective_operator);
     return;
 } // applyConvectiveOperator
@@ -1288,6 +1309,15 @@ INSStaggeredStabilizedPPMConvectiveOperator::initializeOperatorState(const SAMRA
     d_bc_helper = new StaggeredStokesPhysicalBoundaryHelper();
     d_bc_helper->cacheBcCoefData(d_bc_coefs, d_solution_time, d_hierarchy);
 
+    // Allocate scratch data.
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        if (!level->checkAllocated(d_U_scratch_idx)) level->allocatePatchData(d_U_scratch_idx);
+    }
+    d_face_scratch_data_pool.clear();
+    d_side_scratch_data_pool.clear();
+
     d_is_initialized = true;
 
     IBAMR_TIMER_STOP(t_initialize_operator_state);
@@ -1305,6 +1335,16 @@ INSStaggeredStabilizedPPMConvectiveOperator::deallocateOperatorState()
     d_hier_bdry_fill.setNull();
     d_bc_helper.setNull();
 
+    // Deallocate scratch data.
+    const int finest_ln = std::min(d_finest_ln, d_hierarchy->getFinestLevelNumber());
+    for (int ln = d_coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        if (level->checkAllocated(d_U_scratch_idx)) level->deallocatePatchData(d_U_scratch_idx);
+    }
+    d_face_scratch_data_pool.clear();
+    d_side_scratch_data_pool.clear();
+
     d_is_initialized = false;
 
     IBAMR_TIMER_STOP(t_deallocate_operator_state);
@@ -43,6 +43,7 @@
 #include "tbox/Pointer.h"
 #include "tbox/Utilities.h"
 
+#include <algorithm>
 #include <array>
 #include <utility>
 
@@ -193,6 +194,11 @@ INSStaggeredWavePropConvectiveOperator::INSStaggeredWavePropConvectiveOperator(
     if (input_db)
     {
         if (input_db->keyExists("bdry_extrap_type")) d_bdry_extrap_type = input_db->getString("bdry_extrap_type");
+        if (input_db->keyExists("reuse_scratch_data"))
+        {
+            const bool reuse_scratch_data = input_db->getBool("reuse_scratch_data");
+            d_face_scratch_data_pool.setReuseData(reuse_scratch_data);
+        }
     }
 
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
@@ -235,11 +241,13 @@ INSStaggeredWavePropConvectiveOperator::applyConvectiveOperator(const int U_idx,
     TBOX_ASSERT(U_idx == d_u_idx);
 #endif
 
-    // Allocate scratch data.
+    // Scratch data are allocated in initializeOperatorState(), but the scratch
+    // index may be shared with another instance of this class that has since
+    // deallocated it.
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->allocatePatchData(d_U_scratch_idx);
+        if (!level->checkAllocated(d_U_scratch_idx)) level->allocatePatchData(d_U_scratch_idx);
     }
 
     // Fill ghost cell values for all components.
@@ -287,7 +295,8 @@ INSStaggeredWavePropConvectiveOperator::applyConvectiveOperator(const int U_idx,
             for (unsigned int axis = 0; axis < NDIM; ++axis)
             {
                 side_boxes[axis] = SideGeometry<NDIM>::toSideBox(patch_box, axis);
-                U_adv_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, IntVector<NDIM>(1));
+                U_adv_data[axis] =
+                    d_face_scratch_data_pool.getScratchData(side_boxes[axis], 1, IntVector<NDIM>(1), axis);
             }
 #if (NDIM == 2)
             navier_stokes_interp_comps2d_(patch_lower(0),
@@ -407,13 +416,6 @@ INSStaggeredWavePropConvectiveOperator::applyConvectiveOperator(const int U_idx,
         }
     }
 
-    // Deallocate scratch data.
-    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
-    {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->deallocatePatchData(d_U_scratch_idx);
-    }
-
     return;
 } // applyConvectiveOperator
 
@@ -455,6 +457,14 @@ INSStaggeredWavePropConvectiveOperator::initializeOperatorState(const SAMRAIVect
     d_bc_helper = new StaggeredStokesPhysicalBoundaryHelper();
     d_bc_helper->cacheBcCoefData(d_bc_coefs, d_solution_time, d_hierarchy);
 
+    // Allocate scratch data.
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        if (!level->checkAllocated(d_U_scratch_idx)) level->allocatePatchData(d_U_scratch_idx);
+    }
+    d_face_scratch_data_pool.clear();
+
     d_is_initialized = true;
 
     return;
@@ -469,6 +479,15 @@ INSStaggeredWavePropConvectiveOperator::deallocateOperatorState()
     d_hier_bdry_fill.setNull();
     d_bc_helper.setNull();
 
+    // Deallocate scratch data.
+    const int finest_ln = std::min(d_finest_ln, d_hierarchy->getFinestLevelNumber());
+    for (int ln = d_coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        if (level->checkAllocated(d_U_scratch_idx)) level->deallocatePatchData(d_U_scratch_idx);
+    }
+    d_face_scratch_data_pool.clear();
+
     d_is_initialized = false;
 
     return;
@@ -774,7 +774,9 @@ INSVCStaggeredConservativeHierarchyIntegrator::integrateHierarchy(const double c
     }
 
     // Solve for u(n+1), p(n+1/2).
+    startTelemetryPhase("stokes_solve");
     d_stokes_solver->solveSystem(*d_sol_vec, *d_rhs_vec);
+    stopTelemetryPhase("stokes_solve");
 
     // Unscale rhs if necessary
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
@@ -791,6 +793,7 @@ INSVCStaggeredConservativeHierarchyIntegrator::integrateHierarchy(const double c
         d_hier_sc_data_ops->resetLevels(coarsest_ln, finest_ln);
     }
 
+    recordTelemetryValue("stokes_solver_iterations", d_stokes_solver->getNumIterations());
     if (d_enable_logging && d_enable_logging_solver_iterations)
         plog << d_object_name
              << "::integrateHierarchy(): stokes solve number of iterations = " << d_stokes_solver->getNumIterations()
@@ -947,6 +950,16 @@ INSVCStaggeredConservativeHierarchyIntegrator::getConvectiveOperator()
 
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
+double
+INSVCStaggeredConservativeHierarchyIntegrator::getMaximumTimeStepSizeSpecialized()
+{
+    // In addition to the CFL restriction, respect the time step size that is
+    // allowed by the estimated error of the most recent density update.
+    double dt = INSVCStaggeredHierarchyIntegrator::getMaximumTimeStepSizeSpecialized();
+    dt = std::min(dt, d_rho_p_integrator->getMaximumTimeStepSize());
+    return dt;
+} // getMaximumTimeStepSizeSpecialized
+
 void
 INSVCStaggeredConservativeHierarchyIntegrator::initializeLevelDataSpecialized(
     const Pointer<BasePatchHierarchy<NDIM> > base_hierarchy,
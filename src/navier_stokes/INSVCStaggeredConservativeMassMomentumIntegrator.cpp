@@ -46,7 +46,9 @@
 #include "tbox/TimerManager.h"
 #include "tbox/Utilities.h"
 
+#include <algorithm>
 #include <array>
+#include <cmath>
 #include <limits>
 #include <ostream>
 #include <string>
@@ -995,6 +997,14 @@ INSVCStaggeredConservativeMassMomentumIntegrator::INSVCStaggeredConservativeMass
             d_density_time_stepping_type =
                 IBAMR::string_to_enum<TimeSteppingType>(input_db->getString("density_time_stepping_type"));
         }
+        if (input_db->keyExists("density_error_tolerance"))
+        {
+            d_density_error_tol = input_db->getDouble("density_error_tolerance");
+        }
+        if (input_db->keyExists("density_error_safety_factor"))
+        {
+            d_density_error_safety_factor = input_db->getDouble("density_error_safety_factor");
+        }
         if (input_db->keyExists("enable_logging"))
         {
             d_enable_logging = input_db->getBool("enable_logging");
@@ -1073,6 +1083,15 @@ INSVCStaggeredConservativeMassMomentumIntegrator::INSVCStaggeredConservativeMass
             << "  valid choices are: FORWARD_EULER, SSPRK2, SSPRK3\n");
     }
 
+    if (d_density_error_tol > 0.0 && d_density_time_stepping_type == FORWARD_EULER)
+    {
+        TBOX_ERROR(
+            "INSVCStaggeredConservativeMassMomentumIntegrator::"
+            "INSVCStaggeredConservativeMassMomentumIntegrator():\n"
+            << "  density error estimation requires an embedded lower-order solution\n"
+            << "  valid density time stepping types are: SSPRK2, SSPRK3\n");
+    }
+
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
     Pointer<VariableContext> context = var_db->getContext("INSVCStaggeredConservativeMassMomentumIntegrator::CONTEXT");
 
@@ -1105,6 +1124,8 @@ INSVCStaggeredConservativeMassMomentumIntegrator::INSVCStaggeredConservativeMass
             var_db->mapVariableAndContextToIndex(d_rho_sc_var, var_db->getContext(rho_sc_name + "::SCRATCH"));
         d_rho_sc_new_idx =
             var_db->mapVariableAndContextToIndex(d_rho_sc_var, var_db->getContext(rho_sc_name + "::NEW"));
+        d_rho_sc_embedded_idx =
+            var_db->mapVariableAndContextToIndex(d_rho_sc_var, var_db->getContext(rho_sc_name + "::EMBEDDED"));
     }
     else
     {
@@ -1113,10 +1134,13 @@ INSVCStaggeredConservativeMassMomentumIntegrator::INSVCStaggeredConservativeMass
             d_rho_sc_var, var_db->getContext(rho_sc_name + "::SCRATCH"), IntVector<NDIM>(d_density_limiter_gcw));
         d_rho_sc_new_idx = var_db->registerVariableAndContext(
             d_rho_sc_var, var_db->getContext(rho_sc_name + "::NEW"), IntVector<NDIM>(NOGHOSTS));
+        d_rho_sc_embedded_idx = var_db->registerVariableAndContext(
+            d_rho_sc_var, var_db->getContext(rho_sc_name + "::EMBEDDED"), IntVector<NDIM>(NOGHOSTS));
     }
 #if !defined(NDEBUG)
     TBOX_ASSERT(d_rho_sc_scratch_idx >= 0);
     TBOX_ASSERT(d_rho_sc_new_idx >= 0);
+    TBOX_ASSERT(d_rho_sc_embedded_idx >= 0);
 #endif
 
     const std::string S_var_name = "INSVCStaggeredConservativeMassMomentumIntegrator::S";
@@ -1483,8 +1507,20 @@ INSVCStaggeredConservativeMassMomentumIntegrator::integrate(double dt)
                                      dx);
             }
         }
+
+        // Store the penultimate stage, from which the embedded lower-order
+        // solution is obtained.
+        if (d_density_error_tol > 0.0 && step == d_num_steps - 2)
+        {
+            d_hier_sc_data_ops->copyData(d_rho_sc_embedded_idx,
+                                         d_rho_sc_new_idx,
+                                         /*interior_only*/ true);
+        }
     }
 
+    // Estimate the local error of the density update.
+    if (d_density_error_tol > 0.0) estimateDensityError(dt, wgt_sc_idx);
+
     // Refill boundary values of newest density
     const double new_time = d_current_time + dt;
     std::vector<InterpolationTransactionComponent> new_transaction_comps(1);
@@ -1593,6 +1629,10 @@ INSVCStaggeredConservativeMassMomentumIntegrator::initializeTimeIntegrator(
         if (!level->checkAllocated(d_rho_sc_scratch_idx)) level->allocatePatchData(d_rho_sc_scratch_idx);
         if (!level->checkAllocated(d_rho_sc_new_idx)) level->allocatePatchData(d_rho_sc_new_idx);
         if (!level->checkAllocated(d_S_scratch_idx)) level->allocatePatchData(d_S_scratch_idx);
+        if (d_density_error_tol > 0.0 && !level->checkAllocated(d_rho_sc_embedded_idx))
+        {
+            level->allocatePatchData(d_rho_sc_embedded_idx);
+        }
     }
 
     if (!d_hier_math_ops_external)
@@ -1636,6 +1676,7 @@ INSVCStaggeredConservativeMassMomentumIntegrator::deallocateTimeIntegrator()
         if (level->checkAllocated(d_rho_sc_scratch_idx)) level->deallocatePatchData(d_rho_sc_scratch_idx);
         if (level->checkAllocated(d_rho_sc_new_idx)) level->deallocatePatchData(d_rho_sc_new_idx);
         if (level->checkAllocated(d_S_scratch_idx)) level->deallocatePatchData(d_S_scratch_idx);
+        if (level->checkAllocated(d_rho_sc_embedded_idx)) level->deallocatePatchData(d_rho_sc_embedded_idx);
     }
 
     // Deallocate coarse-fine boundary object.
@@ -1699,6 +1740,12 @@ INSVCStaggeredConservativeMassMomentumIntegrator::getUpdatedSideCenteredDensityP
     return d_rho_sc_new_idx;
 } // getUpdatedSideCenteredDensityPatchDataIndex
 
+double
+INSVCStaggeredConservativeMassMomentumIntegrator::getMaximumTimeStepSize() const
+{
+    return d_max_error_dt;
+} // getMaximumTimeStepSize
+
 void
 INSVCStaggeredConservativeMassMomentumIntegrator::setMassDensitySourceTerm(const Pointer<CartGridFunction> S_fcn)
 {
@@ -2629,6 +2676,58 @@ INSVCStaggeredConservativeMassMomentumIntegrator::computeDensityUpdate(
     }
 } // computeDensityUpdate
 
+void
+INSVCStaggeredConservativeMassMomentumIntegrator::estimateDensityError(const double dt, const int wgt_sc_idx)
+{
+    // The embedded solution of the SSPRK(3,2) pair is the SSPRK2 solution
+    // 2*rho^(2) - rho^n, in which rho^(2) is the second SSPRK3 stage. The
+    // embedded solution of the SSPRK(2,1) pair is the forward Euler solution,
+    // i.e., the first SSPRK2 stage.
+    if (d_density_time_stepping_type == SSPRK3)
+    {
+        d_hier_sc_data_ops->linearSum(d_rho_sc_embedded_idx,
+                                      2.0,
+                                      d_rho_sc_embedded_idx,
+                                      -1.0,
+                                      d_rho_sc_current_idx,
+                                      /*interior_only*/ true);
+    }
+    d_hier_sc_data_ops->subtract(d_rho_sc_embedded_idx,
+                                 d_rho_sc_new_idx,
+                                 d_rho_sc_embedded_idx,
+                                 /*interior_only*/ true);
+    const double err_norm = d_hier_sc_data_ops->maxNorm(d_rho_sc_embedded_idx, wgt_sc_idx);
+    const double rho_norm = d_hier_sc_data_ops->maxNorm(d_rho_sc_new_idx, wgt_sc_idx);
+    const double rel_err = err_norm / std::max(rho_norm, std::numeric_limits<double>::epsilon());
+
+    // The local error of the embedded solution scales like dt^(p+1), in which
+    // p is the order of the embedded method.
+    const double embedded_order = (d_density_time_stepping_type == SSPRK3 ? 2.0 : 1.0);
+    if (rel_err > 0.0)
+    {
+        d_max_error_dt =
+            d_density_error_safety_factor * dt * std::pow(d_density_error_tol / rel_err, 1.0 / (embedded_order + 1.0));
+    }
+    else
+    {
+        d_max_error_dt = std::numeric_limits<double>::max();
+    }
+
+    if (d_enable_logging)
+    {
+        plog << "INSVCStaggeredConservativeMassMomentumIntegrator::integrate(): "
+                "estimated relative density error = "
+             << rel_err << ", maximum time step size = " << d_max_error_dt << "\n";
+        // The estimate only limits the following time steps.
+        if (rel_err > d_density_error_tol)
+        {
+            plog << "INSVCStaggeredConservativeMassMomentumIntegrator::integrate(): "
+                    "estimated error exceeds density_error_tolerance; the step is accepted without being repeated\n";
+        }
+    }
+    return;
+} // estimateDensityError
+
 void
 INSVCStaggeredConservativeMassMomentumIntegrator::enforceDivergenceFreeConditionAtCoarseFineInterface(int U_idx)
 {
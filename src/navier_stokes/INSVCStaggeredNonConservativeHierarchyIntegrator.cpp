@@ -793,7 +793,9 @@ INSVCStaggeredNonConservativeHierarchyIntegrator::integrateHierarchy(const doubl
     }
 
     // Solve for u(n+1), p(n+1/2).
+    startTelemetryPhase("stokes_solve");
     d_stokes_solver->solveSystem(*d_sol_vec, *d_rhs_vec);
+    stopTelemetryPhase("stokes_solve");
 
     // Unscale rhs if necessary
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
@@ -810,6 +812,7 @@ INSVCStaggeredNonConservativeHierarchyIntegrator::integrateHierarchy(const doubl
         d_hier_sc_data_ops->resetLevels(coarsest_ln, finest_ln);
     }
 
+    recordTelemetryValue("stokes_solver_iterations", d_stokes_solver->getNumIterations());
     if (d_enable_logging && d_enable_logging_solver_iterations)
         plog << d_object_name
              << "::integrateHierarchy(): stokes solve number of iterations = " << d_stokes_solver->getNumIterations()
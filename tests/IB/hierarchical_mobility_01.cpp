@@ -0,0 +1,187 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2019 - 2019 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+
+// Headers for major SAMRAI objects
+#include <tbox/MemoryDatabase.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/HierarchicalMobilityOperator.h>
+#include <ibamr/MobilityFunctions.h>
+
+#include <ibtk/AppInitializer.h>
+
+#include <cmath>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// A test program to check that HierarchicalMobilityOperator::apply() agrees
+// with the product of the dense RPY mobility matrix that is used by CIBMethod
+// and DirectMobilitySolver, and that its preconditioner inverts the mobility
+// matrix when the cluster tree has a single leaf and improves with additional
+// block Jacobi iterations otherwise.
+
+namespace
+{
+// Compute the relative difference between two vectors in the Euclidean norm.
+double
+relative_error(const std::vector<double>& u, const std::vector<double>& u_ref)
+{
+    double err_sq = 0.0, norm_sq = 0.0;
+    for (unsigned int k = 0; k < u.size(); ++k)
+    {
+        err_sq += (u[k] - u_ref[k]) * (u[k] - u_ref[k]);
+        norm_sq += u_ref[k] * u_ref[k];
+    }
+    return std::sqrt(err_sq / norm_sq);
+} // relative_error
+
+// Create a hierarchical mobility operator with the specified parameters.
+Pointer<HierarchicalMobilityOperator>
+make_operator(const double opening_angle, const int leaf_size, const int num_pc_iterations)
+{
+    Pointer<Database> db = new MemoryDatabase("HierarchicalMobilityOperator");
+    db->putDouble("opening_angle", opening_angle);
+    db->putInteger("leaf_size", leaf_size);
+    db->putInteger("num_pc_iterations", num_pc_iterations);
+    return new HierarchicalMobilityOperator("HierarchicalMobilityOperator", db);
+} // make_operator
+} // namespace
+
+/*******************************************************************************
+ * For each run, the input filename must be given on the command line.  In all *
+ * cases, the command line is:                                                 *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "hierarchical_mobility.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        const std::string kernel_name = input_db->getString("IB_DELTA_FUNCTION");
+        const int num_structures = input_db->getInteger("NUM_STRUCTURES");
+        const int num_nodes_per_structure = input_db->getInteger("NUM_NODES_PER_STRUCTURE");
+        const double spacing = input_db->getDouble("SPACING");
+        const double dx = input_db->getDouble("DX");
+        const double mu = input_db->getDouble("MU");
+        const double opening_angle = input_db->getDouble("OPENING_ANGLE");
+        const double tol = input_db->getDouble("TOL");
+        const unsigned int seed = static_cast<unsigned int>(input_db->getInteger("SEED"));
+
+        // Place the markers of each structure randomly in a ball of unit
+        // diameter, with the structures aligned along the x axis, and generate
+        // random forces.
+        const int num_nodes = num_structures * num_nodes_per_structure;
+        const int size = NDIM * num_nodes;
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<double> dist(-0.5, 0.5);
+        std::vector<double> X(size), F(size);
+        for (int k = 0; k < num_nodes; ++k)
+        {
+            double r_sq;
+            do
+            {
+                r_sq = 0.0;
+                for (int d = 0; d < NDIM; ++d)
+                {
+                    X[NDIM * k + d] = dist(rng);
+                    r_sq += X[NDIM * k + d] * X[NDIM * k + d];
+                }
+            } while (r_sq > 0.25);
+            X[NDIM * k] += spacing * static_cast<double>(k / num_nodes_per_structure);
+            for (int d = 0; d < NDIM; ++d) F[NDIM * k + d] = dist(rng);
+        }
+
+        // Compute the reference velocities with the dense mobility matrix,
+        // which is stored in column-major order.
+        std::vector<double> M(static_cast<std::size_t>(size) * size);
+        MobilityFunctions::constructRPYMobilityMatrix(kernel_name.c_str(), mu, dx, X.data(), num_nodes, 0.0, M.data());
+        std::vector<double> U_ref(size, 0.0);
+        for (int col = 0; col < size; ++col)
+        {
+            for (int row = 0; row < size; ++row) U_ref[row] += M[static_cast<std::size_t>(col) * size + row] * F[col];
+        }
+
+        // Without far-field approximations, the treecode reproduces the dense
+        // product up to roundoff.
+        std::vector<double> U(size);
+        Pointer<HierarchicalMobilityOperator> exact_op = make_operator(0.0, 8, 1);
+        exact_op->initializeOperatorState(kernel_name.c_str(), mu, dx, X.data(), num_nodes);
+        exact_op->apply(F.data(), U.data());
+        const double exact_err = relative_error(U, U_ref);
+
+        // With far-field approximations, the relative error is controlled by the
+        // opening angle.
+        Pointer<HierarchicalMobilityOperator> approx_op = make_operator(opening_angle, 8, 1);
+        approx_op->initializeOperatorState(kernel_name.c_str(), mu, dx, X.data(), num_nodes);
+        approx_op->apply(F.data(), U.data());
+        const double approx_err = relative_error(U, U_ref);
+
+        // With a single leaf, the preconditioner is the exact inverse.
+        std::vector<double> F_pc(U_ref);
+        Pointer<HierarchicalMobilityOperator> single_leaf_op = make_operator(opening_angle, num_nodes, 1);
+        single_leaf_op->initializeOperatorState(kernel_name.c_str(), mu, dx, X.data(), num_nodes);
+        single_leaf_op->applyPreconditioner(F_pc.data(), F_pc.data());
+        const double single_leaf_err = relative_error(F_pc, F);
+
+        // With one leaf per structure (the number of structures is a power of
+        // two, so that the bisection separates them), additional block Jacobi
+        // iterations account for the interactions between the structures.
+        Pointer<HierarchicalMobilityOperator> block_op = make_operator(opening_angle, num_nodes_per_structure, 1);
+        block_op->initializeOperatorState(kernel_name.c_str(), mu, dx, X.data(), num_nodes);
+        block_op->applyPreconditioner(U_ref.data(), F_pc.data());
+        const double block_err = relative_error(F_pc, F);
+        Pointer<HierarchicalMobilityOperator> block_it_op = make_operator(opening_angle, num_nodes_per_structure, 3);
+        block_it_op->initializeOperatorState(kernel_name.c_str(), mu, dx, X.data(), num_nodes);
+        block_it_op->applyPreconditioner(U_ref.data(), F_pc.data());
+        const double block_it_err = relative_error(F_pc, F);
+
+        if (SAMRAI_MPI::getRank() == 0)
+        {
+            std::ofstream out("output");
+            out << "apply() without approximation:        " << (exact_err < 1.0e-12 ? "OK" : "FAILED") << "\n";
+            out << "apply() with approximation:           " << (approx_err < tol ? "OK" : "FAILED") << "\n";
+            out << "single leaf preconditioner:           " << (single_leaf_err < 1.0e-10 ? "OK" : "FAILED") << "\n";
+            out << "block Jacobi iterations reduce error: " << (block_it_err < 0.5 * block_err ? "OK" : "FAILED")
+                << "\n";
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+} // main
@@ -0,0 +1,354 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2019 - 2019 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+#include <petscvec.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBMethod.h>
+#include <ibamr/IBRedundantInitializer.h>
+#include <ibamr/IBStandardForceGen.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/LData.h>
+#include <ibtk/LDataManager.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <map>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Test that IBStandardForceGen, which computes the forces of the springs and
+// beams that involve only local nodes and the target point forces while the
+// positions of the ghost nodes are being communicated, computes the same forces
+// up to roundoff as a direct evaluation of all spring, beam, and target point
+// forces from the positions of all nodes.  The structure is a closed curve with
+// springs and beams between neighboring nodes and a target point at each node.
+
+namespace
+{
+int finest_ln;
+int num_nodes;
+double radius;
+double spring_stiffness, spring_rest_length;
+double beam_rigidity;
+double target_stiffness, target_damping;
+
+// The initial position of the specified node, which is also the target
+// position of the node.
+IBTK::Point
+initial_position(const int k)
+{
+    const double theta = 2.0 * M_PI * static_cast<double>(k) / static_cast<double>(num_nodes);
+    IBTK::Point X = IBTK::Point::Constant(0.5);
+    X(0) += radius * std::cos(theta);
+    X(1) += radius * std::sin(theta);
+    return X;
+} // initial_position
+
+void
+generate_structure(const unsigned int& /*strct_num*/,
+                   const int& ln,
+                   int& num_vertices,
+                   std::vector<IBTK::Point>& vertex_posn)
+{
+    num_vertices = (ln == finest_ln) ? num_nodes : 0;
+    vertex_posn.resize(num_vertices);
+    for (int k = 0; k < num_vertices; ++k) vertex_posn[k] = initial_position(k);
+    return;
+} // generate_structure
+
+void
+generate_springs(
+    const unsigned int& /*strct_num*/,
+    const int& ln,
+    std::multimap<int, IBRedundantInitializer::Edge>& spring_map,
+    std::map<IBRedundantInitializer::Edge, IBRedundantInitializer::SpringSpec, IBRedundantInitializer::EdgeComp>&
+        spring_spec)
+{
+    if (ln != finest_ln) return;
+    for (int k = 0; k < num_nodes; ++k)
+    {
+        IBRedundantInitializer::Edge e;
+        e.first = k;
+        e.second = (k + 1) % num_nodes;
+        if (e.first > e.second) std::swap(e.first, e.second);
+        spring_map.insert(std::make_pair(e.first, e));
+        IBRedundantInitializer::SpringSpec spec_data;
+        spec_data.parameters = { spring_stiffness, spring_rest_length };
+        spec_data.force_fcn_idx = 0;
+        spring_spec.insert(std::make_pair(e, spec_data));
+    }
+    return;
+} // generate_springs
+
+void
+generate_beams(const unsigned int& /*strct_num*/,
+               const int& ln,
+               std::multimap<int, IBRedundantInitializer::BeamSpec>& beam_spec)
+{
+    if (ln != finest_ln) return;
+    for (int k = 0; k < num_nodes; ++k)
+    {
+        IBRedundantInitializer::BeamSpec spec_data;
+        spec_data.neighbor_idxs = std::make_pair((k + num_nodes - 1) % num_nodes, (k + 1) % num_nodes);
+        spec_data.bend_rigidity = beam_rigidity;
+        spec_data.curvature = IBTK::Vector::Zero();
+        beam_spec.insert(std::make_pair(k, spec_data));
+    }
+    return;
+} // generate_beams
+
+void
+generate_targets(const unsigned int& /*strct_num*/,
+                 const int& ln,
+                 std::multimap<int, IBRedundantInitializer::TargetSpec>& tg_pt_spec)
+{
+    if (ln != finest_ln) return;
+    for (int k = 0; k < num_nodes; ++k)
+    {
+        IBRedundantInitializer::TargetSpec spec_data;
+        spec_data.stiffness = target_stiffness;
+        spec_data.damping = target_damping;
+        tg_pt_spec.insert(std::make_pair(k, spec_data));
+    }
+    return;
+} // generate_targets
+
+// Gather the values of the Lagrangian data on every process in the order of
+// the Lagrangian indices.
+std::vector<double>
+gather_lagrangian_data(Pointer<LData> data, const int ln, LDataManager* const l_data_manager)
+{
+    int ierr;
+    Vec lagrangian_vec, sequential_vec = nullptr;
+    ierr = VecDuplicate(data->getVec(), &lagrangian_vec);
+    IBTK_CHKERRQ(ierr);
+    Vec petsc_vec = data->getVec();
+    l_data_manager->scatterPETScToLagrangian(petsc_vec, lagrangian_vec, ln);
+    l_data_manager->scatterToAll(lagrangian_vec, sequential_vec);
+    int size;
+    ierr = VecGetSize(sequential_vec, &size);
+    IBTK_CHKERRQ(ierr);
+    const double* values;
+    ierr = VecGetArrayRead(sequential_vec, &values);
+    IBTK_CHKERRQ(ierr);
+    std::vector<double> gathered_values(values, values + size);
+    ierr = VecRestoreArrayRead(sequential_vec, &values);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecDestroy(&sequential_vec);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecDestroy(&lagrangian_vec);
+    IBTK_CHKERRQ(ierr);
+    return gathered_values;
+} // gather_lagrangian_data
+
+// Compute the spring, beam, and target point forces of all nodes in a single
+// pass over the positions and velocities of all nodes.
+std::vector<double>
+compute_reference_force(const std::vector<double>& X, const std::vector<double>& U)
+{
+    std::vector<double> F(NDIM * num_nodes, 0.0);
+    for (int k = 0; k < num_nodes; ++k)
+    {
+        const int next = (k + 1) % num_nodes;
+        const int prev = (k + num_nodes - 1) % num_nodes;
+
+        // Spring between node k and node k + 1.
+        double D[NDIM], R_sq = 0.0;
+        for (int d = 0; d < NDIM; ++d)
+        {
+            D[d] = X[NDIM * next + d] - X[NDIM * k + d];
+            R_sq += D[d] * D[d];
+        }
+        const double R = std::sqrt(R_sq);
+        const double T_over_R = spring_stiffness * (R - spring_rest_length) / R;
+        for (int d = 0; d < NDIM; ++d)
+        {
+            F[NDIM * k + d] += T_over_R * D[d];
+            F[NDIM * next + d] -= T_over_R * D[d];
+        }
+
+        // Beam centered at node k.
+        for (int d = 0; d < NDIM; ++d)
+        {
+            const double F_beam = beam_rigidity * (X[NDIM * next + d] + X[NDIM * prev + d] - 2.0 * X[NDIM * k + d]);
+            F[NDIM * k + d] += 2.0 * F_beam;
+            F[NDIM * next + d] -= F_beam;
+            F[NDIM * prev + d] -= F_beam;
+        }
+
+        // Target point at node k.
+        const IBTK::Point X_target = initial_position(k);
+        for (int d = 0; d < NDIM; ++d)
+        {
+            F[NDIM * k + d] += target_stiffness * (X_target(d) - X[NDIM * k + d]) - target_damping * U[NDIM * k + d];
+        }
+    }
+    return F;
+} // compute_reference_force
+} // namespace
+
+/*******************************************************************************
+ * For each run, the input filename must be given on the command line.  In all *
+ * cases, the command line is:                                                 *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        // prevent a warning about timer initializations
+        TimerManager::createManager(nullptr);
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<IBMethod> ib_method_ops = new IBMethod("IBMethod", app_initializer->getComponentDatabase("IBMethod"));
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator",
+                                              app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                              ib_method_ops,
+                                              navier_stokes_integrator);
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Configure the IB solver.
+        Pointer<IBRedundantInitializer> ib_initializer = new IBRedundantInitializer(
+            "IBRedundantInitializer", app_initializer->getComponentDatabase("IBRedundantInitializer"));
+        finest_ln = input_db->getInteger("MAX_LEVELS") - 1;
+        num_nodes = input_db->getInteger("NUM_NODES");
+        radius = input_db->getDouble("RADIUS");
+        spring_stiffness = input_db->getDouble("SPRING_STIFFNESS");
+        spring_rest_length = input_db->getDouble("SPRING_REST_LENGTH");
+        beam_rigidity = input_db->getDouble("BEAM_RIGIDITY");
+        target_stiffness = input_db->getDouble("TARGET_STIFFNESS");
+        target_damping = input_db->getDouble("TARGET_DAMPING");
+        ib_initializer->setStructureNamesOnLevel(finest_ln, { "curve" });
+        ib_initializer->registerInitStructureFunction(generate_structure);
+        ib_initializer->registerInitSpringDataFunction(generate_springs);
+        ib_initializer->registerInitBeamDataFunction(generate_beams);
+        ib_initializer->registerInitTargetPtFunction(generate_targets);
+        ib_method_ops->registerLInitStrategy(ib_initializer);
+        Pointer<IBStandardForceGen> ib_force_fcn = new IBStandardForceGen();
+        ib_method_ops->registerIBLagrangianForceFunction(ib_force_fcn);
+
+        // Initialize hierarchy configuration and data on all patches.
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+        // Deallocate initialization objects.
+        ib_method_ops->freeLInitStrategy();
+        ib_initializer.setNull();
+
+        // Displace the nodes from their target positions and prescribe a
+        // rotational velocity, so that all force terms are nonzero.
+        LDataManager* const l_data_manager = ib_method_ops->getLDataManager();
+        const double displacement = input_db->getDouble("DISPLACEMENT");
+        Pointer<LData> X_data = l_data_manager->getLData(LDataManager::POSN_DATA_NAME, finest_ln);
+        Pointer<LData> U_data = l_data_manager->getLData(LDataManager::VEL_DATA_NAME, finest_ln);
+        {
+            double* const X_node = X_data->getLocalFormVecArray()->data();
+            double* const U_node = U_data->getLocalFormVecArray()->data();
+            for (unsigned int k = 0; k < X_data->getLocalNodeCount(); ++k)
+            {
+                double* const X = &X_node[NDIM * k];
+                double* const U = &U_node[NDIM * k];
+                const double X0 = X[0];
+                X[0] += displacement * std::sin(6.0 * M_PI * X[1]);
+                X[1] += displacement * std::cos(10.0 * M_PI * X0);
+                U[0] = -(X[1] - 0.5);
+                U[1] = X[0] - 0.5;
+            }
+            X_data->restoreArrays();
+            U_data->restoreArrays();
+        }
+
+        // Compute the forces with IBStandardForceGen.
+        ib_force_fcn->initializeLevelData(patch_hierarchy, finest_ln, 0.0, true, l_data_manager);
+        Pointer<LData> F_data = l_data_manager->createLData("F_split", finest_ln, NDIM);
+        int ierr = VecSet(F_data->getVec(), 0.0);
+        IBTK_CHKERRQ(ierr);
+        ib_force_fcn->computeLagrangianForce(F_data, X_data, U_data, patch_hierarchy, finest_ln, 0.0, l_data_manager);
+
+        // Compare the forces with the forces computed from the positions and
+        // velocities of all nodes.
+        const std::vector<double> X_all = gather_lagrangian_data(X_data, finest_ln, l_data_manager);
+        const std::vector<double> U_all = gather_lagrangian_data(U_data, finest_ln, l_data_manager);
+        const std::vector<double> F_all = gather_lagrangian_data(F_data, finest_ln, l_data_manager);
+        const std::vector<double> F_ref = compute_reference_force(X_all, U_all);
+        double max_err = 0.0, max_force = 0.0;
+        for (unsigned int i = 0; i < F_ref.size(); ++i)
+        {
+            max_err = std::max(max_err, std::abs(F_all[i] - F_ref[i]));
+            max_force = std::max(max_force, std::abs(F_ref[i]));
+        }
+
+        if (SAMRAI_MPI::getRank() == 0)
+        {
+            std::ofstream out("output");
+            out << "split forces agree with unsplit forces: " << (max_err < 1.0e-12 * max_force ? "OK" : "FAILED")
+                << "\n";
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+} // main
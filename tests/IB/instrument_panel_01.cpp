@@ -0,0 +1,364 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2019 - 2019 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CartesianPatchGeometry.h>
+#include <CellData.h>
+#include <CellVariable.h>
+#include <LoadBalancer.h>
+#include <SideData.h>
+#include <SideGeometry.h>
+#include <SideVariable.h>
+#include <StandardTagAndInitialize.h>
+#include <VariableDatabase.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBInstrumentPanel.h>
+#include <ibamr/IBMethod.h>
+#include <ibamr/IBRedundantInitializer.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/LData.h>
+#include <ibtk/LDataManager.h>
+
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Test that IBInstrumentPanel::readInstrumentData() computes the flow rates and
+// the mean and pointwise pressures of flow meters whose webs span many patches
+// on two levels of a locally refined grid, and many processes when run in
+// parallel.  The meters are regular polygons with an even number of perimeter
+// nodes, and the velocity and pressure are linear functions of position, so the
+// flow rate through each meter is (u(X_c) - U_meter) . n A and both pressures
+// are p(X_c), in which X_c is the centroid, n is the unit normal, and A is the
+// area of the polygon.  These values are exact up to roundoff only if every web
+// patch is counted exactly once.
+
+namespace
+{
+int finest_ln;
+int num_perimeter_nodes;
+
+struct MeterSpec
+{
+    std::string name;
+    IBTK::Point X_centroid;
+    IBTK::Vector e0, e1;
+    double radius;
+};
+
+std::vector<MeterSpec> meters;
+
+// The velocity of the meter perimeter nodes.
+const IBTK::Vector U_meter(0.1, -0.2, 0.3);
+
+// Set up one meter normal to each of the z and x axes and one tilted meter.
+// The perimeter of each meter is oriented counterclockwise about e0 x e1.
+void
+setup_meters()
+{
+    meters.resize(3);
+    meters[0].name = "meter_z";
+    meters[0].X_centroid = IBTK::Point(0.5, 0.5, 0.4);
+    meters[0].e0 = IBTK::Vector(1.0, 0.0, 0.0);
+    meters[0].e1 = IBTK::Vector(0.0, 1.0, 0.0);
+    meters[0].radius = 0.3;
+
+    meters[1].name = "meter_x";
+    meters[1].X_centroid = IBTK::Point(0.55, 0.5, 0.5);
+    meters[1].e0 = IBTK::Vector(0.0, 1.0, 0.0);
+    meters[1].e1 = IBTK::Vector(0.0, 0.0, 1.0);
+    meters[1].radius = 0.25;
+
+    meters[2].name = "meter_tilted";
+    meters[2].X_centroid = IBTK::Point(0.45, 0.55, 0.6);
+    meters[2].e0 = IBTK::Vector(1.0, -1.0, 0.0).normalized();
+    meters[2].e1 = IBTK::Vector(1.0, 1.0, 1.0).normalized().cross(meters[2].e0);
+    meters[2].radius = 0.2;
+    return;
+} // setup_meters
+
+IBTK::Point
+perimeter_position(const MeterSpec& meter, const int k)
+{
+    const double theta = 2.0 * M_PI * static_cast<double>(k) / static_cast<double>(num_perimeter_nodes);
+    return meter.X_centroid + meter.radius * (std::cos(theta) * meter.e0 + std::sin(theta) * meter.e1);
+} // perimeter_position
+
+IBTK::Vector
+exact_velocity(const IBTK::Point& X)
+{
+    return IBTK::Vector(1.0 + 0.5 * X[0] - 0.25 * X[1] + 0.75 * X[2],
+                        -0.5 + 0.25 * X[0] + 1.5 * X[1] - 0.5 * X[2],
+                        2.0 - X[0] + 0.5 * X[1] + 0.25 * X[2]);
+} // exact_velocity
+
+double
+exact_pressure(const IBTK::Point& X)
+{
+    return 3.0 + 2.0 * X[0] - X[1] + 0.5 * X[2];
+} // exact_pressure
+
+void
+generate_structure(const unsigned int& /*strct_num*/,
+                   const int& ln,
+                   int& num_vertices,
+                   std::vector<IBTK::Point>& vertex_posn)
+{
+    num_vertices = (ln == finest_ln) ? static_cast<int>(meters.size()) * num_perimeter_nodes : 0;
+    vertex_posn.resize(num_vertices);
+    for (int k = 0; k < num_vertices; ++k)
+    {
+        vertex_posn[k] = perimeter_position(meters[k / num_perimeter_nodes], k % num_perimeter_nodes);
+    }
+    return;
+} // generate_structure
+
+void
+generate_instrumentation(const unsigned int& /*strct_num*/,
+                         const int& ln,
+                         std::vector<std::string>& instrument_name,
+                         std::map<int, std::pair<int, int> >& instrument_spec)
+{
+    if (ln != finest_ln) return;
+    for (unsigned int m = 0; m < meters.size(); ++m)
+    {
+        instrument_name.push_back(meters[m].name);
+        for (int n = 0; n < num_perimeter_nodes; ++n)
+        {
+            instrument_spec[m * num_perimeter_nodes + n] = std::make_pair(m, n);
+        }
+    }
+    return;
+} // generate_instrumentation
+
+// Set the velocity and pressure to their exact values on all patches,
+// including the ghost cells, of all levels.
+void
+set_eulerian_data(const int u_idx, const int p_idx, Pointer<PatchHierarchy<NDIM> > hierarchy)
+{
+    for (int ln = 0; ln <= hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const hier::Index<NDIM>& patch_lower = patch->getBox().lower();
+            Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            const double* const x_lower = pgeom->getXLower();
+            const double* const dx = pgeom->getDx();
+
+            Pointer<SideData<NDIM, double> > u_data = patch->getPatchData(u_idx);
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
+                for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(u_data->getGhostBox(), axis)); b; b++)
+                {
+                    const hier::Index<NDIM>& i = b();
+                    IBTK::Point X;
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        X[d] = x_lower[d] +
+                               dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + (d == axis ? 0.0 : 0.5));
+                    }
+                    (*u_data)(SideIndex<NDIM>(i, axis, SideIndex<NDIM>::Lower)) = exact_velocity(X)[axis];
+                }
+            }
+
+            Pointer<CellData<NDIM, double> > p_data = patch->getPatchData(p_idx);
+            for (Box<NDIM>::Iterator b(p_data->getGhostBox()); b; b++)
+            {
+                const hier::Index<NDIM>& i = b();
+                IBTK::Point X;
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    X[d] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
+                }
+                (*p_data)(CellIndex<NDIM>(i)) = exact_pressure(X);
+            }
+        }
+    }
+    return;
+} // set_eulerian_data
+} // namespace
+
+/*******************************************************************************
+ * For each run, the input filename must be given on the command line.  In all *
+ * cases, the command line is:                                                 *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        // prevent a warning about timer initializations
+        TimerManager::createManager(nullptr);
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<IBMethod> ib_method_ops = new IBMethod("IBMethod", app_initializer->getComponentDatabase("IBMethod"));
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator",
+                                              app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                              ib_method_ops,
+                                              navier_stokes_integrator);
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Configure the IB solver.  The structure consists only of the
+        // perimeter nodes of the flow meters.
+        Pointer<IBRedundantInitializer> ib_initializer = new IBRedundantInitializer(
+            "IBRedundantInitializer", app_initializer->getComponentDatabase("IBRedundantInitializer"));
+        finest_ln = input_db->getInteger("MAX_LEVELS") - 1;
+        num_perimeter_nodes = input_db->getInteger("NUM_PERIMETER_NODES");
+        setup_meters();
+        ib_initializer->setStructureNamesOnLevel(finest_ln, { "meters" });
+        ib_initializer->registerInitStructureFunction(generate_structure);
+        ib_initializer->registerInitInstrumentationFunction(generate_instrumentation);
+        ib_method_ops->registerLInitStrategy(ib_initializer);
+
+        // Create the velocity and pressure variables that are read by the
+        // instrument panel.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("instrument_panel_01");
+        Pointer<SideVariable<NDIM, double> > u_var = new SideVariable<NDIM, double>("u");
+        Pointer<CellVariable<NDIM, double> > p_var = new CellVariable<NDIM, double>("p");
+        const int u_idx = var_db->registerVariableAndContext(u_var, ctx, IntVector<NDIM>(1));
+        const int p_idx = var_db->registerVariableAndContext(p_var, ctx, IntVector<NDIM>(1));
+
+        // Initialize hierarchy configuration and data on all patches.
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+        // Deallocate initialization objects.
+        ib_method_ops->freeLInitStrategy();
+        ib_initializer.setNull();
+
+        for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->allocatePatchData(u_idx, 0.0);
+            level->allocatePatchData(p_idx, 0.0);
+        }
+        set_eulerian_data(u_idx, p_idx, patch_hierarchy);
+
+        // Translate the meters, so that the flow rates are measured relative
+        // to the motion of the meters.
+        LDataManager* const l_data_manager = ib_method_ops->getLDataManager();
+        Pointer<LData> U_data = l_data_manager->getLData(LDataManager::VEL_DATA_NAME, finest_ln);
+        {
+            double* const U_node = U_data->getLocalFormVecArray()->data();
+            for (unsigned int k = 0; k < U_data->getLocalNodeCount(); ++k)
+            {
+                for (unsigned int d = 0; d < NDIM; ++d) U_node[NDIM * k + d] = U_meter[d];
+            }
+            U_data->restoreArrays();
+        }
+
+        // Read the instrument data.
+        Pointer<IBInstrumentPanel> instrument_panel =
+            new IBInstrumentPanel("IBInstrumentPanel", app_initializer->getComponentDatabase("IBInstrumentPanel"));
+        instrument_panel->initializeHierarchyIndependentData(patch_hierarchy, l_data_manager);
+        instrument_panel->initializeHierarchyDependentData(patch_hierarchy, l_data_manager, 0, 0.0);
+        instrument_panel->readInstrumentData(u_idx, p_idx, patch_hierarchy, l_data_manager, 0, 0.0);
+        const std::vector<std::string>& instrument_names = instrument_panel->getInstrumentNames();
+        const std::vector<double>& flow_values = instrument_panel->getFlowValues();
+        const std::vector<double>& mean_pres_values = instrument_panel->getMeanPressureValues();
+        const std::vector<double>& point_pres_values = instrument_panel->getPointwisePressureValues();
+
+        // Compare the instrument data to the exact values.
+        bool values_are_exact = instrument_names.size() == meters.size();
+        for (unsigned int m = 0; m < meters.size() && values_are_exact; ++m)
+        {
+            const MeterSpec& meter = meters[m];
+            const double area = 0.5 * num_perimeter_nodes * meter.radius * meter.radius *
+                                std::sin(2.0 * M_PI / static_cast<double>(num_perimeter_nodes));
+            const IBTK::Vector normal = meter.e0.cross(meter.e1);
+            const double flow = (exact_velocity(meter.X_centroid) - U_meter).dot(normal) * area;
+            const double pres = exact_pressure(meter.X_centroid);
+            values_are_exact = values_are_exact && instrument_names[m] == meter.name &&
+                               std::abs(flow_values[m] - flow) < 1.0e-12 * std::abs(flow) &&
+                               std::abs(mean_pres_values[m] - pres) < 1.0e-12 * std::abs(pres) &&
+                               std::abs(point_pres_values[m] - pres) < 1.0e-12 * std::abs(pres);
+        }
+
+        if (SAMRAI_MPI::getRank() == 0)
+        {
+            std::ofstream out("output");
+            out << std::setprecision(10);
+            out << "number of levels: " << patch_hierarchy->getNumberOfLevels() << "\n";
+            out << "number of patches on level 0: " << patch_hierarchy->getPatchLevel(0)->getNumberOfPatches()
+                << "\n";
+            for (unsigned int m = 0; m < instrument_names.size(); ++m)
+            {
+                out << "\n" << instrument_names[m] << ":\n";
+                out << "  flow rate:          " << flow_values[m] << "\n";
+                out << "  mean pressure:      " << mean_pres_values[m] << "\n";
+                out << "  pointwise pressure: " << point_pres_values[m] << "\n";
+            }
+            out << "\ninstrument values agree with exact values: " << (values_are_exact ? "OK" : "FAILED") << "\n";
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+} // main
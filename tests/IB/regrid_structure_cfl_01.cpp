@@ -0,0 +1,238 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2019 - 2019 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <BoxList.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBMethod.h>
+#include <ibamr/IBRedundantInitializer.h>
+#include <ibamr/IBStandardForceGen.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IndexUtilities.h>
+#include <ibtk/LData.h>
+#include <ibtk/LDataManager.h>
+#include <ibtk/LEInteractor.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+#include <cmath>
+#include <fstream>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Test that the structure regrid CFL interval regrids the hierarchy less often
+// than the fluid regrid CFL interval when the structure moves more slowly than
+// the fluid, and that the structure remains within the finest level between
+// regrids.  The structure is a line of passive tracers along the center of a
+// steady, periodic shear flow u = (U + A sin(2 pi y), 0), so that it moves with
+// speed U while the maximum fluid speed is U + A.
+
+namespace
+{
+int finest_ln;
+int num_nodes;
+double x_left, x_right;
+
+void
+generate_structure(const unsigned int& /*strct_num*/,
+                   const int& ln,
+                   int& num_vertices,
+                   std::vector<IBTK::Point>& vertex_posn)
+{
+    num_vertices = (ln == finest_ln) ? num_nodes : 0;
+    vertex_posn.resize(num_vertices);
+    for (int k = 0; k < num_vertices; ++k)
+    {
+        vertex_posn[k] = IBTK::Point::Zero();
+        vertex_posn[k](0) = x_left + (x_right - x_left) * static_cast<double>(k) / static_cast<double>(num_nodes - 1);
+        vertex_posn[k](1) = 0.5;
+    }
+    return;
+} // generate_structure
+
+// Check that the support of the regularized delta function centered at each
+// Lagrangian point on the finest level is contained in that level.
+bool
+structure_inside_finest_level(Pointer<PatchHierarchy<NDIM> > patch_hierarchy,
+                              LDataManager* l_data_manager,
+                              const int stencil_half_width)
+{
+    const int ln = patch_hierarchy->getFinestLevelNumber();
+    Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = patch_hierarchy->getGridGeometry();
+    const BoxList<NDIM> level_boxes(level->getBoxes());
+    int inside = l_data_manager->levelContainsLagrangianData(ln) ? 1 : 0;
+    if (inside)
+    {
+        Pointer<LData> X_data = l_data_manager->getLData(LDataManager::POSN_DATA_NAME, ln);
+        const double* const X = X_data->getLocalFormVecArray()->data();
+        for (unsigned int k = 0; k < X_data->getLocalNodeCount(); ++k)
+        {
+            const hier::Index<NDIM> i_center = IndexUtilities::getCellIndex(&X[NDIM * k], grid_geom, level->getRatio());
+            Box<NDIM> stencil_box(i_center, i_center);
+            stencil_box.grow(IntVector<NDIM>(stencil_half_width));
+            BoxList<NDIM> uncovered_boxes(stencil_box);
+            uncovered_boxes.removeIntersections(level_boxes);
+            if (!uncovered_boxes.isEmpty()) inside = 0;
+        }
+        X_data->restoreArrays();
+    }
+    return SAMRAI_MPI::minReduction(inside) == 1;
+} // structure_inside_finest_level
+} // namespace
+
+/*******************************************************************************
+ * For each run, the input filename must be given on the command line.  In all *
+ * cases, the command line is:                                                 *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        // prevent a warning about timer initializations
+        TimerManager::createManager(nullptr);
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<IBMethod> ib_method_ops = new IBMethod("IBMethod", app_initializer->getComponentDatabase("IBMethod"));
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator",
+                                              app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                              ib_method_ops,
+                                              navier_stokes_integrator);
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Configure the IB solver.
+        Pointer<IBRedundantInitializer> ib_initializer = new IBRedundantInitializer(
+            "IBRedundantInitializer", app_initializer->getComponentDatabase("IBRedundantInitializer"));
+        finest_ln = input_db->getInteger("MAX_LEVELS") - 1;
+        num_nodes = input_db->getInteger("NUM_NODES");
+        x_left = input_db->getDouble("X_LEFT");
+        x_right = input_db->getDouble("X_RIGHT");
+        ib_initializer->setStructureNamesOnLevel(finest_ln, { "line" });
+        ib_initializer->registerInitStructureFunction(generate_structure);
+        ib_method_ops->registerLInitStrategy(ib_initializer);
+        Pointer<IBStandardForceGen> ib_force_fcn = new IBStandardForceGen();
+        ib_method_ops->registerIBLagrangianForceFunction(ib_force_fcn);
+
+        // Create Eulerian initial condition and body force specification
+        // objects.  The domain is periodic.
+        Pointer<CartGridFunction> u_init = new muParserCartGridFunction(
+            "u_init", app_initializer->getComponentDatabase("VelocityInitialConditions"), grid_geometry);
+        navier_stokes_integrator->registerVelocityInitialConditions(u_init);
+        Pointer<CartGridFunction> f_fcn = new muParserCartGridFunction(
+            "f_fcn", app_initializer->getComponentDatabase("ForcingFunction"), grid_geometry);
+        time_integrator->registerBodyForceFunction(f_fcn);
+
+        // Initialize hierarchy configuration and data on all patches.
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+        // Deallocate initialization objects.
+        ib_method_ops->freeLInitStrategy();
+        ib_initializer.setNull();
+
+        // Count the regrids after the initial time step, and check that the
+        // structure remains within the finest level at the end of each step.
+        LDataManager* const l_data_manager = ib_method_ops->getLDataManager();
+        const int stencil_half_width = LEInteractor::getMinimumGhostWidth(input_db->getString("DELTA_FUNCTION"));
+        const int num_steps = input_db->getInteger("NUM_STEPS");
+        int num_regrids = 0;
+        bool structure_inside = structure_inside_finest_level(patch_hierarchy, l_data_manager, stencil_half_width);
+        for (int step = 0; step < num_steps; ++step)
+        {
+            if (step > 0 && time_integrator->atRegridPoint()) ++num_regrids;
+            const double dt = time_integrator->getMaximumTimeStepSize();
+            time_integrator->advanceHierarchy(dt);
+            structure_inside = structure_inside &&
+                               structure_inside_finest_level(patch_hierarchy, l_data_manager, stencil_half_width);
+        }
+
+        // Without the structure regrid CFL interval, the fluid regrid CFL
+        // interval with the same value would regrid at least once every
+        // ceil(interval / cfl) time steps, in which cfl = (U + A) dt / dx is the
+        // fluid CFL number of each time step.  The structure moves only U dt / dx
+        // meshwidths per time step, so it triggers at most one regrid every
+        // interval / (U dt / dx) time steps.
+        const double interval = input_db->getDouble("REGRID_STRUCTURE_CFL_INTERVAL");
+        const double dt = input_db->getDouble("DT");
+        const double dx = input_db->getDouble("DX_FINEST");
+        const double structure_cfl = input_db->getDouble("U") * dt / dx;
+        const double fluid_cfl = (input_db->getDouble("U") + input_db->getDouble("A")) * dt / dx;
+        const int max_structure_regrids = static_cast<int>(std::floor((num_steps - 1) * structure_cfl / interval));
+        const int min_fluid_regrids = (num_steps - 1) / static_cast<int>(std::ceil(interval / fluid_cfl));
+
+        if (SAMRAI_MPI::getRank() == 0)
+        {
+            std::ofstream out("output");
+            out << "structure displacement triggers a regrid: " << (num_regrids > 0 ? "OK" : "FAILED") << "\n";
+            out << "regrids bounded by structure motion:      "
+                << (num_regrids <= max_structure_regrids ? "OK" : "FAILED") << "\n";
+            out << "fewer regrids than fluid CFL criterion:   "
+                << (num_regrids < min_fluid_regrids ? "OK" : "FAILED") << "\n";
+            out << "structure stays in finest level:          " << (structure_inside ? "OK" : "FAILED") << "\n";
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+} // main
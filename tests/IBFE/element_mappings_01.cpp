@@ -0,0 +1,328 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2019 - 2019 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for basic libMesh objects
+#include <libmesh/equation_systems.h>
+#include <libmesh/linear_partitioner.h>
+#include <libmesh/mesh.h>
+#include <libmesh/mesh_generation.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBFEMethod.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/libmesh_utilities.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+#include <algorithm>
+#include <fstream>
+#include <set>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Test for the incremental update of the mappings between elements and patches
+// in FEDataManager (element_mapping_displacement_fraction > 0). A disk is
+// carried through a periodic domain by a uniform flow and the hierarchy is
+// regridded after every time step, so that the mappings are sometimes updated
+// incrementally (when the local patches did not change) and sometimes rebuilt
+// (when they did). After every regrid the mappings must contain every element
+// that the full rebuild (i.e., element_mapping_displacement_fraction = 0)
+// associates with each patch. Since the disk moves rigidly, they must also
+// only contain elements whose bounding boxes, grown by twice the permitted
+// displacement, intersect the patch. TRI3 elements are used so that the
+// element bounding boxes are determined by the nodes alone.
+
+namespace
+{
+void
+coordinate_mapping_function(libMesh::Point& X, const libMesh::Point& s, void* /*ctx*/)
+{
+    X(0) = s(0) + 0.3;
+    X(1) = s(1) + 0.4;
+    return;
+} // coordinate_mapping_function
+
+using PatchElemIds = std::vector<std::set<dof_id_type> >;
+
+// Collect, for each local patch, the ids of the elements whose bounding box
+// grown by the given distance intersects the patch grown by the ghost cell
+// width. This is how FEDataManager associates elements with patches.
+PatchElemIds
+collect_patch_elem_ids(Pointer<PatchLevel<NDIM> > level,
+                       const std::vector<libMeshWrappers::BoundingBox>& bboxes,
+                       const IntVector<NDIM>& ghost_width,
+                       const double growth)
+{
+    PatchElemIds patch_elem_ids;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        patch_elem_ids.emplace_back();
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+        const double* const dx = pgeom->getDx();
+        for (std::size_t elem_id = 0; elem_id < bboxes.size(); ++elem_id)
+        {
+            bool intersects = true;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                const double patch_lower = pgeom->getXLower()[d] - dx[d] * ghost_width[d];
+                const double patch_upper = pgeom->getXUpper()[d] + dx[d] * ghost_width[d];
+                intersects = intersects && bboxes[elem_id].first(d) - growth <= patch_upper &&
+                             patch_lower <= bboxes[elem_id].second(d) + growth;
+            }
+            if (intersects) patch_elem_ids.back().insert(elem_id);
+        }
+    }
+    return patch_elem_ids;
+} // collect_patch_elem_ids
+
+PatchElemIds
+get_patch_elem_ids(const FEDataManager& fe_data_manager)
+{
+    PatchElemIds patch_elem_ids;
+    for (const std::vector<Elem*>& elems : fe_data_manager.getActivePatchElementMap())
+    {
+        patch_elem_ids.emplace_back();
+        for (const Elem* const elem : elems) patch_elem_ids.back().insert(elem->id());
+    }
+    return patch_elem_ids;
+} // get_patch_elem_ids
+
+bool
+is_subset(const PatchElemIds& a, const PatchElemIds& b)
+{
+    if (a.size() != b.size()) return false;
+    for (std::size_t k = 0; k < a.size(); ++k)
+    {
+        if (!std::includes(b[k].begin(), b[k].end(), a[k].begin(), a[k].end())) return false;
+    }
+    return true;
+} // is_subset
+
+// Check that the nodes associated with each patch are exactly the nodes of the
+// elements associated with it.
+bool
+check_patch_nodes(const FEDataManager& fe_data_manager)
+{
+    const std::vector<std::vector<Elem*> >& patch_elems = fe_data_manager.getActivePatchElementMap();
+    const std::vector<std::vector<Node*> >& patch_nodes = fe_data_manager.getActivePatchNodeMap();
+    if (patch_elems.size() != patch_nodes.size()) return false;
+    for (std::size_t k = 0; k < patch_elems.size(); ++k)
+    {
+        std::set<dof_id_type> expected_node_ids, node_ids;
+        for (const Elem* const elem : patch_elems[k])
+        {
+            for (unsigned int n = 0; n < elem->n_nodes(); ++n) expected_node_ids.insert(elem->node_id(n));
+        }
+        for (const Node* const node : patch_nodes[k]) node_ids.insert(node->id());
+        if (node_ids != expected_node_ids || node_ids.size() != patch_nodes[k].size()) return false;
+    }
+    return true;
+} // check_patch_nodes
+
+std::vector<Box<NDIM> >
+get_local_patch_boxes(Pointer<PatchLevel<NDIM> > level)
+{
+    std::vector<Box<NDIM> > boxes;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++) boxes.push_back(level->getPatch(p())->getBox());
+    return boxes;
+} // get_local_patch_boxes
+
+const char*
+result(const bool ok)
+{
+    return SAMRAI_MPI::minReduction(ok ? 1 : 0) == 1 ? "OK" : "FAILED";
+} // result
+} // namespace
+
+int
+main(int argc, char** argv)
+{
+    // Initialize libMesh, PETSc, MPI, and SAMRAI.
+    LibMeshInit init(argc, argv);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        // prevent a warning about timer initializations
+        TimerManager::createManager(nullptr);
+
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create a simple FE mesh.
+        ReplicatedMesh mesh(init.comm(), NDIM);
+        const double dx = input_db->getDouble("DX");
+        const std::string elem_type = input_db->getString("ELEM_TYPE");
+        const double R = input_db->getDouble("R");
+        const int n_refinements = int(std::log2(R / dx));
+        MeshTools::Generation::build_sphere(mesh, R, n_refinements, Utility::string_to_enum<ElemType>(elem_type), 10);
+        mesh.prepare_for_use();
+        LinearPartitioner partitioner;
+        partitioner.partition(mesh);
+
+        // Create major algorithm and data objects that comprise the
+        // application.
+        Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<IBFEMethod> ib_method_ops =
+            new IBFEMethod("IBFEMethod",
+                           app_initializer->getComponentDatabase("IBFEMethod"),
+                           &mesh,
+                           app_initializer->getComponentDatabase("GriddingAlgorithm")->getInteger("max_levels"));
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator",
+                                              app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                              ib_method_ops,
+                                              navier_stokes_integrator);
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+        time_integrator->registerLoadBalancer(load_balancer);
+
+        // Configure the IBFE solver. There are no stresses, so the structure is
+        // simply carried along by the fluid.
+        ib_method_ops->registerInitialCoordinateMappingFunction(coordinate_mapping_function);
+        ib_method_ops->initializeFEEquationSystems();
+        EquationSystems* equation_systems = ib_method_ops->getFEDataManager()->getEquationSystems();
+
+        Pointer<CartGridFunction> u_init = new muParserCartGridFunction(
+            "u_init", app_initializer->getComponentDatabase("VelocityInitialConditions"), grid_geometry);
+        navier_stokes_integrator->registerVelocityInitialConditions(u_init);
+
+        // Initialize hierarchy configuration and data on all patches.
+        ib_method_ops->initializeFEData();
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+        FEDataManager& fe_data_manager = *ib_method_ops->getFEDataManager();
+        const IntVector<NDIM>& ghost_width = fe_data_manager.getGhostCellWidth();
+        const System& X_system = equation_systems->get_system(IBFEMethod::COORDS_SYSTEM_NAME);
+        const double fraction = fe_data_manager.getElementMappingDisplacementFraction();
+        const double level_dx =
+            grid_geometry->getDx()[0] / patch_hierarchy->getPatchLevel(fe_data_manager.getLevelNumber())->getRatio()(0);
+        const std::vector<libMeshWrappers::BoundingBox> initial_bboxes =
+            get_global_active_element_bounding_boxes(mesh, X_system);
+
+        // Advance the solution and regrid after every time step.
+        bool maps_contain_full_rebuild = true;
+        bool maps_within_permitted_displacement = true;
+        bool nodes_match_elements = true;
+        int num_kept_patches = 0;
+        int num_changed_patches = 0;
+        std::vector<libMeshWrappers::BoundingBox> bboxes;
+        const int num_steps = input_db->getInteger("NUM_STEPS");
+        for (int k = 0; k < num_steps; ++k)
+        {
+            const double dt = time_integrator->getMaximumTimeStepSize();
+            time_integrator->advanceHierarchy(dt);
+
+            const int ln = fe_data_manager.getLevelNumber();
+            const std::vector<Box<NDIM> > old_patch_boxes = get_local_patch_boxes(patch_hierarchy->getPatchLevel(ln));
+            time_integrator->regridHierarchy();
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            if (get_local_patch_boxes(level) == old_patch_boxes)
+            {
+                ++num_kept_patches;
+            }
+            else
+            {
+                ++num_changed_patches;
+            }
+
+            bboxes = get_global_active_element_bounding_boxes(mesh, X_system);
+            const double delta = fraction * ghost_width.max() * level_dx;
+            const PatchElemIds patch_elem_ids = get_patch_elem_ids(fe_data_manager);
+            maps_contain_full_rebuild =
+                maps_contain_full_rebuild &&
+                is_subset(collect_patch_elem_ids(level, bboxes, ghost_width, 0.0), patch_elem_ids);
+            maps_within_permitted_displacement =
+                maps_within_permitted_displacement &&
+                is_subset(patch_elem_ids, collect_patch_elem_ids(level, bboxes, ghost_width, 2.0 * delta));
+            nodes_match_elements = nodes_match_elements && check_patch_nodes(fe_data_manager);
+        }
+
+        // The structure must move far enough for some elements to be
+        // reassigned.
+        const Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(fe_data_manager.getLevelNumber());
+        double displacement = 0.0;
+        for (std::size_t elem_id = 0; elem_id < bboxes.size(); ++elem_id)
+        {
+            const double elem_displacement = std::abs(bboxes[elem_id].first(0) - initial_bboxes[elem_id].first(0));
+            displacement = std::max(displacement, elem_displacement);
+        }
+        const bool structure_moves = displacement > fraction * ghost_width.max() * level_dx;
+
+        // Rebuilding the mappings without any permitted displacement must give
+        // the same result as the reference computation used above.
+        fe_data_manager.setElementMappingDisplacementFraction(0.0);
+        fe_data_manager.reinitElementMappings();
+        const bool full_rebuild_matches =
+            get_patch_elem_ids(fe_data_manager) == collect_patch_elem_ids(level, bboxes, ghost_width, 0.0) &&
+            check_patch_nodes(fe_data_manager);
+
+        const char* kept_patches_result = SAMRAI_MPI::sumReduction(num_kept_patches) > 0 ? "OK" : "FAILED";
+        const char* changed_patches_result = SAMRAI_MPI::sumReduction(num_changed_patches) > 0 ? "OK" : "FAILED";
+        const char* structure_moves_result = result(structure_moves);
+        const char* contain_result = result(maps_contain_full_rebuild);
+        const char* within_result = result(maps_within_permitted_displacement);
+        const char* nodes_result = result(nodes_match_elements);
+        const char* full_rebuild_result = result(full_rebuild_matches);
+        if (SAMRAI_MPI::getRank() == 0)
+        {
+            std::ofstream out("output");
+            out << "regrids keeping the local patches:         " << kept_patches_result << '\n';
+            out << "regrids changing the local patches:        " << changed_patches_result << '\n';
+            out << "structure moves beyond permitted distance: " << structure_moves_result << '\n';
+            out << "mappings contain full rebuild:             " << contain_result << '\n';
+            out << "mappings within permitted displacement:    " << within_result << '\n';
+            out << "node mappings match element mappings:      " << nodes_result << '\n';
+            out << "full rebuild matches reference:            " << full_rebuild_result << '\n';
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+} // main
@@ -0,0 +1,223 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2019 - 2019 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for basic libMesh objects
+#include <libmesh/equation_systems.h>
+#include <libmesh/linear_partitioner.h>
+#include <libmesh/mesh.h>
+#include <libmesh/mesh_generation.h>
+#include <libmesh/petsc_vector.h>
+#include <libmesh/sparse_matrix.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBFEMethod.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+
+#include <cmath>
+#include <fstream>
+#include <memory>
+#include <string>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Test for the matrix-free consistent mass matrix L2 projection in
+// FEDataManager. For both P1 (TRI3) and P2 (TRI6) elements, the right-hand
+// side F = M U is computed with the assembled mass matrix M for a given vector
+// U. The matrix-free operator must reproduce F, and computeL2Projection() must
+// recover U both with the assembled solver and with the matrix-free solver.
+
+namespace
+{
+void
+coordinate_mapping_function(libMesh::Point& X, const libMesh::Point& s, void* /*ctx*/)
+{
+    X(0) = s(0) + 0.5;
+    X(1) = s(1) + 0.5;
+    return;
+} // coordinate_mapping_function
+
+struct ProjectionErrors
+{
+    // relative errors in the maximum norm
+    double apply = 0.0;
+    double assembled = 0.0;
+    double matrix_free = 0.0;
+    bool assembled_converged = false;
+    bool matrix_free_converged = false;
+};
+
+double
+relative_difference(const NumericVector<double>& a, const NumericVector<double>& b)
+{
+    std::unique_ptr<NumericVector<double> > diff = a.clone();
+    diff->add(-1.0, b);
+    return diff->linfty_norm() / b.linfty_norm();
+} // relative_difference
+
+ProjectionErrors
+run(LibMeshInit& init, Pointer<AppInitializer> app_initializer, const std::string& elem_type)
+{
+    Pointer<Database> input_db = app_initializer->getInputDatabase();
+    const std::string label = "_" + elem_type;
+
+    // Create a simple FE mesh.
+    ReplicatedMesh mesh(init.comm(), NDIM);
+    const double dx = input_db->getDouble("DX");
+    const double R = input_db->getDouble("R");
+    const int n_refinements = int(std::log2(R / dx));
+    MeshTools::Generation::build_sphere(mesh, R, n_refinements, Utility::string_to_enum<ElemType>(elem_type), 10);
+    mesh.prepare_for_use();
+    LinearPartitioner partitioner;
+    partitioner.partition(mesh);
+
+    Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+        "CartesianGeometry" + label, app_initializer->getComponentDatabase("CartesianGeometry"), false);
+    Pointer<PatchHierarchy<NDIM> > patch_hierarchy =
+        new PatchHierarchy<NDIM>("PatchHierarchy" + label, grid_geometry, false);
+    Pointer<LoadBalancer<NDIM> > load_balancer =
+        new LoadBalancer<NDIM>("LoadBalancer" + label, app_initializer->getComponentDatabase("LoadBalancer"));
+    Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+    Pointer<INSHierarchyIntegrator> navier_stokes_integrator =
+        new INSStaggeredHierarchyIntegrator("INSStaggeredHierarchyIntegrator" + label,
+                                            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"),
+                                            false);
+    Pointer<IBFEMethod> ib_method_ops =
+        new IBFEMethod("IBFEMethod" + label,
+                       app_initializer->getComponentDatabase("IBFEMethod"),
+                       &mesh,
+                       app_initializer->getComponentDatabase("GriddingAlgorithm")->getInteger("max_levels"),
+                       false);
+    Pointer<IBHierarchyIntegrator> time_integrator =
+        new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator" + label,
+                                          app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                          ib_method_ops,
+                                          navier_stokes_integrator,
+                                          false);
+    Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+        new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize" + label,
+                                           time_integrator,
+                                           app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+    Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+        new GriddingAlgorithm<NDIM>("GriddingAlgorithm" + label,
+                                    app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                    error_detector,
+                                    box_generator,
+                                    load_balancer,
+                                    false);
+
+    ib_method_ops->registerInitialCoordinateMappingFunction(coordinate_mapping_function);
+    ib_method_ops->initializeFEEquationSystems();
+    ib_method_ops->initializeFEData();
+    time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+    // Set up a smooth vector U and compute F = M U with the assembled mass
+    // matrix.
+    FEDataManager* fe_data_manager = ib_method_ops->getFEDataManager();
+    const std::string& system_name = IBFEMethod::VELOCITY_SYSTEM_NAME;
+    System& system = fe_data_manager->getEquationSystems()->get_system(system_name);
+    std::unique_ptr<NumericVector<double> > U = system.solution->zero_clone();
+    for (dof_id_type i = U->first_local_index(); i < U->last_local_index(); ++i)
+    {
+        U->set(i, 1.0 + std::sin(0.1 * static_cast<double>(i)));
+    }
+    U->close();
+    SparseMatrix<double>& M = *fe_data_manager->buildL2ProjectionSolver(system_name).second;
+    std::unique_ptr<NumericVector<double> > F = system.solution->zero_clone();
+    M.vector_mult(*F, *U);
+
+    ProjectionErrors errors;
+    const double tol = input_db->getDouble("SOLVER_TOL");
+    const unsigned int max_its = input_db->getInteger("SOLVER_MAX_ITS");
+
+    // Compare the action of the matrix-free operator with the assembled matrix.
+    std::unique_ptr<NumericVector<double> > MU = system.solution->zero_clone();
+    fe_data_manager->buildMatrixFreeL2ProjectionOperator(system_name)
+        ->apply(static_cast<PetscVector<double>&>(*U).vec(), static_cast<PetscVector<double>&>(*MU).vec());
+    errors.apply = relative_difference(*MU, *F);
+
+    // Solve with both the assembled and the matrix-free mass matrix.
+    std::unique_ptr<NumericVector<double> > U_assembled = system.solution->zero_clone();
+    fe_data_manager->setUseMatrixFreeL2Projection(false);
+    errors.assembled_converged =
+        fe_data_manager->computeL2Projection(*U_assembled, *F, system_name, true, true, true, tol, max_its);
+    errors.assembled = relative_difference(*U_assembled, *U);
+
+    std::unique_ptr<NumericVector<double> > U_matrix_free = system.solution->zero_clone();
+    fe_data_manager->setUseMatrixFreeL2Projection(true);
+    errors.matrix_free_converged =
+        fe_data_manager->computeL2Projection(*U_matrix_free, *F, system_name, true, true, true, tol, max_its);
+    errors.matrix_free = relative_difference(*U_matrix_free, *U);
+
+    pout << elem_type << ": relative error of M U = " << errors.apply
+         << ", relative error of the assembled solve = " << errors.assembled
+         << ", relative error of the matrix-free solve = " << errors.matrix_free << "\n";
+    return errors;
+} // run
+} // namespace
+
+int
+main(int argc, char** argv)
+{
+    // Initialize libMesh, PETSc, MPI, and SAMRAI.
+    LibMeshInit init(argc, argv);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        // prevent a warning about timer initializations
+        TimerManager::createManager(nullptr);
+
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const double apply_tol = 1.0e-12;
+        const double solve_tol = 1.0e-8;
+
+        std::ofstream out;
+        if (SAMRAI_MPI::getRank() == 0) out.open("output");
+        for (const std::string elem_type : { "TRI3", "TRI6" })
+        {
+            const ProjectionErrors errors = run(init, app_initializer, elem_type);
+            if (SAMRAI_MPI::getRank() == 0)
+            {
+                out << elem_type << " matrix-free M U:           " << (errors.apply < apply_tol ? "OK" : "FAILED")
+                    << '\n';
+                out << elem_type << " assembled projection:      "
+                    << (errors.assembled_converged && errors.assembled < solve_tol ? "OK" : "FAILED") << '\n';
+                out << elem_type << " matrix-free projection:    "
+                    << (errors.matrix_free_converged && errors.matrix_free < solve_tol ? "OK" : "FAILED") << '\n';
+            }
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+} // main
@@ -0,0 +1,251 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2019 - 2019 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for basic libMesh objects
+#include <libmesh/equation_systems.h>
+#include <libmesh/linear_partitioner.h>
+#include <libmesh/mesh.h>
+#include <libmesh/mesh_generation.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBFEMethod.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+#include <fstream>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// This test advects a disk through a periodic domain with a uniform velocity
+// field and verifies that restricting the transfers between the primary and
+// scratch hierarchies to the neighborhood of the structure (i.e.,
+// use_sparse_scratch_transfer = TRUE) gives the same results as transferring
+// all data. In the serial test the hierarchy is never regridded and the
+// structure moves much further than the transfer buffer plus the ghost cell
+// width, so the transfer boxes must be recomputed between regrids for the
+// results to agree.
+
+namespace
+{
+void
+coordinate_mapping_function(libMesh::Point& X, const libMesh::Point& s, void* /*ctx*/)
+{
+    X(0) = s(0) + 0.3;
+    X(1) = s(1) + 0.4;
+#if (NDIM == 3)
+    X(2) = s(2) + 0.4;
+#endif
+    return;
+} // coordinate_mapping_function
+
+struct RunData
+{
+    // nodal values, indexed by node id and then by component
+    std::vector<double> X0, X, U;
+    double dx = 0.0;
+    int ghost_width = 0;
+};
+
+std::vector<double>
+get_nodal_values(const MeshBase& mesh, System& system)
+{
+    std::vector<double> serial_values;
+    system.solution->localize(serial_values);
+    std::vector<double> values(NDIM * mesh.n_nodes());
+    const unsigned int sys_num = system.number();
+    for (auto it = mesh.nodes_begin(); it != mesh.nodes_end(); ++it)
+    {
+        const Node* const node = *it;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            values[NDIM * node->id() + d] = serial_values[node->dof_number(sys_num, d, 0)];
+        }
+    }
+    return values;
+} // get_nodal_values
+
+RunData
+run(LibMeshInit& init, Pointer<AppInitializer> app_initializer, const std::string& label, const bool use_sparse)
+{
+    Pointer<Database> input_db = app_initializer->getInputDatabase();
+    RunData data;
+
+    // Create a simple FE mesh.
+    ReplicatedMesh mesh(init.comm(), NDIM);
+    data.dx = input_db->getDouble("DX");
+    const std::string elem_type = input_db->getString("ELEM_TYPE");
+    const double R = input_db->getDouble("R");
+    const int n_refinements = int(std::log2(R / data.dx));
+    MeshTools::Generation::build_sphere(mesh, R, n_refinements, Utility::string_to_enum<ElemType>(elem_type), 10);
+    mesh.prepare_for_use();
+    LinearPartitioner partitioner;
+    partitioner.partition(mesh);
+
+    Pointer<Database> ib_method_db = app_initializer->getComponentDatabase("IBFEMethod");
+    ib_method_db->putBool("use_sparse_scratch_transfer", use_sparse);
+
+    Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+        "CartesianGeometry" + label, app_initializer->getComponentDatabase("CartesianGeometry"), false);
+    Pointer<PatchHierarchy<NDIM> > patch_hierarchy =
+        new PatchHierarchy<NDIM>("PatchHierarchy" + label, grid_geometry, false);
+    Pointer<LoadBalancer<NDIM> > load_balancer =
+        new LoadBalancer<NDIM>("LoadBalancer" + label, app_initializer->getComponentDatabase("LoadBalancer"));
+    Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+
+    Pointer<INSHierarchyIntegrator> navier_stokes_integrator =
+        new INSStaggeredHierarchyIntegrator("INSStaggeredHierarchyIntegrator" + label,
+                                            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"),
+                                            /*register_for_restart*/ false);
+    Pointer<IBFEMethod> ib_method_ops =
+        new IBFEMethod("IBFEMethod" + label,
+                       ib_method_db,
+                       &mesh,
+                       app_initializer->getComponentDatabase("GriddingAlgorithm")->getInteger("max_levels"),
+                       /*register_for_restart*/ false);
+    Pointer<IBHierarchyIntegrator> time_integrator =
+        new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator" + label,
+                                          app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                          ib_method_ops,
+                                          navier_stokes_integrator,
+                                          /*register_for_restart*/ false);
+    time_integrator->registerLoadBalancer(load_balancer);
+    Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+        new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize" + label,
+                                           time_integrator,
+                                           app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+    Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+        new GriddingAlgorithm<NDIM>("GriddingAlgorithm" + label,
+                                    app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                    error_detector,
+                                    box_generator,
+                                    load_balancer,
+                                    false);
+
+    // Configure the IBFE solver. There are no stresses, so the structure is
+    // simply carried along by the fluid.
+    ib_method_ops->registerInitialCoordinateMappingFunction(coordinate_mapping_function);
+    ib_method_ops->initializeFEEquationSystems();
+    EquationSystems* equation_systems = ib_method_ops->getFEDataManager()->getEquationSystems();
+
+    Pointer<CartGridFunction> u_init = new muParserCartGridFunction(
+        "u_init" + label, app_initializer->getComponentDatabase("VelocityInitialConditions"), grid_geometry);
+    navier_stokes_integrator->registerVelocityInitialConditions(u_init);
+
+    // Initialize hierarchy configuration and data on all patches.
+    ib_method_ops->initializeFEData();
+    time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+    data.ghost_width = ib_method_ops->getMinimumGhostCellWidth().max();
+
+    System& X_system = equation_systems->get_system(IBFEMethod::COORDS_SYSTEM_NAME);
+    System& U_system = equation_systems->get_system(IBFEMethod::VELOCITY_SYSTEM_NAME);
+    data.X0 = get_nodal_values(mesh, X_system);
+
+    // Main time step loop.
+    double loop_time = time_integrator->getIntegratorTime();
+    const double loop_time_end = time_integrator->getEndTime();
+    while (!MathUtilities<double>::equalEps(loop_time, loop_time_end) && time_integrator->stepsRemaining())
+    {
+        const double dt = time_integrator->getMaximumTimeStepSize();
+        time_integrator->advanceHierarchy(dt);
+        loop_time += dt;
+    }
+
+    data.X = get_nodal_values(mesh, X_system);
+    data.U = get_nodal_values(mesh, U_system);
+    return data;
+} // run
+
+double
+max_difference(const std::vector<double>& a, const std::vector<double>& b)
+{
+    TBOX_ASSERT(a.size() == b.size());
+    double diff = 0.0;
+    for (std::size_t i = 0; i < a.size(); ++i) diff = std::max(diff, std::abs(a[i] - b[i]));
+    return diff;
+} // max_difference
+} // namespace
+
+int
+main(int argc, char** argv)
+{
+    // Initialize libMesh, PETSc, MPI, and SAMRAI.
+    LibMeshInit init(argc, argv);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    PetscOptionsSetValue(nullptr, "-stokes_ksp_atol", "1e-14");
+    PetscOptionsSetValue(nullptr, "-stokes_ksp_rtol", "1e-14");
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        // prevent a warning about timer initializations
+        TimerManager::createManager(nullptr);
+
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        const RunData full = run(init, app_initializer, "_full", false);
+        const RunData sparse = run(init, app_initializer, "_sparse", true);
+
+        // The structure should move with the prescribed velocity.
+        const double T = input_db->getDouble("END_TIME");
+        std::vector<double> X_exact(full.X0);
+        std::vector<double> U_exact(full.U.size());
+        for (std::size_t i = 0; i < X_exact.size(); ++i)
+        {
+            const double U = input_db->getDouble(i % NDIM == 0 ? "U_X" : "U_Y");
+            X_exact[i] += U * T;
+            U_exact[i] = U;
+        }
+        const double displacement = max_difference(full.X, full.X0) / full.dx;
+        const int buffer =
+            app_initializer->getComponentDatabase("IBFEMethod")->getInteger("sparse_scratch_transfer_buffer");
+
+        const double tol = 1.0e-10;
+        if (SAMRAI_MPI::getRank() == 0)
+        {
+            std::ofstream out("output");
+            out << "structure moves beyond buffer and ghost width: "
+                << (displacement > buffer + full.ghost_width ? "OK" : "FAILED") << '\n';
+            out << "full transfer position:                        "
+                << (max_difference(full.X, X_exact) < tol ? "OK" : "FAILED") << '\n';
+            out << "full transfer velocity:                        "
+                << (max_difference(full.U, U_exact) < tol ? "OK" : "FAILED") << '\n';
+            out << "sparse transfer position:                      "
+                << (max_difference(sparse.X, full.X) < tol ? "OK" : "FAILED") << '\n';
+            out << "sparse transfer velocity:                      "
+                << (max_difference(sparse.U, full.U) < tol ? "OK" : "FAILED") << '\n';
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+} // main
@@ -0,0 +1,331 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2019 - 2019 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <HierarchyCellDataOpsReal.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for basic libMesh objects
+#include <libmesh/equation_systems.h>
+#include <libmesh/linear_partitioner.h>
+#include <libmesh/mesh.h>
+#include <libmesh/mesh_generation.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBFEMethod.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/PartitioningBox.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Test for the IBFE workload estimates calibrated with measured interaction
+// costs (workload_use_measured_costs = TRUE). A disk is carried by a uniform
+// flow and its interaction with the fluid is done on a scratch hierarchy with
+// several patches per processor, so that different elements have different
+// measured costs. The same problem is solved twice, first with plain
+// quadrature point counts and then with measured costs. Since the hierarchies
+// are identical before the first regrid, the workload with measured costs must
+// differ from the plain count and, in each cell, lie between the count scaled
+// by the smallest and by the largest weight of any element. Regridding must
+// multiply the measured costs by workload_measured_cost_retention, and the
+// libMesh partitioning (libmesh_partitioner_type = SAMRAI_BOX) must assign
+// every element to the processor owning the scratch patch that contains its
+// centroid.
+
+namespace
+{
+void
+coordinate_mapping_function(libMesh::Point& X, const libMesh::Point& s, void* /*ctx*/)
+{
+    X(0) = s(0) + 0.3;
+    X(1) = s(1) + 0.4;
+    return;
+} // coordinate_mapping_function
+
+struct RunResults
+{
+    // workload estimate in each local cell of the level containing the
+    // structure
+    std::vector<double> workload;
+
+    // smallest and largest weights of the quadrature points of any element
+    double min_weight = 1.0;
+    double max_weight = 1.0;
+
+    bool costs_measured = false;
+    bool costs_decayed = false;
+    bool elements_on_local_patches = false;
+    bool elements_partitioned_once = false;
+};
+
+std::vector<double>
+get_local_cell_values(Pointer<PatchLevel<NDIM> > level, const int data_idx)
+{
+    std::vector<double> values;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<CellData<NDIM, double> > data = patch->getPatchData(data_idx);
+        for (Box<NDIM>::Iterator b(patch->getBox()); b; b++)
+        {
+            values.push_back((*data)(b()));
+        }
+    }
+    return values;
+} // get_local_cell_values
+
+RunResults
+run(LibMeshInit& init, Pointer<AppInitializer> app_initializer, const std::string& label, const bool use_measured_costs)
+{
+    Pointer<Database> input_db = app_initializer->getInputDatabase();
+    Pointer<Database> ib_method_db = app_initializer->getComponentDatabase("IBFEMethod");
+    ib_method_db->putBool("workload_use_measured_costs", use_measured_costs);
+
+    // Create a simple FE mesh.
+    ReplicatedMesh mesh(init.comm(), NDIM);
+    const double dx = input_db->getDouble("DX");
+    const double R = input_db->getDouble("R");
+    const int n_refinements = int(std::log2(R / dx));
+    MeshTools::Generation::build_sphere(mesh, R, n_refinements, TRI3, 10);
+    mesh.prepare_for_use();
+    LinearPartitioner partitioner;
+    partitioner.partition(mesh);
+
+    // Create major algorithm and data objects that comprise the application.
+    Pointer<INSHierarchyIntegrator> navier_stokes_integrator =
+        new INSStaggeredHierarchyIntegrator("INSStaggeredHierarchyIntegrator" + label,
+                                            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"),
+                                            false);
+    Pointer<IBFEMethod> ib_method_ops =
+        new IBFEMethod("IBFEMethod" + label,
+                       ib_method_db,
+                       &mesh,
+                       app_initializer->getComponentDatabase("GriddingAlgorithm")->getInteger("max_levels"),
+                       false);
+    Pointer<IBHierarchyIntegrator> time_integrator =
+        new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator" + label,
+                                          app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                          ib_method_ops,
+                                          navier_stokes_integrator,
+                                          false);
+    Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+        "CartesianGeometry" + label, app_initializer->getComponentDatabase("CartesianGeometry"), false);
+    Pointer<PatchHierarchy<NDIM> > patch_hierarchy =
+        new PatchHierarchy<NDIM>("PatchHierarchy" + label, grid_geometry, false);
+    Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+        new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize" + label,
+                                           time_integrator,
+                                           app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+    Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+    Pointer<LoadBalancer<NDIM> > load_balancer =
+        new LoadBalancer<NDIM>("LoadBalancer" + label, app_initializer->getComponentDatabase("LoadBalancer"));
+    Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+        new GriddingAlgorithm<NDIM>("GriddingAlgorithm" + label,
+                                    app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                    error_detector,
+                                    box_generator,
+                                    load_balancer,
+                                    false);
+    time_integrator->registerLoadBalancer(load_balancer);
+
+    ib_method_ops->registerInitialCoordinateMappingFunction(coordinate_mapping_function);
+    ib_method_ops->initializeFEEquationSystems();
+    Pointer<CartGridFunction> u_init = new muParserCartGridFunction(
+        "u_init" + label, app_initializer->getComponentDatabase("VelocityInitialConditions"), grid_geometry);
+    navier_stokes_integrator->registerVelocityInitialConditions(u_init);
+    ib_method_ops->initializeFEData();
+    time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+    // Advance the solution without regridding so that the interaction costs
+    // are measured on the initial scratch hierarchy.
+    const int num_steps = input_db->getInteger("NUM_STEPS");
+    for (int k = 0; k < num_steps; ++k)
+    {
+        const double dt = time_integrator->getMaximumTimeStepSize();
+        time_integrator->advanceHierarchy(dt);
+    }
+
+    // Compute the workload estimate on the primary hierarchy (which, unlike
+    // the scratch hierarchy, does not depend on the workload).
+    RunResults results;
+    FEDataManager& fe_data_manager = *ib_method_ops->getFEDataManager();
+    const int ln = fe_data_manager.getLevelNumber();
+    Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    Pointer<CellVariable<NDIM, double> > W_var = new CellVariable<NDIM, double>("W" + label);
+    const int W_idx = var_db->registerVariableAndContext(W_var, var_db->getContext("workload_measured_costs_01"));
+    level->allocatePatchData(W_idx, 0.0);
+    HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(patch_hierarchy, ln, ln);
+    hier_cc_data_ops.setToScalar(W_idx, 0.0);
+    fe_data_manager.addWorkloadEstimate(patch_hierarchy, W_idx);
+    results.workload = get_local_cell_values(level, W_idx);
+    level->deallocatePatchData(W_idx);
+    var_db->removePatchDataIndex(W_idx);
+
+    // Compute the range of the weights of the quadrature points from the
+    // measured costs: elements without measurements have unit weight.
+    const std::vector<double>& times = fe_data_manager.getMeasuredElementTimes();
+    const std::vector<double>& q_points = fe_data_manager.getMeasuredElementQuadPointCounts();
+    double totals[2] = { std::accumulate(times.begin(), times.end(), 0.0),
+                         std::accumulate(q_points.begin(), q_points.end(), 0.0) };
+    SAMRAI_MPI::sumReduction(totals, 2);
+    results.costs_measured = totals[0] > 0.0 && totals[1] > 0.0;
+    if (results.costs_measured)
+    {
+        const double avg_q_point_cost = totals[0] / totals[1];
+        for (std::size_t elem_id = 0; elem_id < q_points.size(); ++elem_id)
+        {
+            if (q_points[elem_id] == 0.0) continue;
+            const double weight = times[elem_id] / (q_points[elem_id] * avg_q_point_cost);
+            results.min_weight = std::min(results.min_weight, weight);
+            results.max_weight = std::max(results.max_weight, weight);
+        }
+    }
+
+    // Regridding must discount the measured costs exactly once.
+    const std::vector<double> old_times = times;
+    const std::vector<double> old_q_points = q_points;
+    const double retention = ib_method_db->getDouble("workload_measured_cost_retention");
+    time_integrator->regridHierarchy();
+    results.costs_decayed = times.size() == old_times.size() && q_points.size() == old_q_points.size();
+    for (std::size_t elem_id = 0; results.costs_decayed && elem_id < times.size(); ++elem_id)
+    {
+        results.costs_decayed = times[elem_id] == retention * old_times[elem_id] &&
+                                q_points[elem_id] == retention * old_q_points[elem_id];
+    }
+
+    // Each element must belong to the processor owning the scratch patch
+    // containing its centroid.
+    Pointer<PatchHierarchy<NDIM> > scratch_hierarchy = ib_method_ops->getScratchHierarchy();
+    const PartitioningBoxes local_boxes(*scratch_hierarchy);
+    const System& X_system = fe_data_manager.getEquationSystems()->get_system(IBFEMethod::COORDS_SYSTEM_NAME);
+    const unsigned int X_sys_num = X_system.number();
+    std::vector<double> X(X_system.solution->size());
+    X_system.solution->localize(X);
+    const processor_id_type rank = SAMRAI_MPI::getRank();
+    int n_local_elems = 0;
+    results.elements_on_local_patches = true;
+    for (auto elem_it = mesh.active_elements_begin(); elem_it != mesh.active_elements_end(); ++elem_it)
+    {
+        const Elem* const elem = *elem_it;
+        IBTK::Point centroid = IBTK::Point::Zero();
+        for (unsigned int n = 0; n < elem->n_nodes(); ++n)
+        {
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                centroid[d] += X[elem->node_ref(n).dof_number(X_sys_num, d, 0)];
+            }
+        }
+        centroid /= static_cast<double>(elem->n_nodes());
+        if (local_boxes.contains(centroid))
+        {
+            ++n_local_elems;
+            results.elements_on_local_patches = results.elements_on_local_patches && elem->processor_id() == rank;
+        }
+    }
+    results.elements_partitioned_once = SAMRAI_MPI::sumReduction(n_local_elems) == int(mesh.n_active_elem());
+    return results;
+} // run
+
+const char*
+result(const bool ok)
+{
+    return SAMRAI_MPI::minReduction(ok ? 1 : 0) == 1 ? "OK" : "FAILED";
+} // result
+} // namespace
+
+int
+main(int argc, char** argv)
+{
+    // Initialize libMesh, PETSc, MPI, and SAMRAI.
+    LibMeshInit init(argc, argv);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        // prevent a warning about timer initializations
+        TimerManager::createManager(nullptr);
+
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+
+        const RunResults count = run(init, app_initializer, "_count", false);
+        const RunResults measured = run(init, app_initializer, "_measured", true);
+
+        // The weight of each quadrature point is the measured cost of its
+        // element relative to the average, so the workload in each cell is
+        // bounded by the plain count scaled by the extreme weights.
+        const double eps = 1.0e-10;
+        bool workload_within_weights = count.workload.size() == measured.workload.size();
+        int workload_differs = 0;
+        for (std::size_t i = 0; workload_within_weights && i < count.workload.size(); ++i)
+        {
+            const double lower = measured.min_weight * count.workload[i];
+            const double upper = measured.max_weight * count.workload[i];
+            workload_within_weights = measured.workload[i] >= lower - eps * (1.0 + lower) &&
+                                      measured.workload[i] <= upper + eps * (1.0 + upper);
+            if (std::abs(measured.workload[i] - count.workload[i]) > eps * (1.0 + count.workload[i]))
+            {
+                workload_differs = 1;
+            }
+        }
+        pout << "smallest weight = " << measured.min_weight << ", largest weight = " << measured.max_weight << "\n";
+
+        const char* no_costs_result = result(!count.costs_measured);
+        const char* costs_result = result(measured.costs_measured);
+        const char* scaled_result = SAMRAI_MPI::maxReduction(workload_differs) == 1 ? "OK" : "FAILED";
+        const char* bounded_result = result(workload_within_weights);
+        const char* decayed_result = result(measured.costs_decayed);
+        const char* local_patches_result =
+            result(count.elements_on_local_patches && measured.elements_on_local_patches);
+        const char* partitioned_once_result =
+            result(count.elements_partitioned_once && measured.elements_partitioned_once);
+        if (SAMRAI_MPI::getRank() == 0)
+        {
+            std::ofstream out("output");
+            out << "costs not measured by default:         " << no_costs_result << '\n';
+            out << "costs measured:                        " << costs_result << '\n';
+            out << "workload scaled by measured costs:     " << scaled_result << '\n';
+            out << "workload within element weights:       " << bounded_result << '\n';
+            out << "costs decayed after regrid:            " << decayed_result << '\n';
+            out << "elements on local scratch patches:     " << local_patches_result << '\n';
+            out << "elements partitioned exactly once:     " << partitioned_once_result << '\n';
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+} // main
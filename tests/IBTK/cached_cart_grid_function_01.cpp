@@ -0,0 +1,245 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2019 - 2019 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBTK_config.h>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <HierarchyCellDataOpsReal.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitStrategy.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/CachedCartGridFunction.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+#include <CellVariable.h>
+
+#include <utility>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+// Test that CachedCartGridFunction evaluates a time-independent function only
+// once on each patch, and that the cached values are discarded when the
+// hierarchy is regridded.
+
+namespace
+{
+// Wrap a function and count the number of patches on which it is evaluated.
+class CountingFunction : public CartGridFunction
+{
+public:
+    CountingFunction(Pointer<CartGridFunction> fcn) : CartGridFunction("CountingFunction"), d_fcn(fcn)
+    {
+        // intentionally blank
+    }
+
+    bool isTimeDependent() const override
+    {
+        return d_fcn->isTimeDependent();
+    }
+
+    void setDataOnPatch(int data_idx,
+                        Pointer<Variable<NDIM> > var,
+                        Pointer<Patch<NDIM> > patch,
+                        double data_time,
+                        bool initial_time,
+                        Pointer<PatchLevel<NDIM> > level) override
+    {
+        ++d_num_evaluations;
+        d_fcn->setDataOnPatch(data_idx, var, patch, data_time, initial_time, level);
+        return;
+    }
+
+    int getNumberOfEvaluations() const
+    {
+        return SAMRAI_MPI::sumReduction(d_num_evaluations);
+    }
+
+private:
+    Pointer<CartGridFunction> d_fcn;
+    int d_num_evaluations = 0;
+};
+
+// Allocate the test data on each new patch level.
+class DataAllocator : public StandardTagAndInitStrategy<NDIM>
+{
+public:
+    DataAllocator(std::vector<int> idxs) : d_idxs(std::move(idxs))
+    {
+        // intentionally blank
+    }
+
+    void initializeLevelData(Pointer<BasePatchHierarchy<NDIM> > hierarchy,
+                             int level_number,
+                             double init_data_time,
+                             bool /*can_be_refined*/,
+                             bool /*initial_time*/,
+                             Pointer<BasePatchLevel<NDIM> > /*old_level*/,
+                             bool allocate_data) override
+    {
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = hierarchy;
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(level_number);
+        if (allocate_data)
+        {
+            for (const int idx : d_idxs) level->allocatePatchData(idx, init_data_time);
+        }
+        return;
+    }
+
+    void resetHierarchyConfiguration(Pointer<BasePatchHierarchy<NDIM> > /*hierarchy*/,
+                                     int /*coarsest_level*/,
+                                     int /*finest_level*/) override
+    {
+        return;
+    }
+
+private:
+    std::vector<int> d_idxs;
+};
+
+// Count the patches on the specified levels of the hierarchy.
+int
+count_patches(Pointer<PatchHierarchy<NDIM> > patch_hierarchy, const int coarsest_ln, const int finest_ln)
+{
+    int num_patches = 0;
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        num_patches += patch_hierarchy->getPatchLevel(ln)->getNumberOfPatches();
+    }
+    return num_patches;
+} // count_patches
+
+// Compute the maximum difference between the cached and the directly computed
+// values.
+double
+compute_max_difference(Pointer<PatchHierarchy<NDIM> > patch_hierarchy, const int u_idx, const int v_idx)
+{
+    HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(
+        patch_hierarchy, 0, patch_hierarchy->getFinestLevelNumber());
+    hier_cc_data_ops.subtract(v_idx, u_idx, v_idx);
+    return hier_cc_data_ops.maxNorm(v_idx);
+} // compute_max_difference
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "cached_cart_grid_function.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<CellVariable<NDIM, double> > u_var = new CellVariable<NDIM, double>("u");
+        const int u_idx = var_db->registerVariableAndContext(u_var, var_db->getContext("context"), IntVector<NDIM>(1));
+        const int v_idx = var_db->registerClonedPatchDataIndex(u_var, u_idx);
+        DataAllocator data_allocator({ u_idx, v_idx });
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               &data_allocator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Initialize the AMR patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int tag_buffer = 1;
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+        int finest_ln = patch_hierarchy->getFinestLevelNumber();
+
+        Pointer<CartGridFunction> u_fcn =
+            new muParserCartGridFunction("u_fcn", app_initializer->getComponentDatabase("u"), grid_geometry);
+        Pointer<CountingFunction> counting_fcn = new CountingFunction(u_fcn);
+        Pointer<CachedCartGridFunction> cached_fcn = new CachedCartGridFunction("cached_fcn", counting_fcn);
+        pout << "cached function is time-independent:      " << (!cached_fcn->isTimeDependent() ? "OK" : "FAILED")
+             << "\n";
+
+        // The first evaluation computes the values on every patch.
+        cached_fcn->setDataOnPatchHierarchy(u_idx, u_var, patch_hierarchy, 0.0);
+        const int num_first_evals = counting_fcn->getNumberOfEvaluations();
+        pout << "first evaluation computes every patch:    "
+             << (num_first_evals == count_patches(patch_hierarchy, 0, finest_ln) ? "OK" : "FAILED") << "\n";
+
+        // Subsequent evaluations copy the cached values.
+        HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(patch_hierarchy, 0, finest_ln);
+        hier_cc_data_ops.setToScalar(u_idx, 0.0);
+        cached_fcn->setDataOnPatchHierarchy(u_idx, u_var, patch_hierarchy, 1.0);
+        const int num_second_evals = counting_fcn->getNumberOfEvaluations();
+        pout << "second evaluation uses the cache:         " << (num_second_evals == num_first_evals ? "OK" : "FAILED")
+             << "\n";
+        u_fcn->setDataOnPatchHierarchy(v_idx, u_var, patch_hierarchy, 1.0);
+        pout << "cached values are correct:                "
+             << (compute_max_difference(patch_hierarchy, u_idx, v_idx) == 0.0 ? "OK" : "FAILED") << "\n";
+
+        // Regridding replaces the patches on the finer levels but not on the
+        // coarsest level, so only the values on the finer levels are
+        // recomputed.
+        Array<int> tag_buffer_array(gridding_algorithm->getMaxLevels());
+        for (int k = 0; k < tag_buffer_array.size(); ++k) tag_buffer_array[k] = tag_buffer;
+        gridding_algorithm->regridAllFinerLevels(patch_hierarchy, 0, 1.0, tag_buffer_array);
+        finest_ln = patch_hierarchy->getFinestLevelNumber();
+        cached_fcn->setDataOnPatchHierarchy(u_idx, u_var, patch_hierarchy, 2.0);
+        const int num_regrid_evals = counting_fcn->getNumberOfEvaluations() - num_second_evals;
+        pout << "regrid recomputes only the finer levels:  "
+             << (finest_ln > 0 && num_regrid_evals == count_patches(patch_hierarchy, 1, finest_ln) ? "OK" : "FAILED")
+             << "\n";
+        u_fcn->setDataOnPatchHierarchy(v_idx, u_var, patch_hierarchy, 2.0);
+        pout << "values after regrid are correct:          "
+             << (compute_max_difference(patch_hierarchy, u_idx, v_idx) == 0.0 ? "OK" : "FAILED") << "\n";
+
+        cached_fcn->clearCache(patch_hierarchy);
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+} // main
@@ -76,10 +76,14 @@ test_cube(LibMeshInit& init,
         const std::vector<double>& JxW = jc_1.get_JxW(*elem_iter);
         const std::vector<double>& JxW_2 = jc_2.get_JxW(*elem_iter);
         const std::vector<double>& JxW_3 = fe_map.get_JxW();
+        // the second call returns stored values
+        jc_2.get_cached_JxW(*elem_iter);
+        const std::vector<double>& JxW_4 = jc_2.get_cached_JxW(*elem_iter);
         for (unsigned int i = 0; i < JxW.size(); ++i)
         {
             TBOX_ASSERT(std::abs(JxW[i] - JxW_2[i]) < 1e-14 * std::max(1.0, std::abs(JxW[i])));
             TBOX_ASSERT(std::abs(JxW[i] - JxW_3[i]) < 1e-14 * std::max(1.0, std::abs(JxW[i])));
+            TBOX_ASSERT(JxW_2[i] == JxW_4[i]);
         }
         volume += std::accumulate(JxW.begin(), JxW.end(), 0.0);
         volume_2 += std::accumulate(JxW_2.begin(), JxW_2.end(), 0.0);
@@ -172,10 +176,14 @@ test_circle(LibMeshInit& init,
         const std::vector<double>& JxW = jc_1.get_JxW(*elem_iter);
         const std::vector<double>& JxW_2 = jc_2.get_JxW(*elem_iter);
         const std::vector<double>& JxW_3 = fe_map.get_JxW();
+        // the second call returns stored values
+        jc_2.get_cached_JxW(*elem_iter);
+        const std::vector<double>& JxW_4 = jc_2.get_cached_JxW(*elem_iter);
         for (unsigned int i = 0; i < JxW.size(); ++i)
         {
             TBOX_ASSERT(std::abs(JxW[i] - JxW_2[i]) < 1e-14 * std::max(1.0, std::abs(JxW[i])));
             TBOX_ASSERT(std::abs(JxW[i] - JxW_3[i]) < 1e-14 * std::max(1.0, std::abs(JxW[i])));
+            TBOX_ASSERT(JxW_2[i] == JxW_4[i]);
         }
         volume += std::accumulate(JxW.begin(), JxW.end(), 0.0);
         volume_2 += std::accumulate(JxW_2.begin(), JxW_2.end(), 0.0);
@@ -309,8 +317,7 @@ main(int argc, char** argv)
         {
             plog << "Test " << test_n << ": HEX8 square" << std::endl;
             const key_type key(HEX8, QGAUSS, THIRD);
-            // HEX8 doesn't have a custom calculator yet
-            LagrangeJacobianCalculator<3> jac_calc_1(key);
+            Hex8JacobianCalculator jac_calc_1(key);
             LagrangeJacobianCalculator<3> jac_calc_2(key);
             const key_type boundary_key(QUAD4, QGAUSS, THIRD);
             LagrangeJacobianCalculator<2, 3> jac_calc_b(boundary_key);
@@ -321,8 +328,7 @@ main(int argc, char** argv)
         {
             plog << "Test " << test_n << ": HEX8 circle" << std::endl;
             const key_type key(HEX8, QGAUSS, THIRD);
-            // HEX8 doesn't have a custom calculator yet
-            LagrangeJacobianCalculator<3> jac_calc_1(key);
+            Hex8JacobianCalculator jac_calc_1(key);
             LagrangeJacobianCalculator<3> jac_calc_2(key);
             const key_type boundary_key(QUAD4, QGAUSS, THIRD);
             LagrangeJacobianCalculator<2, 3> jac_calc_b(boundary_key);
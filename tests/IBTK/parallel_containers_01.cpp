@@ -0,0 +1,218 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2019 - 2019 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/ParallelEdgeMap.h>
+#include <ibtk/ParallelMap.h>
+#include <ibtk/ParallelSet.h>
+#include <ibtk/Streamable.h>
+#include <ibtk/StreamableFactory.h>
+#include <ibtk/StreamableManager.h>
+
+#include <tbox/AbstractStream.h>
+#include <tbox/SAMRAIManager.h>
+#include <tbox/SAMRAI_MPI.h>
+
+#include <fstream>
+#include <map>
+#include <set>
+#include <utility>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+// Test that ParallelMap, ParallelSet, and ParallelEdgeMap give the same
+// contents on every process when entries are added and removed on different
+// processes. In particular, an entry that is added or removed on one process
+// must be added or removed exactly once on every process.
+
+namespace
+{
+// A minimal Streamable that stores a single integer.
+class TestItem : public Streamable
+{
+public:
+    static int STREAMABLE_CLASS_ID;
+
+    TestItem(const int value) : d_value(value)
+    {
+    }
+
+    int getStreamableClassID() const override
+    {
+        return STREAMABLE_CLASS_ID;
+    }
+
+    size_t getDataStreamSize() const override
+    {
+        return AbstractStream::sizeofInt();
+    }
+
+    void packStream(AbstractStream& stream) override
+    {
+        stream.pack(&d_value, 1);
+        return;
+    }
+
+    int d_value;
+};
+
+int TestItem::STREAMABLE_CLASS_ID = StreamableManager::getUnregisteredID();
+
+class TestItemFactory : public StreamableFactory
+{
+public:
+    int getStreamableClassID() const override
+    {
+        return TestItem::STREAMABLE_CLASS_ID;
+    }
+
+    void setStreamableClassID(const int class_id) override
+    {
+        TestItem::STREAMABLE_CLASS_ID = class_id;
+        return;
+    }
+
+    Pointer<Streamable> unpackStream(AbstractStream& stream, const IntVector<NDIM>& /*offset*/) override
+    {
+        int value;
+        stream.unpack(&value, 1);
+        return new TestItem(value);
+    }
+};
+
+// Check that the map has exactly the expected keys, each of which stores
+// twice its key.
+bool
+check_map(const ParallelMap& map, const std::set<int>& keys)
+{
+    if (map.getMap().size() != keys.size()) return false;
+    for (const auto& entry : map.getMap())
+    {
+        Pointer<TestItem> item = entry.second;
+        if (!keys.count(entry.first) || !item || item->d_value != 2 * entry.first) return false;
+    }
+    return true;
+} // check_map
+
+bool
+check_edge_map(const ParallelEdgeMap& edge_map, const std::multimap<int, std::pair<int, int> >& edges)
+{
+    return edge_map.getEdgeMap() == edges;
+} // check_edge_map
+
+const char*
+result(const bool ok)
+{
+    return SAMRAI_MPI::minReduction(ok ? 1 : 0) == 1 ? "OK" : "FAILED";
+} // result
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "parallel_containers.log");
+        const int rank = SAMRAI_MPI::getRank();
+        const int nodes = SAMRAI_MPI::getNodes();
+        TestItem::STREAMABLE_CLASS_ID = StreamableManager::getManager()->registerFactory(new TestItemFactory());
+
+        ParallelMap map;
+        ParallelSet set;
+        ParallelEdgeMap edge_map;
+        std::set<int> map_keys, set_keys;
+        std::multimap<int, std::pair<int, int> > edges;
+
+        // Each process adds a different number of entries. Every process adds
+        // the same key to the set, which must be stored only once.
+        for (int r = 0; r < nodes; ++r)
+        {
+            for (int i = 0; i <= r; ++i) map_keys.insert(10 * r + i);
+            set_keys.insert(r);
+            edges.insert(std::make_pair(r, std::make_pair(r, r + 1)));
+        }
+        set_keys.insert(100);
+        edges.insert(std::make_pair(0, std::make_pair(0, 100)));
+        for (int i = 0; i <= rank; ++i) map.addItem(10 * rank + i, new TestItem(2 * (10 * rank + i)));
+        set.addItem(rank);
+        set.addItem(100);
+        edge_map.addEdge(std::make_pair(rank, rank + 1));
+        if (rank == 0) edge_map.addEdge(std::make_pair(0, 100));
+        map.communicateData();
+        set.communicateData();
+        edge_map.communicateData();
+        const char* map_add_result = result(check_map(map, map_keys));
+        const char* set_add_result = result(set.getSet() == set_keys);
+        const char* edge_add_result = result(check_edge_map(edge_map, edges));
+
+        // Each process removes the entries that were added by the next
+        // process, so that every entry is removed by a process other than the
+        // one that added it.
+        const int next = (rank + 1) % nodes;
+        for (int r = 0; r < nodes; ++r)
+        {
+            map_keys.erase(10 * r);
+            set_keys.erase(r);
+        }
+        edges.clear();
+        edges.insert(std::make_pair(0, std::make_pair(0, 100)));
+        map.removeItem(10 * next);
+        set.removeItem(next);
+        edge_map.removeEdge(std::make_pair(next, next + 1));
+        map.communicateData();
+        set.communicateData();
+        edge_map.communicateData();
+        const char* map_remove_result = result(check_map(map, map_keys));
+        const char* set_remove_result = result(set.getSet() == set_keys);
+        const char* edge_remove_result = result(check_edge_map(edge_map, edges));
+
+        // Communicating without any pending changes does not modify the data.
+        map.communicateData();
+        set.communicateData();
+        edge_map.communicateData();
+        const char* no_op_result =
+            result(check_map(map, map_keys) && set.getSet() == set_keys && check_edge_map(edge_map, edges));
+
+        if (rank == 0)
+        {
+            std::ofstream out("output");
+            out << "ParallelMap additions:      " << map_add_result << "\n";
+            out << "ParallelSet additions:      " << set_add_result << "\n";
+            out << "ParallelEdgeMap additions:  " << edge_add_result << "\n";
+            out << "ParallelMap removals:       " << map_remove_result << "\n";
+            out << "ParallelSet removals:       " << set_remove_result << "\n";
+            out << "ParallelEdgeMap removals:   " << edge_remove_result << "\n";
+            out << "no pending changes:         " << no_op_result << "\n";
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+} // main
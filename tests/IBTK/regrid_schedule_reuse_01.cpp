@@ -0,0 +1,321 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2019 - 2019 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBTK_config.h>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CellData.h>
+#include <GriddingAlgorithm.h>
+#include <HierarchyCellDataOpsReal.h>
+#include <LoadBalancer.h>
+#include <SideData.h>
+#include <SideIterator.h>
+#include <StandardTagAndInitStrategy.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/HierarchyGhostCellInterpolation.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/IndexUtilities.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+#include <CellVariable.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+// Test that HierarchyGhostCellInterpolation::reinitializeOperatorState() and
+// HierarchyMathOps::resetLevels(), which reuse the cached schedules and weights
+// of levels that are not changed by a regrid, give the same ghost cell values,
+// weights, and domain volume as newly initialized objects.  The hierarchy is
+// regridded twice: first keeping the two coarsest levels, and then keeping only
+// the coarsest level.
+
+namespace
+{
+// Allocate the test data on each new patch level, and tag a fixed region of
+// the coarsest level and a movable region of the next finer level for
+// refinement.
+class TestStrategy : public StandardTagAndInitStrategy<NDIM>
+{
+public:
+    TestStrategy(std::vector<int> idxs, Pointer<CartesianGridGeometry<NDIM> > grid_geom)
+        : d_idxs(std::move(idxs)), d_grid_geom(grid_geom)
+    {
+        // intentionally blank
+    }
+
+    void setShift(const double shift)
+    {
+        d_shift = shift;
+        return;
+    }
+
+    void initializeLevelData(Pointer<BasePatchHierarchy<NDIM> > hierarchy,
+                             int level_number,
+                             double init_data_time,
+                             bool /*can_be_refined*/,
+                             bool /*initial_time*/,
+                             Pointer<BasePatchLevel<NDIM> > /*old_level*/,
+                             bool allocate_data) override
+    {
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = hierarchy;
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(level_number);
+        if (allocate_data)
+        {
+            for (const int idx : d_idxs) level->allocatePatchData(idx, init_data_time);
+        }
+        return;
+    }
+
+    void resetHierarchyConfiguration(Pointer<BasePatchHierarchy<NDIM> > /*hierarchy*/,
+                                     int /*coarsest_level*/,
+                                     int /*finest_level*/) override
+    {
+        return;
+    }
+
+    void applyGradientDetector(Pointer<BasePatchHierarchy<NDIM> > hierarchy,
+                               int level_number,
+                               double /*error_data_time*/,
+                               int tag_index,
+                               bool /*initial_time*/,
+                               bool /*uses_richardson_extrapolation_too*/) override
+    {
+        // The tagged region is [0.25, 0.75]^NDIM on level 0 and a cube of
+        // width 0.125 whose lower corner is at 0.375 + shift on level 1.
+        VectorNd x_lower, x_upper;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            x_lower[d] = level_number == 0 ? 0.25 : 0.375 + d_shift;
+            x_upper[d] = level_number == 0 ? 0.75 : 0.5 + d_shift;
+        }
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = hierarchy;
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(level_number);
+        const Box<NDIM> tag_box(IndexUtilities::getCellIndex(x_lower, d_grid_geom, level->getRatio()),
+                                IndexUtilities::getCellIndex(x_upper, d_grid_geom, level->getRatio()) -
+                                    IntVector<NDIM>(1));
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, int> > tag_data = patch->getPatchData(tag_index);
+            const Box<NDIM> box = patch->getBox() * tag_box;
+            if (!box.empty()) tag_data->fillAll(1, box);
+        }
+        return;
+    }
+
+private:
+    std::vector<int> d_idxs;
+    Pointer<CartesianGridGeometry<NDIM> > d_grid_geom;
+    double d_shift = 0.0;
+};
+
+// Compute the maximum difference between two cell-centered quantities,
+// including their ghost cells.
+double
+compute_max_cc_difference(Pointer<PatchHierarchy<NDIM> > patch_hierarchy, const int u_idx, const int v_idx)
+{
+    double max_diff = 0.0;
+    for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > u_data = patch->getPatchData(u_idx);
+            Pointer<CellData<NDIM, double> > v_data = patch->getPatchData(v_idx);
+            for (CellIterator<NDIM> ci(u_data->getGhostBox()); ci; ci++)
+            {
+                max_diff = std::max(max_diff, std::abs((*u_data)(ci()) - (*v_data)(ci())));
+            }
+        }
+    }
+    return SAMRAI_MPI::maxReduction(max_diff);
+} // compute_max_cc_difference
+
+// Compute the maximum difference between two side-centered quantities.
+double
+compute_max_sc_difference(Pointer<PatchHierarchy<NDIM> > patch_hierarchy, const int u_idx, const int v_idx)
+{
+    double max_diff = 0.0;
+    for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<SideData<NDIM, double> > u_data = patch->getPatchData(u_idx);
+            Pointer<SideData<NDIM, double> > v_data = patch->getPatchData(v_idx);
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
+                for (SideIterator<NDIM> si(patch->getBox(), axis); si; si++)
+                {
+                    max_diff = std::max(max_diff, std::abs((*u_data)(si()) - (*v_data)(si())));
+                }
+            }
+        }
+    }
+    return SAMRAI_MPI::maxReduction(max_diff);
+} // compute_max_sc_difference
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "regrid_schedule_reuse.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const double shift = input_db->getDouble("SHIFT");
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<CellVariable<NDIM, double> > u_var = new CellVariable<NDIM, double>("u");
+        const int u_idx = var_db->registerVariableAndContext(u_var, var_db->getContext("context"), IntVector<NDIM>(2));
+        const int v_idx = var_db->registerClonedPatchDataIndex(u_var, u_idx);
+        const int w_idx = var_db->registerClonedPatchDataIndex(u_var, u_idx);
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        TestStrategy test_strategy({ u_idx, v_idx, w_idx }, grid_geometry);
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               &test_strategy,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Initialize the AMR patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int tag_buffer = 1;
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+        Array<int> tag_buffer_array(gridding_algorithm->getMaxLevels());
+        for (int k = 0; k < tag_buffer_array.size(); ++k) tag_buffer_array[k] = tag_buffer;
+
+        // Set up the objects that are reused across regrids.
+        Pointer<CartGridFunction> u_fcn =
+            new muParserCartGridFunction("u_fcn", app_initializer->getComponentDatabase("u"), grid_geometry);
+        using InterpolationTransactionComponent = HierarchyGhostCellInterpolation::InterpolationTransactionComponent;
+        const InterpolationTransactionComponent u_transaction(
+            u_idx, "CONSERVATIVE_LINEAR_REFINE", true, "CONSERVATIVE_COARSEN", "LINEAR", false, nullptr);
+        const InterpolationTransactionComponent v_transaction(
+            v_idx, "CONSERVATIVE_LINEAR_REFINE", true, "CONSERVATIVE_COARSEN", "LINEAR", false, nullptr);
+        Pointer<HierarchyGhostCellInterpolation> reused_ghost_fill = new HierarchyGhostCellInterpolation();
+        reused_ghost_fill->initializeOperatorState(u_transaction, patch_hierarchy);
+        HierarchyMathOps reused_math_ops("reused_math_ops", patch_hierarchy);
+        const int reused_wgt_cc_idx = reused_math_ops.getCellWeightPatchDescriptorIndex();
+        const int reused_wgt_sc_idx = reused_math_ops.getSideWeightPatchDescriptorIndex();
+
+        // Regrid while keeping levels 0, ..., coarsest_kept_ln, and compare the
+        // reused objects with newly initialized ones.
+        const std::vector<int> coarsest_kept_lns = { 1, 0 };
+        for (unsigned int k = 0; k < coarsest_kept_lns.size(); ++k)
+        {
+            const int coarsest_kept_ln = coarsest_kept_lns[k];
+            const double time = static_cast<double>(k + 1);
+            std::vector<Pointer<PatchLevel<NDIM> > > old_levels;
+            for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+            {
+                old_levels.push_back(patch_hierarchy->getPatchLevel(ln));
+            }
+            test_strategy.setShift(time * shift);
+            gridding_algorithm->regridAllFinerLevels(patch_hierarchy, coarsest_kept_ln, time, tag_buffer_array);
+            const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+            bool levels_kept = finest_ln == static_cast<int>(old_levels.size()) - 1;
+            for (int ln = 0; levels_kept && ln <= finest_ln; ++ln)
+            {
+                Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+                levels_kept = (level.getPointer() == old_levels[ln].getPointer()) == (ln <= coarsest_kept_ln);
+            }
+
+            // Fill the ghost cells of two copies of the same data with the
+            // reused and with a new ghost cell interpolation object.
+            u_fcn->setDataOnPatchHierarchy(w_idx, u_var, patch_hierarchy, time);
+            HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(patch_hierarchy, 0, finest_ln);
+            for (const int idx : { u_idx, v_idx })
+            {
+                hier_cc_data_ops.setToScalar(idx, 0.0, /*interior_only*/ false);
+                hier_cc_data_ops.copyData(idx, w_idx);
+            }
+            reused_ghost_fill->reinitializeOperatorState(patch_hierarchy);
+            reused_ghost_fill->fillData(time);
+            Pointer<HierarchyGhostCellInterpolation> new_ghost_fill = new HierarchyGhostCellInterpolation();
+            new_ghost_fill->initializeOperatorState(v_transaction, patch_hierarchy);
+            new_ghost_fill->fillData(time);
+            const double ghost_fill_diff = compute_max_cc_difference(patch_hierarchy, u_idx, v_idx);
+
+            // Compare the weights and the domain volume with those computed by a
+            // new math operations object.
+            reused_math_ops.setPatchHierarchy(patch_hierarchy);
+            reused_math_ops.resetLevels(0, finest_ln);
+            HierarchyMathOps new_math_ops("new_math_ops_" + std::to_string(k), patch_hierarchy);
+            const double wgt_cc_diff = compute_max_cc_difference(
+                patch_hierarchy, reused_wgt_cc_idx, new_math_ops.getCellWeightPatchDescriptorIndex());
+            const double wgt_sc_diff = compute_max_sc_difference(
+                patch_hierarchy, reused_wgt_sc_idx, new_math_ops.getSideWeightPatchDescriptorIndex());
+            const double volume_diff =
+                std::abs(reused_math_ops.getVolumeOfPhysicalDomain() - new_math_ops.getVolumeOfPhysicalDomain());
+
+            pout << "regrid keeping levels 0 through " << coarsest_kept_ln << ":\n";
+            pout << "  coarser levels kept, finer levels replaced: " << (levels_kept ? "OK" : "FAILED") << "\n";
+            pout << "  ghost cell values match new operator:       " << (ghost_fill_diff == 0.0 ? "OK" : "FAILED")
+                 << "\n";
+            pout << "  cell weights match new operator:            " << (wgt_cc_diff == 0.0 ? "OK" : "FAILED") << "\n";
+            pout << "  side weights match new operator:            " << (wgt_sc_diff == 0.0 ? "OK" : "FAILED") << "\n";
+            pout << "  domain volume matches new operator:         " << (volume_diff == 0.0 ? "OK" : "FAILED") << "\n";
+        }
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+} // main
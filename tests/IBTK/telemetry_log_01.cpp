@@ -0,0 +1,148 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2019 - 2019 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/TelemetryLog.h>
+
+#include <tbox/SAMRAIManager.h>
+#include <tbox/SAMRAI_MPI.h>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+// Test that TelemetryLog writes the recorded phases and values of each time step
+// to one CSV file per process, that repeated values within a record are summed,
+// and that the summary file contains the minimum, mean, and maximum of each
+// quantity over all processes.
+
+namespace
+{
+// Read all lines of a file.
+std::vector<std::string>
+read_lines(const std::string& file_name)
+{
+    std::vector<std::string> lines;
+    std::ifstream in(file_name);
+    std::string line;
+    while (std::getline(in, line)) lines.push_back(line);
+    return lines;
+} // read_lines
+
+// Check whether the string starts with the specified prefix.
+bool
+starts_with(const std::string& str, const std::string& prefix)
+{
+    return str.compare(0, prefix.size(), prefix) == 0;
+} // starts_with
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "telemetry_log.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const std::string file_name = input_db->getString("TELEMETRY_FILE_NAME");
+        const int num_steps = input_db->getInteger("NUM_STEPS");
+        const int rank = SAMRAI_MPI::getRank();
+        const int nodes = SAMRAI_MPI::getNodes();
+
+        // Record one phase and two quantities in each step.  The value of the
+        // quantity "value" is recorded twice in each step.
+        {
+            TelemetryLog telemetry(file_name, /*write_summary*/ true);
+            for (int step = 0; step < num_steps; ++step)
+            {
+                telemetry.beginRecord(step, 0.5 * step, 0.5);
+                telemetry.startPhase("phase");
+                telemetry.stopPhase("phase");
+                telemetry.addValue("value", rank + 1);
+                telemetry.addValue("step", step);
+                telemetry.addValue("value", rank + 1);
+                telemetry.endRecord();
+            }
+
+            // Values that are recorded outside of a record are ignored.
+            telemetry.addValue("ignored", 1.0);
+        }
+
+        // Check the file written by this process.  Quantities are written in the
+        // order in which they are first recorded.
+        const std::vector<std::string> lines = read_lines(file_name + "." + std::to_string(rank) + ".csv");
+        int header_ok = !lines.empty() && lines[0] == "step,time,dt,quantity,value";
+        int records_ok = lines.size() == static_cast<std::size_t>(1 + 3 * num_steps);
+        int sum_ok = records_ok;
+        for (int step = 0; records_ok && step < num_steps; ++step)
+        {
+            std::ostringstream prefix_stream;
+            prefix_stream << step << "," << 0.5 * step << "," << 0.5 << ",";
+            const std::string prefix = prefix_stream.str();
+            records_ok = records_ok && starts_with(lines[1 + 3 * step], prefix + "phase,") &&
+                         lines[3 + 3 * step] == prefix + "step," + std::to_string(step);
+            sum_ok = sum_ok && lines[2 + 3 * step] == prefix + "value," + std::to_string(2 * (rank + 1));
+        }
+        header_ok = SAMRAI_MPI::minReduction(header_ok);
+        records_ok = SAMRAI_MPI::minReduction(records_ok);
+        sum_ok = SAMRAI_MPI::minReduction(sum_ok);
+
+        if (rank == 0)
+        {
+            // Check the summary of the last step, in which the minimum, mean,
+            // and maximum of "value" are 2, nodes + 1, and 2 * nodes.
+            const std::vector<std::string> summary_lines = read_lines(file_name + ".summary.csv");
+            const bool summary_header_ok =
+                !summary_lines.empty() && summary_lines[0] == "step,time,dt,quantity,min,mean,max";
+            const bool summary_records_ok = summary_lines.size() == static_cast<std::size_t>(1 + 3 * num_steps);
+            const std::string last_step = std::to_string(num_steps - 1);
+            const bool summary_values_ok =
+                summary_records_ok &&
+                summary_lines[summary_lines.size() - 2].find(",value,2," + std::to_string(nodes + 1) + "," +
+                                                             std::to_string(2 * nodes)) != std::string::npos &&
+                summary_lines.back().find(",step," + last_step + "," + last_step + "," + last_step) !=
+                    std::string::npos;
+
+            std::ofstream out("output");
+            out << "per-process file header:     " << (header_ok ? "OK" : "FAILED") << "\n";
+            out << "per-process file records:    " << (records_ok ? "OK" : "FAILED") << "\n";
+            out << "repeated values are summed:  " << (sum_ok ? "OK" : "FAILED") << "\n";
+            out << "summary file header:         " << (summary_header_ok ? "OK" : "FAILED") << "\n";
+            out << "summary file records:        " << (summary_records_ok ? "OK" : "FAILED") << "\n";
+            out << "summary min/mean/max:        " << (summary_values_ok ? "OK" : "FAILED") << "\n";
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+} // main
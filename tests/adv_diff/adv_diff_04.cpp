@@ -0,0 +1,174 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2019 - 2019 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/AdvDiffSemiImplicitHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/CCPoissonSolverManager.h>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+#include "QInit.h"
+#include "UFunction.h"
+
+// Test for Helmholtz solver sharing in AdvDiffSemiImplicitHierarchyIntegrator
+// (share_helmholtz_solvers = TRUE). Three copies of the same scalar are
+// transported: Q1 and Q2 share a Helmholtz solver, while Q3 uses a solver
+// provided by the user, which must not be replaced by the shared one. All three
+// quantities must agree with each other up to the solver tolerance.
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        // prevent a warning about timer initializations
+        TimerManager::createManager(nullptr);
+
+        // Parse command line options, set some standard options from the input
+        // file, initialize the restart database (if this is a restarted run),
+        // and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "adv_diff.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.
+        Pointer<Database> integrator_db =
+            app_initializer->getComponentDatabase("AdvDiffSemiImplicitHierarchyIntegrator");
+        Pointer<AdvDiffHierarchyIntegrator> time_integrator =
+            new AdvDiffSemiImplicitHierarchyIntegrator("AdvDiffSemiImplicitHierarchyIntegrator", integrator_db);
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Setup the advection velocity.
+        Pointer<FaceVariable<NDIM, double> > u_var = new FaceVariable<NDIM, double>("u");
+        UFunction u_fcn("UFunction", grid_geometry, app_initializer->getComponentDatabase("UFunction"));
+        time_integrator->registerAdvectionVelocity(u_var);
+        time_integrator->setAdvectionVelocityIsDivergenceFree(u_var, true);
+        time_integrator->setAdvectionVelocityFunction(u_var, Pointer<CartGridFunction>(&u_fcn, false));
+
+        // Setup three identical advected and diffused quantities.
+        QInit Q_init("QInit", grid_geometry, app_initializer->getComponentDatabase("QInit"));
+        const double kappa = app_initializer->getComponentDatabase("QInit")->getDouble("kappa");
+        std::vector<Pointer<CellVariable<NDIM, double> > > Q_vars;
+        for (const std::string& name : { "Q1", "Q2", "Q3" })
+        {
+            Pointer<CellVariable<NDIM, double> > Q_var = new CellVariable<NDIM, double>(name);
+            time_integrator->registerTransportedQuantity(Q_var);
+            time_integrator->setAdvectionVelocity(Q_var, u_var);
+            time_integrator->setDiffusionCoefficient(Q_var, kappa);
+            time_integrator->setInitialConditions(Q_var, Pointer<CartGridFunction>(&Q_init, false));
+            Q_vars.push_back(Q_var);
+        }
+
+        // Provide a solver for Q3, set up in the same way as the default one.
+        Pointer<PoissonSolver> Q3_solver =
+            CCPoissonSolverManager::getManager()->allocateSolver(integrator_db->getString("helmholtz_solver_type"),
+                                                                 "Q3_helmholtz_solver",
+                                                                 integrator_db->getDatabase("helmholtz_solver_db"),
+                                                                 "q3_",
+                                                                 integrator_db->getString("helmholtz_precond_type"),
+                                                                 "Q3_helmholtz_precond",
+                                                                 integrator_db->getDatabase("helmholtz_precond_db"),
+                                                                 "q3_pc_");
+        time_integrator->setHelmholtzSolver(Q_vars[2], Q3_solver);
+
+        // Initialize hierarchy configuration and data on all patches.
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+        // Main time step loop.
+        double loop_time = time_integrator->getIntegratorTime();
+        const double loop_time_end = time_integrator->getEndTime();
+        while (!MathUtilities<double>::equalEps(loop_time, loop_time_end) && time_integrator->stepsRemaining())
+        {
+            const double dt = time_integrator->getMaximumTimeStepSize();
+            time_integrator->advanceHierarchy(dt);
+            loop_time += dt;
+        }
+
+        // Compare the quantities with each other.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        const Pointer<VariableContext> Q_ctx = time_integrator->getCurrentContext();
+        std::vector<int> Q_idxs;
+        for (const auto& Q_var : Q_vars) Q_idxs.push_back(var_db->mapVariableAndContextToIndex(Q_var, Q_ctx));
+        const int diff_idx = var_db->registerClonedPatchDataIndex(Q_vars[0], Q_idxs[0]);
+
+        const int coarsest_ln = 0;
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            patch_hierarchy->getPatchLevel(ln)->allocatePatchData(diff_idx, loop_time);
+        }
+        HierarchyMathOps hier_math_ops("HierarchyMathOps", patch_hierarchy);
+        hier_math_ops.setPatchHierarchy(patch_hierarchy);
+        hier_math_ops.resetLevels(coarsest_ln, finest_ln);
+        const int wgt_idx = hier_math_ops.getCellWeightPatchDescriptorIndex();
+        HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(patch_hierarchy, coarsest_ln, finest_ln);
+
+        const double Q1_norm = hier_cc_data_ops.maxNorm(Q_idxs[0], wgt_idx);
+        hier_cc_data_ops.subtract(diff_idx, Q_idxs[1], Q_idxs[0]);
+        const double shared_diff = hier_cc_data_ops.maxNorm(diff_idx, wgt_idx) / Q1_norm;
+        hier_cc_data_ops.subtract(diff_idx, Q_idxs[2], Q_idxs[0]);
+        const double user_diff = hier_cc_data_ops.maxNorm(diff_idx, wgt_idx) / Q1_norm;
+        pout << "relative difference between Q2 and Q1: " << shared_diff << "\n"
+             << "relative difference between Q3 and Q1: " << user_diff << "\n";
+
+        const double tol = 1.0e-10;
+        if (SAMRAI_MPI::getRank() == 0)
+        {
+            std::ofstream out("output");
+            out << "Q1 is nonzero:                      " << (Q1_norm > 0.0 ? "OK" : "FAILED") << "\n"
+                << "shared solver matches Q1:           " << (shared_diff < tol ? "OK" : "FAILED") << "\n"
+                << "user-provided solver matches Q1:    " << (user_diff < tol ? "OK" : "FAILED") << "\n";
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+} // main
@@ -0,0 +1,278 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2019 - 2019 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+
+// Headers for major SAMRAI objects
+#include "ibtk/muParserCartGridFunction.h"
+
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <HierarchyCellDataOpsReal.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include "ibamr/CFGiesekusRelaxation.h"
+#include "ibamr/CFOldroydBRelaxation.h"
+#include "ibamr/CFRoliePolyRelaxation.h"
+#include "ibamr/ibamr_enums.h"
+#include "ibamr/namespaces.h"
+
+#include <ibtk/AppInitializer.h>
+
+#include <cmath>
+#include <fstream>
+#include <limits>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+// A test program to check that the step-averaged (implicit) relaxation computed
+// by CFRelaxationOperator converges at first order to the explicitly evaluated
+// relaxation function as the time step size is refined. The program also takes
+// several time steps that are much larger than the relaxation time, for which
+// forward Euler steps with the explicitly evaluated relaxation blow up but steps
+// with the step-averaged relaxation remain bounded by the initial conformation.
+
+namespace
+{
+// Compute the maximum difference between the data stored in two patch data
+// indices (or, if v_idx is invalid, the maximum of the data stored in u_idx) on
+// all levels of the patch hierarchy.
+double
+compute_max_difference(Pointer<PatchHierarchy<NDIM> > patch_hierarchy, const int u_idx, const int v_idx)
+{
+    double max_diff = 0.0;
+    for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > u_data = patch->getPatchData(u_idx);
+            Pointer<CellData<NDIM, double> > v_data;
+            if (v_idx != IBTK::invalid_index) v_data = patch->getPatchData(v_idx);
+            for (CellIterator<NDIM> ci(patch->getBox()); ci; ci++)
+            {
+                const CellIndex<NDIM>& idx = ci();
+                for (int d = 0; d < u_data->getDepth(); ++d)
+                {
+                    const double v = v_data ? (*v_data)(idx, d) : 0.0;
+                    max_diff = std::max(max_diff, std::abs((*u_data)(idx, d) - v));
+                }
+            }
+        }
+    }
+    return SAMRAI_MPI::maxReduction(max_diff);
+} // compute_max_difference
+
+// Compute the maximum norm of the data stored in a patch data index on all
+// levels of the patch hierarchy, or infinity if the data are not finite.
+double
+compute_max_norm(Pointer<PatchHierarchy<NDIM> > patch_hierarchy, const int u_idx)
+{
+    double max_norm = 0.0;
+    for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > u_data = patch->getPatchData(u_idx);
+            for (CellIterator<NDIM> ci(patch->getBox()); ci; ci++)
+            {
+                for (int d = 0; d < u_data->getDepth(); ++d)
+                {
+                    const double u = (*u_data)(ci(), d);
+                    max_norm = std::isfinite(u) ? std::max(max_norm, std::abs(u)) :
+                                                  std::numeric_limits<double>::infinity();
+                }
+            }
+        }
+    }
+    return SAMRAI_MPI::maxReduction(max_norm);
+} // compute_max_norm
+} // namespace
+
+/*******************************************************************************
+ * For each run, the input filename must be given on the command line.  In all *
+ * cases, the command line is:                                                 *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        // prevent a warning about timer initialization
+        TimerManager::createManager(nullptr);
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "cf_relaxation.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+        Pointer<CFRelaxationOperator> cf_op;
+        std::string relax_op = input_db->getString("RELAX_OP");
+        if (relax_op == "OLDROYDB")
+        {
+            cf_op = new CFOldroydBRelaxation("OldroydB", app_initializer->getComponentDatabase("ComplexFluid"));
+        }
+        else if (relax_op == "GIESEKUS")
+        {
+            cf_op = new CFGiesekusRelaxation("Giesekus", app_initializer->getComponentDatabase("ComplexFluid"));
+        }
+        else if (relax_op == "ROLIEPOLY")
+        {
+            cf_op = new CFRoliePolyRelaxation("RoliePoly", app_initializer->getComponentDatabase("ComplexFluid"));
+        }
+        else
+        {
+            TBOX_ERROR("Unknown type");
+        }
+        Pointer<CartGridFunction> c_fcn = new muParserCartGridFunction(
+            "Conformation", app_initializer->getComponentDatabase("Conformation"), grid_geometry);
+        const double dt = input_db->getDouble("DT");
+        const double tol = input_db->getDouble("TOL");
+        const double stiff_dt = input_db->getDouble("STIFF_DT");
+        const int num_stiff_steps = input_db->getInteger("NUM_STIFF_STEPS");
+
+        // Initialize the AMR patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int tag_buffer = 1;
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+
+        Pointer<CellVariable<NDIM, double> > c_var = new CellVariable<NDIM, double>("C", NDIM * (NDIM + 1) / 2);
+        auto var_db = VariableDatabase<NDIM>::getDatabase();
+        const int c_idx = var_db->registerVariableAndContext(c_var, var_db->getContext("CTX"));
+        const int r_idx = var_db->registerClonedPatchDataIndex(c_var, c_idx);
+        const int r_dt_idx = var_db->registerClonedPatchDataIndex(c_var, c_idx);
+        const int r_half_dt_idx = var_db->registerClonedPatchDataIndex(c_var, c_idx);
+        const int c_explicit_idx = var_db->registerClonedPatchDataIndex(c_var, c_idx);
+        const int c_implicit_idx = var_db->registerClonedPatchDataIndex(c_var, c_idx);
+
+        for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->allocatePatchData(c_idx);
+            level->allocatePatchData(r_idx);
+            level->allocatePatchData(r_dt_idx);
+            level->allocatePatchData(r_half_dt_idx);
+            level->allocatePatchData(c_explicit_idx);
+            level->allocatePatchData(c_implicit_idx);
+        }
+
+        // Evaluate the relaxation function explicitly and averaged over time
+        // steps of size dt and dt/2.
+        c_fcn->setDataOnPatchHierarchy(c_idx, c_var, patch_hierarchy, 0.0);
+        cf_op->setPatchDataIndex(c_idx);
+        cf_op->setDataOnPatchHierarchy(r_idx, c_var, patch_hierarchy, 0.0);
+        cf_op->setStepAveragedDataOnPatchHierarchy(r_dt_idx, c_var, patch_hierarchy, 0.0, dt);
+        cf_op->setStepAveragedDataOnPatchHierarchy(r_half_dt_idx, c_var, patch_hierarchy, 0.0, 0.5 * dt);
+
+        const double r_max_norm = compute_max_difference(patch_hierarchy, r_idx, IBTK::invalid_index);
+        const double e_dt = compute_max_difference(patch_hierarchy, r_dt_idx, r_idx);
+        const double e_half_dt = compute_max_difference(patch_hierarchy, r_half_dt_idx, r_idx);
+        const double order = std::log2(e_dt / e_half_dt);
+
+        // Take time steps that are much larger than the relaxation time with
+        // the explicitly evaluated and with the step-averaged relaxation.
+        HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(patch_hierarchy);
+        hier_cc_data_ops.copyData(c_explicit_idx, c_idx);
+        hier_cc_data_ops.copyData(c_implicit_idx, c_idx);
+        const double c_max_norm = compute_max_norm(patch_hierarchy, c_idx);
+        double c_implicit_max_norm = 0.0;
+        int num_unconverged_solves = 0;
+        for (int k = 0; k < num_stiff_steps; ++k)
+        {
+            cf_op->setPatchDataIndex(c_explicit_idx);
+            cf_op->setDataOnPatchHierarchy(r_idx, c_var, patch_hierarchy, 0.0);
+            hier_cc_data_ops.axpy(c_explicit_idx, stiff_dt, r_idx, c_explicit_idx);
+
+            cf_op->setPatchDataIndex(c_implicit_idx);
+            cf_op->setStepAveragedDataOnPatchHierarchy(r_dt_idx, c_var, patch_hierarchy, 0.0, stiff_dt);
+            num_unconverged_solves += static_cast<int>(cf_op->getNumberOfUnconvergedRelaxationSolves());
+            hier_cc_data_ops.axpy(c_implicit_idx, stiff_dt, r_dt_idx, c_implicit_idx);
+            c_implicit_max_norm = std::max(c_implicit_max_norm, compute_max_norm(patch_hierarchy, c_implicit_idx));
+        }
+        num_unconverged_solves = SAMRAI_MPI::sumReduction(num_unconverged_solves);
+        const double c_explicit_max_norm = compute_max_norm(patch_hierarchy, c_explicit_idx);
+
+        if (SAMRAI_MPI::getRank() == 0)
+        {
+            std::ofstream out("output");
+            out << "|R|_oo > 0:                       " << (r_max_norm > 0.0 ? "OK" : "FAILED") << "\n";
+            out << "|R_dt - R|_oo / |R|_oo < tol:     " << (e_dt < tol * r_max_norm ? "OK" : "FAILED") << "\n";
+            out << "first order convergence in dt:    " << (std::abs(order - 1.0) < 0.1 ? "OK" : "FAILED") << "\n";
+            out << "large dt, explicit blows up:      "
+                << (!(c_explicit_max_norm < 1.0e3 * c_max_norm) ? "OK" : "FAILED") << "\n";
+            out << "large dt, implicit is bounded:    " << (c_implicit_max_norm <= c_max_norm ? "OK" : "FAILED")
+                << "\n";
+            out << "large dt, Newton converged:       " << (num_unconverged_solves == 0 ? "OK" : "FAILED") << "\n";
+        }
+
+        for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->deallocatePatchData(c_idx);
+            level->deallocatePatchData(r_idx);
+            level->deallocatePatchData(r_dt_idx);
+            level->deallocatePatchData(r_half_dt_idx);
+            level->deallocatePatchData(c_explicit_idx);
+            level->deallocatePatchData(c_implicit_idx);
+        }
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return 0;
+} // main
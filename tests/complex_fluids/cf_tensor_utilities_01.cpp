@@ -0,0 +1,184 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2019 - 2019 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include "ibamr/CFTensorUtilities.h"
+
+#include <ibtk/AppInitializer.h>
+
+#include <Eigen/Cholesky>
+
+#include <fstream>
+#include <random>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// A test program to check the closed-form symmetric tensor kernels in
+// CFTensorUtilities against the general purpose Eigen routines on random
+// symmetric tensors.
+
+namespace
+{
+// Generate a random symmetric tensor with entries in [-scale, scale].
+MatrixNd
+random_symmetric_tensor(std::mt19937& rng, const double scale)
+{
+    MatrixNd mat;
+    for (int i = 0; i < NDIM; ++i)
+    {
+        for (int j = i; j < NDIM; ++j)
+        {
+            const double r = static_cast<double>(rng()) / static_cast<double>(std::mt19937::max());
+            mat(i, j) = mat(j, i) = scale * (2.0 * r - 1.0);
+        }
+    }
+    return mat;
+} // random_symmetric_tensor
+
+// Compute the reference eigendecomposition with Eigen's iterative solver.
+void
+reference_eigen_decomposition(const MatrixNd& mat, VectorNd& eig_vals, MatrixNd& eig_vecs)
+{
+    Eigen::SelfAdjointEigenSolver<MatrixNd> eigs(mat);
+    eig_vals = eigs.eigenvalues();
+    eig_vecs = eigs.eigenvectors();
+    return;
+} // reference_eigen_decomposition
+
+// Compute the relative difference between two tensors in the Frobenius norm.
+double
+relative_error(const MatrixNd& mat, const MatrixNd& mat_ref)
+{
+    return (mat - mat_ref).norm() / std::max(mat_ref.norm(), 1.0);
+} // relative_error
+
+// Test the kernels on a sample of random tensors and report the results.
+void
+test_tensor_kernels(std::ostream& out, const int num_samples, const unsigned int seed, const double tol)
+{
+    std::mt19937 rng(seed);
+    double max_eig_val_err = 0.0, max_eig_vec_err = 0.0, max_exp_err = 0.0, max_proj_err = 0.0;
+    int num_pd = 0, num_pd_agree = 0, num_not_pd = 0, num_not_pd_agree = 0;
+    for (int k = 0; k < num_samples; ++k)
+    {
+        // Cycle between indefinite tensors, positive definite tensors of the
+        // form A*A^T + c*I, and tensors with nearly repeated eigenvalues.
+        MatrixNd mat = random_symmetric_tensor(rng, 2.0);
+        if (k % 3 == 1) mat = mat * mat.transpose() + 0.1 * MatrixNd::Identity();
+        if (k % 3 == 2) mat = 1.5 * MatrixNd::Identity() + 1.0e-6 * mat;
+
+        VectorNd eig_vals_ref;
+        MatrixNd eig_vecs_ref;
+        reference_eigen_decomposition(mat, eig_vals_ref, eig_vecs_ref);
+
+        // Eigenvalues and eigenvectors.  The eigenvectors are only unique up to
+        // sign, so we check that they diagonalize the tensor.
+        VectorNd eig_vals;
+        MatrixNd eig_vecs;
+        CFTensorUtilities::computeEigenDecomposition(mat, eig_vals, eig_vecs);
+        max_eig_val_err = std::max(max_eig_val_err, (eig_vals - eig_vals_ref).norm() / mat.norm());
+        max_eig_vec_err = std::max(max_eig_vec_err,
+                                   relative_error(eig_vecs * eig_vals_ref.asDiagonal() * eig_vecs.transpose(), mat));
+        max_eig_vec_err = std::max(max_eig_vec_err,
+                                   relative_error(eig_vecs.transpose() * eig_vecs, MatrixNd::Identity()));
+
+        // Exponential.
+        VectorNd exp_eig_vals_ref = eig_vals_ref.array().exp().matrix();
+        const MatrixNd exp_mat_ref = eig_vecs_ref * exp_eig_vals_ref.asDiagonal() * eig_vecs_ref.transpose();
+        max_exp_err = std::max(max_exp_err, relative_error(CFTensorUtilities::exponentiate(mat), exp_mat_ref));
+
+        // Positive definiteness, which we compare to whether or not a Cholesky
+        // factorization exists.  Tensors that are too close to singular for
+        // the answer to be well defined are skipped.
+        const double min_abs_eig_val = eig_vals_ref.cwiseAbs().minCoeff();
+        if (min_abs_eig_val > 1.0e-8 * mat.norm())
+        {
+            const Eigen::LLT<MatrixNd> llt(mat);
+            const bool is_pd_ref = llt.info() == Eigen::Success && eig_vals_ref.minCoeff() > 0.0;
+            const bool is_pd = CFTensorUtilities::isPositiveDefinite(mat);
+            if (is_pd_ref)
+            {
+                ++num_pd;
+                if (is_pd) ++num_pd_agree;
+            }
+            else
+            {
+                ++num_not_pd;
+                if (!is_pd) ++num_not_pd_agree;
+            }
+        }
+
+        // Projection onto the positive semi-definite tensors.
+        VectorNd proj_eig_vals_ref = eig_vals_ref.cwiseMax(0.0);
+        const MatrixNd proj_mat_ref = eig_vecs_ref * proj_eig_vals_ref.asDiagonal() * eig_vecs_ref.transpose();
+        MatrixNd proj_mat = mat;
+        CFTensorUtilities::projectToPositiveSemiDefinite(proj_mat);
+        max_proj_err = std::max(max_proj_err, relative_error(proj_mat, proj_mat_ref));
+    }
+
+    out << "eigenvalues:                  " << (max_eig_val_err < tol ? "OK" : "FAILED") << "\n";
+    out << "eigenvectors:                 " << (max_eig_vec_err < tol ? "OK" : "FAILED") << "\n";
+    out << "exponential:                  " << (max_exp_err < tol ? "OK" : "FAILED") << "\n";
+    out << "projection:                   " << (max_proj_err < tol ? "OK" : "FAILED") << "\n";
+    out << "positive definite (LLT):      " << (num_pd > 0 && num_pd == num_pd_agree ? "OK" : "FAILED") << "\n";
+    out << "not positive definite (LLT):  " << (num_not_pd > 0 && num_not_pd == num_not_pd_agree ? "OK" : "FAILED")
+        << "\n";
+    return;
+} // test_tensor_kernels
+} // namespace
+
+/*******************************************************************************
+ * For each run, the input filename must be given on the command line.  In all *
+ * cases, the command line is:                                                 *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "cf_tensor_utilities.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        const int num_samples = input_db->getInteger("NUM_SAMPLES");
+        const unsigned int seed = static_cast<unsigned int>(input_db->getInteger("SEED"));
+        const double tol = input_db->getDouble("TOL");
+
+        if (SAMRAI_MPI::getRank() == 0)
+        {
+            std::ofstream out("output");
+            test_tensor_kernels(out, num_samples, seed, tol);
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+} // main
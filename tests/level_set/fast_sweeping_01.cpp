@@ -0,0 +1,265 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2019 - 2019 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <HierarchyCellDataOpsReal.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/FastSweepingLSMethod.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/HierarchyMathOps.h>
+
+#include <cmath>
+#include <fstream>
+#include <string>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Test for FastSweepingLSMethod. The signed distance function to a circle is
+// reinitialized from its values in the cells next to the interface on a
+// sequence of grids, and the L1-norm of the error is checked against the
+// expected magnitude and order of convergence for both the first- and the
+// second-order schemes. The parallel version of this test uses many small
+// patches, so that the distance function must be propagated across patch
+// boundaries.
+
+namespace
+{
+struct CircularInterface
+{
+    IBTK::Vector X0;
+    double R;
+};
+
+double
+exact_distance(const IBTK::Vector& X, const CircularInterface& circle)
+{
+    return (X - circle.X0).norm() - circle.R;
+} // exact_distance
+
+template <class F>
+void
+for_each_cell(Pointer<PatchHierarchy<NDIM> > patch_hierarchy, F f)
+{
+    for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
+            const double* const patch_X_lower = patch_geom->getXLower();
+            const double* const patch_dx = patch_geom->getDx();
+            for (Box<NDIM>::Iterator it(patch_box); it; it++)
+            {
+                const CellIndex<NDIM> ci(it());
+                IBTK::Vector X = IBTK::Vector::Zero();
+                for (int d = 0; d < NDIM; ++d)
+                {
+                    X[d] = patch_X_lower[d] + patch_dx[d] * (static_cast<double>(ci(d) - patch_box.lower(d)) + 0.5);
+                }
+                f(*patch, ci, X, patch_dx[0]);
+            }
+        }
+    }
+    return;
+} // for_each_cell
+
+// Set the exact distance in the cells within one grid cell of the interface
+// and large values of the correct sign everywhere else.
+void
+locate_circular_interface(int D_idx,
+                          Pointer<HierarchyMathOps> hier_math_ops,
+                          double /*time*/,
+                          bool /*initial_time*/,
+                          void* ctx)
+{
+    const CircularInterface& circle = *static_cast<CircularInterface*>(ctx);
+    for_each_cell(hier_math_ops->getPatchHierarchy(),
+                  [&](Patch<NDIM>& patch, const CellIndex<NDIM>& ci, const IBTK::Vector& X, const double dx) {
+                      Pointer<CellData<NDIM, double> > D_data = patch.getPatchData(D_idx);
+                      const double distance = exact_distance(X, circle);
+                      if (std::abs(distance) <= dx)
+                      {
+                          (*D_data)(ci) = distance;
+                      }
+                      else
+                      {
+                          (*D_data)(ci) = distance > 0.0 ? 1.0e8 : -1.0e8;
+                      }
+                  });
+    return;
+} // locate_circular_interface
+
+// Reinitialize the distance function on an N x N grid and return the L1-norm
+// of the error.
+double
+reinitialize(const int N, const std::string& order, Pointer<AppInitializer> app_initializer, CircularInterface& circle)
+{
+    const std::string label = "_" + order + "_" + std::to_string(N);
+    Pointer<Database> geometry_db = app_initializer->getComponentDatabase("CartesianGeometry");
+    double x_lo[NDIM], x_up[NDIM];
+    geometry_db->getDoubleArray("x_lo", x_lo, NDIM);
+    geometry_db->getDoubleArray("x_up", x_up, NDIM);
+    BoxArray<NDIM> domain_boxes(1);
+    domain_boxes[0] = Box<NDIM>(hier::Index<NDIM>(0), hier::Index<NDIM>(N - 1));
+
+    Pointer<CartesianGridGeometry<NDIM> > grid_geometry =
+        new CartesianGridGeometry<NDIM>("CartesianGeometry" + label, x_lo, x_up, domain_boxes, false);
+    Pointer<PatchHierarchy<NDIM> > patch_hierarchy =
+        new PatchHierarchy<NDIM>("PatchHierarchy" + label, grid_geometry, false);
+    Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+        new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize" + label,
+                                           nullptr,
+                                           app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+    Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+    Pointer<LoadBalancer<NDIM> > load_balancer =
+        new LoadBalancer<NDIM>("LoadBalancer" + label, app_initializer->getComponentDatabase("LoadBalancer"));
+    Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+        new GriddingAlgorithm<NDIM>("GriddingAlgorithm" + label,
+                                    app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                    error_detector,
+                                    box_generator,
+                                    load_balancer,
+                                    false);
+    gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    Pointer<VariableContext> ctx = var_db->getContext("fast_sweeping_01");
+    Pointer<CellVariable<NDIM, double> > D_var = new CellVariable<NDIM, double>("D" + label);
+    Pointer<CellVariable<NDIM, double> > E_var = new CellVariable<NDIM, double>("E" + label);
+    const int D_idx = var_db->registerVariableAndContext(D_var, ctx);
+    const int E_idx = var_db->registerVariableAndContext(E_var, ctx);
+    const int coarsest_ln = 0;
+    const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        patch_hierarchy->getPatchLevel(ln)->allocatePatchData(D_idx, 0.0);
+        patch_hierarchy->getPatchLevel(ln)->allocatePatchData(E_idx, 0.0);
+    }
+
+    Pointer<HierarchyMathOps> hier_math_ops =
+        new HierarchyMathOps("HierarchyMathOps" + label, patch_hierarchy, coarsest_ln, finest_ln);
+    Pointer<Database> ls_db = app_initializer->getComponentDatabase("LevelSet");
+    ls_db->putString("order", order);
+    Pointer<FastSweepingLSMethod> ls_ops = new FastSweepingLSMethod("FastSweepingLSMethod" + label, ls_db, false);
+    ls_ops->registerInterfaceNeighborhoodLocatingFcn(&locate_circular_interface, static_cast<void*>(&circle));
+    ls_ops->initializeLSData(D_idx, hier_math_ops, /*integrator_step*/ 0, /*time*/ 0.0, /*initial_time*/ true);
+
+    // Compute the error.
+    for_each_cell(patch_hierarchy,
+                  [&](Patch<NDIM>& patch, const CellIndex<NDIM>& ci, const IBTK::Vector& X, const double /*dx*/) {
+                      Pointer<CellData<NDIM, double> > E_data = patch.getPatchData(E_idx);
+                      (*E_data)(ci) = exact_distance(X, circle);
+                  });
+    HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(patch_hierarchy, coarsest_ln, finest_ln);
+    hier_cc_data_ops.subtract(E_idx, D_idx, E_idx);
+    const double error = hier_cc_data_ops.L1Norm(E_idx, hier_math_ops->getCellWeightPatchDescriptorIndex());
+
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        patch_hierarchy->getPatchLevel(ln)->deallocatePatchData(D_idx);
+        patch_hierarchy->getPatchLevel(ln)->deallocatePatchData(E_idx);
+    }
+    var_db->removePatchDataIndex(D_idx);
+    var_db->removePatchDataIndex(E_idx);
+    return error;
+} // reinitialize
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        // prevent a warning about timer initializations
+        TimerManager::createManager(nullptr);
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "fast_sweeping.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        CircularInterface circle;
+        circle.R = input_db->getDouble("R");
+        input_db->getDoubleArray("X0", circle.X0.data(), NDIM);
+        Array<int> N_values = input_db->getIntegerArray("N_VALUES");
+        Pointer<Database> geometry_db = app_initializer->getComponentDatabase("CartesianGeometry");
+        double x_lo[NDIM], x_up[NDIM];
+        geometry_db->getDoubleArray("x_lo", x_lo, NDIM);
+        geometry_db->getDoubleArray("x_up", x_up, NDIM);
+        const double L = x_up[0] - x_lo[0];
+
+        // The first-order scheme converges at first order in the L1-norm and
+        // the second-order scheme at second order. The maximum error also
+        // includes the kink of the distance function at the center of the
+        // circle and so is not checked.
+        const std::string orders[2] = { "FIRST_ORDER", "SECOND_ORDER" };
+        const double expected_rates[2] = { 1.0, 2.0 };
+        const double error_constants[2] = { 0.2, 1.0 };
+        std::ofstream out;
+        if (SAMRAI_MPI::getRank() == 0) out.open("output");
+        for (int k = 0; k < 2; ++k)
+        {
+            bool error_ok = true;
+            bool rate_ok = true;
+            double prev_error = 0.0;
+            for (int i = 0; i < N_values.size(); ++i)
+            {
+                const int N = N_values[i];
+                const double error = reinitialize(N, orders[k], app_initializer, circle);
+                const double h = L / static_cast<double>(N);
+                error_ok = error_ok && error < error_constants[k] * std::pow(h, expected_rates[k]);
+                pout << orders[k] << ": N = " << N << ", L1 error = " << error;
+                if (i > 0)
+                {
+                    const double rate = std::log(prev_error / error) / std::log(double(N) / double(N_values[i - 1]));
+                    rate_ok = rate_ok && rate > 0.8 * expected_rates[k];
+                    pout << ", rate = " << rate;
+                }
+                pout << "\n";
+                prev_error = error;
+            }
+            if (SAMRAI_MPI::getRank() == 0)
+            {
+                out << orders[k] << " L1 error:          " << (error_ok ? "OK" : "FAILED") << "\n";
+                out << orders[k] << " convergence rate:  " << (rate_ok ? "OK" : "FAILED") << "\n";
+            }
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+} // main
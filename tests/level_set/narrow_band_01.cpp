@@ -0,0 +1,302 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2019 - 2019 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/FastSweepingLSMethod.h>
+#include <ibamr/RelaxationLSMethod.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/HierarchyMathOps.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Test for narrow band reinitialization (narrow_band_width > 0) in
+// FastSweepingLSMethod and RelaxationLSMethod. The level set of a circle is
+// reinitialized on a grid with many patches, once over the entire hierarchy
+// and once in a narrow band. Well inside the band the two results must agree,
+// since the upwind stencils never reach the clamped values; well outside of
+// the band the values must be clamped to the signed band width; and no value
+// may exceed the band width.
+
+namespace
+{
+struct CircularInterface
+{
+    IBTK::Vector X0;
+    double R;
+};
+
+double
+exact_distance(const IBTK::Vector& X, const CircularInterface& circle)
+{
+    return (X - circle.X0).norm() - circle.R;
+} // exact_distance
+
+template <class F>
+void
+for_each_cell(Pointer<PatchHierarchy<NDIM> > patch_hierarchy, F f)
+{
+    for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
+            const double* const patch_X_lower = patch_geom->getXLower();
+            const double* const patch_dx = patch_geom->getDx();
+            for (Box<NDIM>::Iterator it(patch_box); it; it++)
+            {
+                const CellIndex<NDIM> ci(it());
+                IBTK::Vector X = IBTK::Vector::Zero();
+                for (int d = 0; d < NDIM; ++d)
+                {
+                    X[d] = patch_X_lower[d] + patch_dx[d] * (static_cast<double>(ci(d) - patch_box.lower(d)) + 0.5);
+                }
+                f(*patch, ci, X, patch_dx[0]);
+            }
+        }
+    }
+    return;
+} // for_each_cell
+
+// Set the exact distance in the cells within one grid cell of the interface
+// and large values of the correct sign everywhere else (for fast sweeping).
+void
+locate_circular_interface(int D_idx,
+                          Pointer<HierarchyMathOps> hier_math_ops,
+                          double /*time*/,
+                          bool /*initial_time*/,
+                          void* ctx)
+{
+    const CircularInterface& circle = *static_cast<CircularInterface*>(ctx);
+    for_each_cell(hier_math_ops->getPatchHierarchy(),
+                  [&](Patch<NDIM>& patch, const CellIndex<NDIM>& ci, const IBTK::Vector& X, const double dx) {
+                      Pointer<CellData<NDIM, double> > D_data = patch.getPatchData(D_idx);
+                      const double distance = exact_distance(X, circle);
+                      if (std::abs(distance) <= dx)
+                      {
+                          (*D_data)(ci) = distance;
+                      }
+                      else
+                      {
+                          (*D_data)(ci) = distance > 0.0 ? 1.0e8 : -1.0e8;
+                      }
+                  });
+    return;
+} // locate_circular_interface
+
+// Set a smooth level set function with the same zero contour as the circle
+// that is not a distance function (for relaxation).
+void
+initialize_circular_level_set(int D_idx,
+                              Pointer<HierarchyMathOps> hier_math_ops,
+                              double /*time*/,
+                              bool /*initial_time*/,
+                              void* ctx)
+{
+    const CircularInterface& circle = *static_cast<CircularInterface*>(ctx);
+    for_each_cell(hier_math_ops->getPatchHierarchy(),
+                  [&](Patch<NDIM>& patch, const CellIndex<NDIM>& ci, const IBTK::Vector& X, const double /*dx*/) {
+                      Pointer<CellData<NDIM, double> > D_data = patch.getPatchData(D_idx);
+                      (*D_data)(ci) = ((X - circle.X0).squaredNorm() - circle.R * circle.R) / (2.0 * circle.R);
+                  });
+    return;
+} // initialize_circular_level_set
+
+// Reinitialize the level set with the given method and narrow band width and
+// return the values in the local cells.
+std::vector<double>
+reinitialize(const std::string& method,
+             const double narrow_band_width,
+             Pointer<HierarchyMathOps> hier_math_ops,
+             Pointer<AppInitializer> app_initializer,
+             CircularInterface& circle)
+{
+    const std::string label = "_" + method + "_" + std::to_string(narrow_band_width);
+    Pointer<PatchHierarchy<NDIM> > patch_hierarchy = hier_math_ops->getPatchHierarchy();
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    Pointer<CellVariable<NDIM, double> > D_var = new CellVariable<NDIM, double>("D" + label);
+    const int D_idx = var_db->registerVariableAndContext(D_var, var_db->getContext("narrow_band_01"));
+    for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        patch_hierarchy->getPatchLevel(ln)->allocatePatchData(D_idx, 0.0);
+    }
+
+    Pointer<Database> ls_db = app_initializer->getComponentDatabase(method);
+    ls_db->putDouble("narrow_band_width", narrow_band_width);
+    Pointer<LSInitStrategy> ls_ops;
+    if (method == "FastSweepingLSMethod")
+    {
+        ls_ops = new FastSweepingLSMethod(method + label, ls_db, false);
+        ls_ops->registerInterfaceNeighborhoodLocatingFcn(&locate_circular_interface, static_cast<void*>(&circle));
+    }
+    else
+    {
+        TBOX_ASSERT(method == "RelaxationLSMethod");
+        ls_ops = new RelaxationLSMethod(method + label, ls_db, false);
+        ls_ops->registerInterfaceNeighborhoodLocatingFcn(&initialize_circular_level_set,
+                                                         static_cast<void*>(&circle));
+    }
+    ls_ops->initializeLSData(D_idx, hier_math_ops, /*integrator_step*/ 0, /*time*/ 0.0, /*initial_time*/ true);
+
+    std::vector<double> values;
+    for_each_cell(patch_hierarchy,
+                  [&](Patch<NDIM>& patch, const CellIndex<NDIM>& ci, const IBTK::Vector& /*X*/, const double /*dx*/) {
+                      Pointer<CellData<NDIM, double> > D_data = patch.getPatchData(D_idx);
+                      values.push_back((*D_data)(ci));
+                  });
+
+    for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        patch_hierarchy->getPatchLevel(ln)->deallocatePatchData(D_idx);
+    }
+    var_db->removePatchDataIndex(D_idx);
+    return values;
+} // reinitialize
+
+const char*
+result(const bool ok)
+{
+    return SAMRAI_MPI::minReduction(ok ? 1 : 0) == 1 ? "OK" : "FAILED";
+} // result
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        // prevent a warning about timer initializations
+        TimerManager::createManager(nullptr);
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "narrow_band.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        CircularInterface circle;
+        circle.R = input_db->getDouble("R");
+        input_db->getDoubleArray("X0", circle.X0.data(), NDIM);
+        const double narrow_band_width = input_db->getDouble("NARROW_BAND_WIDTH");
+
+        // Set up a single level hierarchy with many patches.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"), false);
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy =
+            new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry, false);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               nullptr,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer,
+                                        false);
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        Pointer<HierarchyMathOps> hier_math_ops = new HierarchyMathOps("HierarchyMathOps", patch_hierarchy);
+        const double dx = grid_geometry->getDx()[0];
+        const double band = narrow_band_width * dx;
+
+        // The upwind stencils of the first-order fast sweeping scheme reach one
+        // cell, those of the second-order fast sweeping scheme and of the ENO
+        // relaxation scheme reach two: compare values that are at least three
+        // cells inside the band.
+        const double tol = input_db->getDouble("TOL");
+        const std::string methods[2] = { "FastSweepingLSMethod", "RelaxationLSMethod" };
+        std::ofstream out;
+        if (SAMRAI_MPI::getRank() == 0) out.open("output");
+        for (const std::string& method : methods)
+        {
+            const std::vector<double> full_values =
+                reinitialize(method, 0.0, hier_math_ops, app_initializer, circle);
+            const std::vector<double> band_values =
+                reinitialize(method, narrow_band_width, hier_math_ops, app_initializer, circle);
+
+            const bool same_size = full_values.size() == band_values.size();
+            bool outside_ok = same_size;
+            bool bounded_ok = same_size;
+            int n_inside = 0, n_outside = 0;
+            double max_inside_error = 0.0;
+            for (std::size_t i = 0; same_size && i < full_values.size(); ++i)
+            {
+                const double full = full_values[i];
+                const double narrow = band_values[i];
+                bounded_ok = bounded_ok && std::abs(narrow) <= band;
+                if (std::abs(full) < band - 3.0 * dx)
+                {
+                    ++n_inside;
+                    max_inside_error = std::max(max_inside_error, std::abs(narrow - full));
+                }
+                else if (std::abs(full) > band + 2.0 * dx)
+                {
+                    ++n_outside;
+                    outside_ok = outside_ok && narrow == std::copysign(band, full);
+                }
+            }
+            max_inside_error = SAMRAI_MPI::maxReduction(max_inside_error);
+            const bool inside_ok = same_size && max_inside_error < tol && SAMRAI_MPI::sumReduction(n_inside) > 0;
+            outside_ok = outside_ok && SAMRAI_MPI::sumReduction(n_outside) > 0;
+            pout << method << ": maximum difference inside the band = " << max_inside_error << "\n";
+
+            const char* inside_result = result(inside_ok);
+            const char* outside_result = result(outside_ok);
+            const char* bounded_result = result(bounded_ok);
+            if (SAMRAI_MPI::getRank() == 0)
+            {
+                out << std::left << std::setw(21) << method << "inside band matches full:  " << inside_result << "\n";
+                out << std::left << std::setw(21) << method << "outside band clamped:      " << outside_result << "\n";
+                out << std::left << std::setw(21) << method << "bounded by band width:     " << bounded_result << "\n";
+            }
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+} // main
@@ -0,0 +1,344 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2019 - 2019 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <BoxArray.h>
+#include <CartesianGridGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <SideData.h>
+#include <StandardTagAndInitStrategy.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/INSStaggeredCUIConvectiveOperator.h>
+#include <ibamr/INSStaggeredPPMConvectiveOperator.h>
+#include <ibamr/INSStaggeredStabilizedPPMConvectiveOperator.h>
+#include <ibamr/INSStaggeredWavePropConvectiveOperator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/IndexUtilities.h>
+#include <ibtk/ScratchPatchDataPool.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+#include <algorithm>
+#include <iomanip>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Test that the staggered convective operators, which reuse their temporary
+// patch data between calls to applyConvectiveOperator(), give exactly the same
+// values as operators that allocate new temporary data for each patch
+// (reuse_scratch_data = FALSE). Each operator is applied several times to
+// different velocity fields, and the hierarchy is regridded so that the finer
+// level moves and the sizes of its patches change.  The test also checks that
+// the data handed out by a ScratchPatchDataPool that is never cleared always
+// have the extents and the ghost cell width that are requested.
+
+namespace
+{
+// Allocate the test data on each new patch level, and tag a movable region of
+// the coarsest level for refinement.
+class TestStrategy : public StandardTagAndInitStrategy<NDIM>
+{
+public:
+    TestStrategy(std::vector<int> idxs, Pointer<CartesianGridGeometry<NDIM> > grid_geom)
+        : d_idxs(std::move(idxs)), d_grid_geom(grid_geom)
+    {
+        // intentionally blank
+    }
+
+    void setShift(const double shift)
+    {
+        d_shift = shift;
+        return;
+    }
+
+    void initializeLevelData(Pointer<BasePatchHierarchy<NDIM> > hierarchy,
+                             int level_number,
+                             double init_data_time,
+                             bool /*can_be_refined*/,
+                             bool /*initial_time*/,
+                             Pointer<BasePatchLevel<NDIM> > /*old_level*/,
+                             bool allocate_data) override
+    {
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = hierarchy;
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(level_number);
+        if (allocate_data)
+        {
+            for (const int idx : d_idxs) level->allocatePatchData(idx, init_data_time);
+        }
+        return;
+    }
+
+    void resetHierarchyConfiguration(Pointer<BasePatchHierarchy<NDIM> > /*hierarchy*/,
+                                     int /*coarsest_level*/,
+                                     int /*finest_level*/) override
+    {
+        return;
+    }
+
+    void applyGradientDetector(Pointer<BasePatchHierarchy<NDIM> > hierarchy,
+                               int level_number,
+                               double /*error_data_time*/,
+                               int tag_index,
+                               bool /*initial_time*/,
+                               bool /*uses_richardson_extrapolation_too*/) override
+    {
+        // The tagged region is the cube [0.25 + shift, 0.625 + 2 * shift]^NDIM,
+        // so that both the location and the size of the finer level change.
+        VectorNd x_lower, x_upper;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            x_lower[d] = 0.25 + d_shift;
+            x_upper[d] = 0.625 + 2.0 * d_shift;
+        }
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = hierarchy;
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(level_number);
+        const Box<NDIM> tag_box(IndexUtilities::getCellIndex(x_lower, d_grid_geom, level->getRatio()),
+                                IndexUtilities::getCellIndex(x_upper, d_grid_geom, level->getRatio()) -
+                                    IntVector<NDIM>(1));
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, int> > tag_data = patch->getPatchData(tag_index);
+            const Box<NDIM> box = patch->getBox() * tag_box;
+            if (!box.empty()) tag_data->fillAll(1, box);
+        }
+        return;
+    }
+
+private:
+    std::vector<int> d_idxs;
+    Pointer<CartesianGridGeometry<NDIM> > d_grid_geom;
+    double d_shift = 0.0;
+};
+
+Pointer<ConvectiveOperator>
+build_convective_operator(const std::string& type,
+                          const std::string& object_name,
+                          Pointer<Database> input_db,
+                          const std::vector<RobinBcCoefStrategy<NDIM>*>& bc_coefs)
+{
+    if (type == "PPM")
+    {
+        return INSStaggeredPPMConvectiveOperator::allocate_operator(object_name, input_db, ADVECTIVE, bc_coefs);
+    }
+    else if (type == "CUI")
+    {
+        return INSStaggeredCUIConvectiveOperator::allocate_operator(object_name, input_db, ADVECTIVE, bc_coefs);
+    }
+    else if (type == "STABILIZED_PPM")
+    {
+        return INSStaggeredStabilizedPPMConvectiveOperator::allocate_operator(
+            object_name, input_db, ADVECTIVE, bc_coefs);
+    }
+    TBOX_ASSERT(type == "WAVE_PROP");
+    return INSStaggeredWavePropConvectiveOperator::allocate_operator(object_name, input_db, ADVECTIVE, bc_coefs);
+} // build_convective_operator
+
+// Check that pooled data requested for every patch of the hierarchy are
+// defined on the origin-shifted patch box with the requested ghost cell width.
+bool
+check_scratch_data(ScratchPatchDataPool<SideData<NDIM, double> >& pool,
+                   Pointer<PatchHierarchy<NDIM> > patch_hierarchy,
+                   const IntVector<NDIM>& ghosts)
+{
+    bool ok = true;
+    for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            const Box<NDIM>& patch_box = level->getPatch(p())->getBox();
+            Box<NDIM> shifted_box = patch_box;
+            shifted_box.shift(-IntVector<NDIM>(patch_box.lower()));
+            Pointer<SideData<NDIM, double> > data = pool.getScratchData(patch_box, 1, ghosts);
+            ok = ok && data->getBox() == shifted_box && data->getGhostCellWidth() == ghosts;
+        }
+    }
+    return SAMRAI_MPI::minReduction(ok ? 1 : 0) == 1;
+} // check_scratch_data
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "convective_scratch_pool.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const double shift = input_db->getDouble("SHIFT");
+        const int num_regrids = input_db->getInteger("NUM_REGRIDS");
+        const int num_applications = input_db->getInteger("NUM_APPLICATIONS");
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+        Pointer<SideVariable<NDIM, double> > u_var = new SideVariable<NDIM, double>("u");
+        Pointer<SideVariable<NDIM, double> > n_var = new SideVariable<NDIM, double>("n");
+        Pointer<SideVariable<NDIM, double> > n_ref_var = new SideVariable<NDIM, double>("n_ref");
+        const int u_idx = var_db->registerVariableAndContext(u_var, ctx, IntVector<NDIM>(1));
+        const int n_idx = var_db->registerVariableAndContext(n_var, ctx, IntVector<NDIM>(0));
+        const int n_ref_idx = var_db->registerVariableAndContext(n_ref_var, ctx, IntVector<NDIM>(0));
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        TestStrategy test_strategy({ u_idx, n_idx, n_ref_idx }, grid_geometry);
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               &test_strategy,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Initialize the AMR patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int tag_buffer = 1;
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+        Array<int> tag_buffer_array(gridding_algorithm->getMaxLevels());
+        for (int k = 0; k < tag_buffer_array.size(); ++k) tag_buffer_array[k] = tag_buffer;
+
+        // The operators that reuse their temporary data are kept for the entire
+        // run.
+        muParserCartGridFunction u_fcn("u", app_initializer->getComponentDatabase("u"), grid_geometry);
+        const std::vector<RobinBcCoefStrategy<NDIM>*> bc_coefs(NDIM, static_cast<RobinBcCoefStrategy<NDIM>*>(NULL));
+        Pointer<Database> pooled_db = app_initializer->getComponentDatabase("PooledConvectiveOperator");
+        Pointer<Database> reference_db = app_initializer->getComponentDatabase("ReferenceConvectiveOperator");
+        const std::vector<std::string> types = { "PPM", "CUI", "STABILIZED_PPM", "WAVE_PROP" };
+        std::vector<Pointer<ConvectiveOperator> > pooled_ops;
+        for (const std::string& type : types)
+        {
+            pooled_ops.push_back(build_convective_operator(type, "pooled_" + type, pooled_db, bc_coefs));
+        }
+        ScratchPatchDataPool<SideData<NDIM, double> > pool;
+
+        for (int k = 0; k <= num_regrids; ++k)
+        {
+            if (k > 0)
+            {
+                const BoxArray<NDIM> old_boxes = patch_hierarchy->getPatchLevel(1)->getBoxes();
+                test_strategy.setShift(k * shift);
+                gridding_algorithm->regridAllFinerLevels(patch_hierarchy, 0, static_cast<double>(k), tag_buffer_array);
+                const BoxArray<NDIM> new_boxes = patch_hierarchy->getPatchLevel(1)->getBoxes();
+                bool grid_changed = old_boxes.getNumberOfBoxes() != new_boxes.getNumberOfBoxes();
+                for (int i = 0; !grid_changed && i < new_boxes.getNumberOfBoxes(); ++i)
+                {
+                    grid_changed = !(old_boxes[i] == new_boxes[i]);
+                }
+                pout << "regrid " << k << ":\n";
+                pout << "  finer level moved:                         " << (grid_changed ? "OK" : "FAILED") << "\n";
+            }
+            else
+            {
+                pout << "initial grid:\n";
+            }
+            const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+
+            // Set up vector objects on the current hierarchy.
+            HierarchyMathOps hier_math_ops("hier_math_ops_" + std::to_string(k), patch_hierarchy);
+            const int h_sc_idx = hier_math_ops.getSideWeightPatchDescriptorIndex();
+            SAMRAIVectorReal<NDIM, double> u_vec("u", patch_hierarchy, 0, finest_ln);
+            SAMRAIVectorReal<NDIM, double> n_vec("n", patch_hierarchy, 0, finest_ln);
+            SAMRAIVectorReal<NDIM, double> n_ref_vec("n_ref", patch_hierarchy, 0, finest_ln);
+            u_vec.addComponent(u_var, u_idx, h_sc_idx);
+            n_vec.addComponent(n_var, n_idx, h_sc_idx);
+            n_ref_vec.addComponent(n_ref_var, n_ref_idx, h_sc_idx);
+
+            // Apply each operator repeatedly to different velocity fields and
+            // compare the values with those computed by a new operator that
+            // does not reuse its temporary data.
+            for (unsigned int i = 0; i < types.size(); ++i)
+            {
+                Pointer<ConvectiveOperator> pooled_op = pooled_ops[i];
+                pooled_op->initializeOperatorState(u_vec, n_vec);
+                Pointer<ConvectiveOperator> reference_op = build_convective_operator(
+                    types[i], "reference_" + types[i] + "_" + std::to_string(k), reference_db, bc_coefs);
+                reference_op->initializeOperatorState(u_vec, n_ref_vec);
+
+                double n_max_norm = 0.0, e_max_norm = 0.0;
+                for (int j = 0; j < num_applications; ++j)
+                {
+                    u_fcn.setDataOnPatchHierarchy(u_idx, u_var, patch_hierarchy, k + 0.1 * j);
+                    pooled_op->setAdvectionVelocity(u_idx);
+                    pooled_op->applyConvectiveOperator(u_idx, n_idx);
+                    reference_op->setAdvectionVelocity(u_idx);
+                    reference_op->applyConvectiveOperator(u_idx, n_ref_idx);
+
+                    n_max_norm = std::max(n_max_norm, n_ref_vec.maxNorm());
+                    n_ref_vec.subtract(Pointer<SAMRAIVectorReal<NDIM, double> >(&n_ref_vec, false),
+                                       Pointer<SAMRAIVectorReal<NDIM, double> >(&n_vec, false));
+                    e_max_norm = std::max(e_max_norm, n_ref_vec.maxNorm());
+                }
+                reference_op->deallocateOperatorState();
+
+                pout << "  " << std::left << std::setw(16) << types[i] + ":" << "|N|_oo > 0, N_pooled == N: "
+                     << (n_max_norm > 0.0 && e_max_norm == 0.0 ? "OK" : "FAILED") << "\n";
+            }
+
+            // The same pool is used with two ghost cell widths on every
+            // hierarchy configuration without ever being cleared.
+            const bool pool_ok = check_scratch_data(pool, patch_hierarchy, IntVector<NDIM>(1)) &&
+                                 check_scratch_data(pool, patch_hierarchy, IntVector<NDIM>(4));
+            pout << "  pooled data box and ghost cell width:      " << (pool_ok ? "OK" : "FAILED") << "\n";
+        }
+
+        for (const Pointer<ConvectiveOperator>& pooled_op : pooled_ops) pooled_op->deallocateOperatorState();
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+} // main
@@ -0,0 +1,175 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2019 - 2019 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/INSStaggeredPPMConvectiveOperator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// A test program to check that the tiled evaluation of the staggered PPM
+// convective operator yields exactly the same values as the evaluation of the
+// operator on entire patches.
+
+/*******************************************************************************
+ * For each run, the input filename must be given on the command line.  In all *
+ * cases, the command line is:                                                 *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "ppm_tiling.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+
+        Pointer<SideVariable<NDIM, double> > u_var = new SideVariable<NDIM, double>("u");
+        Pointer<SideVariable<NDIM, double> > n_var = new SideVariable<NDIM, double>("n");
+        Pointer<SideVariable<NDIM, double> > n_tiled_var = new SideVariable<NDIM, double>("n_tiled");
+
+        const int u_idx = var_db->registerVariableAndContext(u_var, ctx, IntVector<NDIM>(1));
+        const int n_idx = var_db->registerVariableAndContext(n_var, ctx, IntVector<NDIM>(0));
+        const int n_tiled_idx = var_db->registerVariableAndContext(n_tiled_var, ctx, IntVector<NDIM>(0));
+
+        // Initialize the AMR patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int tag_buffer = 1;
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+
+        // Allocate data on each level of the patch hierarchy.
+        for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->allocatePatchData(u_idx, 0.0);
+            level->allocatePatchData(n_idx, 0.0);
+            level->allocatePatchData(n_tiled_idx, 0.0);
+        }
+
+        // Setup vector objects.
+        HierarchyMathOps hier_math_ops("hier_math_ops", patch_hierarchy);
+        const int h_sc_idx = hier_math_ops.getSideWeightPatchDescriptorIndex();
+
+        SAMRAIVectorReal<NDIM, double> u_vec("u", patch_hierarchy, 0, patch_hierarchy->getFinestLevelNumber());
+        SAMRAIVectorReal<NDIM, double> n_vec("n", patch_hierarchy, 0, patch_hierarchy->getFinestLevelNumber());
+        SAMRAIVectorReal<NDIM, double> n_tiled_vec(
+            "n_tiled", patch_hierarchy, 0, patch_hierarchy->getFinestLevelNumber());
+
+        u_vec.addComponent(u_var, u_idx, h_sc_idx);
+        n_vec.addComponent(n_var, n_idx, h_sc_idx);
+        n_tiled_vec.addComponent(n_tiled_var, n_tiled_idx, h_sc_idx);
+
+        // Setup the advection velocity.
+        muParserCartGridFunction u_fcn("u", app_initializer->getComponentDatabase("u"), grid_geometry);
+        u_fcn.setDataOnPatchHierarchy(u_idx, u_var, patch_hierarchy, 0.0);
+
+        // Evaluate the convective operator in each supported form with and
+        // without tiling and compare the results.
+        std::vector<RobinBcCoefStrategy<NDIM>*> bc_coefs(NDIM, static_cast<RobinBcCoefStrategy<NDIM>*>(NULL));
+        Pointer<Database> untiled_db = app_initializer->getComponentDatabase("UntiledConvectiveOperator");
+        Pointer<Database> tiled_db = app_initializer->getComponentDatabase("TiledConvectiveOperator");
+        const std::vector<ConvectiveDifferencingType> difference_forms = { ADVECTIVE, CONSERVATIVE, SKEW_SYMMETRIC };
+
+        std::ofstream out;
+        if (SAMRAI_MPI::getRank() == 0) out.open("output");
+        for (const ConvectiveDifferencingType difference_form : difference_forms)
+        {
+            n_vec.setToScalar(0.0);
+            n_tiled_vec.setToScalar(0.0);
+
+            INSStaggeredPPMConvectiveOperator untiled_op("untiled_op", untiled_db, difference_form, bc_coefs);
+            untiled_op.initializeOperatorState(u_vec, n_vec);
+            untiled_op.setAdvectionVelocity(u_idx);
+            untiled_op.applyConvectiveOperator(u_idx, n_idx);
+
+            INSStaggeredPPMConvectiveOperator tiled_op("tiled_op", tiled_db, difference_form, bc_coefs);
+            tiled_op.initializeOperatorState(u_vec, n_tiled_vec);
+            tiled_op.setAdvectionVelocity(u_idx);
+            tiled_op.applyConvectiveOperator(u_idx, n_tiled_idx);
+
+            const double n_max_norm = n_vec.maxNorm();
+            n_tiled_vec.subtract(Pointer<SAMRAIVectorReal<NDIM, double> >(&n_tiled_vec, false),
+                                 Pointer<SAMRAIVectorReal<NDIM, double> >(&n_vec, false));
+            const double e_max_norm = n_tiled_vec.maxNorm();
+
+            if (SAMRAI_MPI::getRank() == 0)
+            {
+                out << enum_to_string<ConvectiveDifferencingType>(difference_form) << "\n";
+                out << "|N|_oo > 0: " << (n_max_norm > 0.0 ? "true" : "false") << "\n";
+                out << "|N_tiled - N|_oo = " << e_max_norm << "\n";
+            }
+        }
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+} // run_example
@@ -0,0 +1,151 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2019 - 2019 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/INSVCStaggeredConservativeHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+#include <cmath>
+#include <fstream>
+#include <string>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Test for the density error based time step size selection of
+// INSVCStaggeredConservativeHierarchyIntegrator. A density bump is advected by
+// a uniform flow in a periodic domain with SSPRK3 density time stepping, first
+// without error estimation and then with two different values of
+// density_error_tolerance. The time step size must decrease with the tolerance
+// and, because the embedded SSPRK2 solution has a local error of O(dt^3),
+// should scale like the cube root of the tolerance.
+
+namespace
+{
+// Advance the solution by a fixed number of time steps and return the time
+// step size proposed by the integrator for the following step.
+double
+run(Pointer<AppInitializer> app_initializer, const std::string& label, const double tol)
+{
+    Pointer<Database> input_db = app_initializer->getInputDatabase();
+    Pointer<Database> integrator_db =
+        app_initializer->getComponentDatabase("INSVCStaggeredConservativeHierarchyIntegrator");
+    integrator_db->getDatabase("mass_momentum_integrator_db")->putDouble("density_error_tolerance", tol);
+
+    Pointer<INSVCStaggeredHierarchyIntegrator> time_integrator = new INSVCStaggeredConservativeHierarchyIntegrator(
+        "INSVCStaggeredConservativeHierarchyIntegrator" + label, integrator_db, /*register_for_restart*/ false);
+    Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+        "CartesianGeometry" + label, app_initializer->getComponentDatabase("CartesianGeometry"), false);
+    Pointer<PatchHierarchy<NDIM> > patch_hierarchy =
+        new PatchHierarchy<NDIM>("PatchHierarchy" + label, grid_geometry, false);
+    Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+        new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize" + label,
+                                           time_integrator,
+                                           app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+    Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+    Pointer<LoadBalancer<NDIM> > load_balancer =
+        new LoadBalancer<NDIM>("LoadBalancer" + label, app_initializer->getComponentDatabase("LoadBalancer"));
+    Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+        new GriddingAlgorithm<NDIM>("GriddingAlgorithm" + label,
+                                    app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                    error_detector,
+                                    box_generator,
+                                    load_balancer,
+                                    false);
+
+    // Setup the velocity and the advected density.
+    Pointer<CartGridFunction> u_init = new muParserCartGridFunction(
+        "u_init" + label, app_initializer->getComponentDatabase("VelocityInitialConditions"), grid_geometry);
+    time_integrator->registerVelocityInitialConditions(u_init);
+    Pointer<SideVariable<NDIM, double> > rho_var = new SideVariable<NDIM, double>("rho" + label);
+    time_integrator->registerMassDensityVariable(rho_var);
+    Pointer<CartGridFunction> rho_init = new muParserCartGridFunction(
+        "rho_init" + label, app_initializer->getComponentDatabase("DensityInitialConditions"), grid_geometry);
+    time_integrator->registerMassDensityInitialConditions(rho_init);
+
+    // Initialize hierarchy configuration and data on all patches.
+    time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+    const int num_steps = input_db->getInteger("NUM_STEPS");
+    for (int k = 0; k < num_steps; ++k)
+    {
+        const double dt = time_integrator->getMaximumTimeStepSize();
+        pout << label << ": step " << k << ", dt = " << dt << "\n";
+        time_integrator->advanceHierarchy(dt);
+    }
+    return time_integrator->getMaximumTimeStepSize();
+} // run
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        // prevent a warning about timer initializations
+        TimerManager::createManager(nullptr);
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "INS.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        const double loose_tol = input_db->getDouble("LOOSE_TOL");
+        const double tight_tol = input_db->getDouble("TIGHT_TOL");
+        const double cfl_dt = run(app_initializer, "_cfl", 0.0);
+        const double loose_dt = run(app_initializer, "_loose", loose_tol);
+        const double tight_dt = run(app_initializer, "_tight", tight_tol);
+
+        // dt should scale like tol^(1/3) once it is limited by the error
+        // estimate rather than by the CFL condition.
+        const double expected_ratio = std::cbrt(loose_tol / tight_tol);
+        const double ratio = loose_dt / tight_dt;
+        pout << "CFL dt = " << cfl_dt << ", loose tolerance dt = " << loose_dt << ", tight tolerance dt = " << tight_dt
+             << "\n"
+             << "dt ratio = " << ratio << ", expected ratio = " << expected_ratio << "\n";
+
+        if (SAMRAI_MPI::getRank() == 0)
+        {
+            std::ofstream out("output");
+            out << "loose tolerance reduces dt:         " << (loose_dt < cfl_dt ? "OK" : "FAILED") << "\n"
+                << "tight tolerance reduces dt further: " << (tight_dt < loose_dt ? "OK" : "FAILED") << "\n"
+                << "dt scales like tol^(1/3):           "
+                << (ratio > expected_ratio / 1.5 && ratio < 1.5 * expected_ratio ? "OK" : "FAILED") << "\n";
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+} // main